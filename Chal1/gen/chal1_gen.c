@@ -0,0 +1,232 @@
+/**
+ * @file chal1_gen.c
+ *
+ * @brief Input generator for Challenge 1: one rotation (L or R and a step
+ * count) per line
+ *
+ * Usage: chal1_gen [-n lines | -s size] [-S seed] [-o output]
+ * [-d distribution] [-m scale] [-l left_percent]
+ *
+ * Distributions: uniform (1 to scale), log (log-uniform from 1 to scale, so
+ * every digit count is equally likely) and geometric (mean of scale). The
+ * default matches the checked-in input: 4431 lines, uniform up to 999.
+ *
+ * @author Mexeck88
+ *
+ * @date 18OCT26
+ */
+
+#include <limits.h>
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "aoc_gen.h"
+#include "aoc_input.h"
+
+/**
+ * @enum gen_info_t
+ * @brief Generator defaults
+ */
+typedef enum gen_info_t
+{
+    DEFAULT_LINES = 4431,
+    DEFAULT_SCALE = 999,
+    DEFAULT_LEFT  = 50,
+    PERCENT       = 100,
+} gen_info_t;
+
+/**
+ * @enum gen_dist_t
+ * @brief Step count distributions
+ */
+typedef enum gen_dist_t
+{
+    DIST_UNIFORM,
+    DIST_LOG,
+    DIST_GEOMETRIC,
+    DIST_COUNT,
+} gen_dist_t;
+
+static const char * gp_dist_names[DIST_COUNT] = {
+    "uniform",
+    "log",
+    "geometric",
+};
+
+/**
+ * @struct gen_args_t
+ * @brief Generator options
+ */
+typedef struct gen_args_t
+{
+    aoc_gen_args_t common;
+    gen_dist_t     dist;
+    uint64_t       scale;
+    uint64_t       left; // Percent of rotations to the left
+} gen_args_t;
+
+/**
+ * @brief Draws one step count; the solver keeps steps in an int
+ *
+ * @param p_rng Seeded generator
+ * @param p_args Generator options
+ *
+ * @return A step count from 1 to INT_MAX
+ */
+static uint64_t gen_steps (aoc_rng_t * p_rng, const gen_args_t * p_args)
+{
+    uint64_t steps = 1;
+    uint64_t low   = 1;
+    uint64_t high  = 0;
+    int      bits  = 0;
+
+    switch (p_args->dist)
+    {
+        case DIST_LOG:
+            // Pick a power of two band first, then a value inside it
+            bits = 64 - __builtin_clzll(p_args->scale);
+            low  = 1ULL << aoc_rng_below(p_rng, (uint64_t)bits);
+            high = (2 * low - 1 < p_args->scale) ? 2 * low - 1 : p_args->scale;
+            steps = low + aoc_rng_below(p_rng, high - low + 1);
+            break;
+
+        case DIST_GEOMETRIC:
+            steps = 1
+                  + (uint64_t)(-log1p(-aoc_rng_unit(p_rng))
+                               * (double)(p_args->scale - 1));
+            break;
+
+        default:
+            steps = 1 + aoc_rng_below(p_rng, p_args->scale);
+            break;
+    }
+
+    return (INT_MAX < steps) ? INT_MAX : steps;
+}
+
+/**
+ * @brief Parses the command line
+ *
+ * @param argc Argument count
+ * @param argv Argument vector
+ * @param p_args Options to fill in
+ *
+ * @return true on success, false on a bad command line
+ */
+static bool gen_parse_args (int argc, char ** argv, gen_args_t * p_args)
+{
+    int option = 0;
+    int dist   = 0;
+
+    aoc_gen_args_init(&p_args->common, DEFAULT_LINES);
+    p_args->dist  = DIST_UNIFORM;
+    p_args->scale = DEFAULT_SCALE;
+    p_args->left  = DEFAULT_LEFT;
+
+    while (-1 != (option = getopt(argc, argv, AOC_GEN_OPTIONS "d:m:l:")))
+    {
+        switch (aoc_gen_option(&p_args->common, option, optarg))
+        {
+            case AOC_GEN_OPT_USED:
+                continue;
+            case AOC_GEN_OPT_BAD:
+                return false;
+            default:
+                break;
+        }
+
+        switch (option)
+        {
+            case 'd':
+                for (dist = 0; dist < DIST_COUNT; dist++)
+                {
+                    if (0 == strcmp(optarg, gp_dist_names[dist]))
+                    {
+                        break;
+                    }
+                }
+
+                if (DIST_COUNT == dist)
+                {
+                    printf("ERROR: Unknown distribution: %s\n", optarg);
+                    return false;
+                }
+                p_args->dist = (gen_dist_t)dist;
+                break;
+
+            case 'm':
+                if ((false == aoc_gen_parse_size(optarg, &p_args->scale))
+                    || (0 == p_args->scale) || (INT_MAX < p_args->scale))
+                {
+                    printf("ERROR: Scale must be 1 to %d: %s\n",
+                           INT_MAX,
+                           optarg);
+                    return false;
+                }
+                break;
+
+            case 'l':
+                if ((false == aoc_gen_parse_size(optarg, &p_args->left))
+                    || (PERCENT < p_args->left))
+                {
+                    printf("ERROR: Left percent must be 0 to 100: %s\n",
+                           optarg);
+                    return false;
+                }
+                break;
+
+            default:
+                printf("Usage: %s [-n lines | -s size] [-S seed] [-o output] "
+                       "[-d uniform|log|geometric] [-m scale] "
+                       "[-l left_percent]\n",
+                       argv[0]);
+                return false;
+        }
+    }
+
+    return true;
+}
+
+int main (int argc, char ** argv)
+{
+    int          retcode = 1;
+    gen_args_t   args    = { 0 };
+    aoc_rng_t    rng     = { 0 };
+    aoc_writer_t writer  = { 0 };
+    uint64_t     lines   = 0;
+    char         turn    = 'L';
+
+    if ((false == gen_parse_args(argc, argv, &args))
+        || (AOC_SUCCESS != aoc_writer_open(&writer, args.common.p_out)))
+    {
+        goto EXIT;
+    }
+
+    aoc_rng_seed(&rng, args.common.seed);
+
+    for (lines = 0; true == aoc_gen_more(&args.common, &writer, lines); lines++)
+    {
+        turn = (aoc_rng_below(&rng, PERCENT) < args.left) ? 'L' : 'R';
+
+        if ((AOC_SUCCESS != aoc_writer_put(&writer, &turn, 1))
+            || (AOC_SUCCESS
+                != aoc_writer_number(&writer, gen_steps(&rng, &args)))
+            || (AOC_SUCCESS != aoc_writer_put(&writer, "\n", 1)))
+        {
+            goto CLEAN;
+        }
+    }
+
+    retcode = 0;
+CLEAN:
+    if (AOC_SUCCESS != aoc_writer_close(&writer))
+    {
+        retcode = 1;
+    }
+EXIT:
+    return retcode;
+}
+
+/** END OF FILE **/
\ No newline at end of file
@@ -8,26 +8,66 @@
  * @date 01DEC25
  */
 
+#include <limits.h>
 #include <string.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdbool.h>
+#include <stdint.h>
+
+#include "aoc_arena.h"
+#include "aoc_bench.h"
+#include "aoc_cache.h"
+#include "aoc_day.h"
+#include "aoc_input.h"
+#include "aoc_log.h"
+#include "aoc_pipe.h"
+#include "aoc_snap.h"
+#include "aoc_trace.h"
 
 #define STARTING_POINT  50
 #define INIT_CAPACITY   50
-#define MAX_LINE_LENGTH 8
 #define DIAL_MAX        99
 #define DIAL_MIN        0
 #define REALLOC_SCALE   2
 #define FILE_PATH       "src/chal1_input.txt"
 #define RIGHT           "R"
 #define LEFT            "L"
+#define LINE_DELIMS     "\r\n"
+#define DAY_NUMBER      1
+#define SOLVER_VERSION  "1" // Bump when the answers for an input change
+
+/**
+ * @struct main_args_t
+ * @brief Main arguments structure containing the input, its rotations and the
+ * passwords
+ */
+typedef struct main_args_t
+{
+    const char * p_file_path;
+    aoc_input_t  input;          // Input the rotations are parsed from
+    aoc_arena_t  arena;          // Holds the array of rotations
+    int *        p_rotations;    // Signed steps, right is positive
+    int          rotation_count;
+    int          position;       // Dial position during a pipelined solve
+    int          password;       // Part 1
+    int          passes;         // Part 2
+} main_args_t;
 
-bool chal1_load_input (const char * p_file_path,
-                       char ***     ppp_lines,
-                       int *        p_line_count);
+bool chal1_load_input (main_args_t * p_main_args);
+bool chal1_parse_input (main_args_t * p_main_args);
+bool chal1_load_snapshot (main_args_t * p_main_args);
+bool chal1_write_snapshot (main_args_t * p_main_args, const char * p_snap_path);
+bool chal1_solve_part1 (main_args_t * p_main_args);
+bool chal1_solve_part2 (main_args_t * p_main_args);
+void chal1_reset (main_args_t * p_main_args);
+bool chal1_solve_pipelined (main_args_t * p_main_args);
+uint8_t chal1_run (const char *       p_file_path,
+                   aoc_cache_t *      p_cache,
+                   aoc_day_result_t * p_result);
 bool chal1_test_position (int current_position, int * password);
-bool chal1_determine_steps (const char * p_line, int * p_rotation_steps);
+bool chal1_determine_steps (aoc_view_t line, int * p_rotation_steps);
 int  chal1_count_zero_crossings (int start_position, int rotation_steps);
+int  chal1_count_zero_crossings_ref (int start_position, int rotation_steps);
 
 /** END OF FILE **/
\ No newline at end of file
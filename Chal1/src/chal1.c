@@ -10,43 +10,54 @@
 
 #include "chal1.h"
 
+// Rotations are snapshotted as int32 and solved in place
+_Static_assert(sizeof(int) == sizeof(int32_t), "rotations are 32-bit");
+
 /**
  * @brief Determines the number of steps to rotate the dial based on the input
  * line (left versus right)
  *
- * @param p_line The input line indicating the direction and steps
+ * @param line The input line indicating the direction and steps
  * @param p_rotation_steps Pointer to store the number of rotation steps
  *
  * @return true on success, false otherwise
  */
-bool chal1_determine_steps (const char * p_line, int * p_rotation_steps)
+bool chal1_determine_steps (aoc_view_t line, int * p_rotation_steps)
 {
-    bool b_retval = false;
-    if (NULL == p_line || NULL == p_rotation_steps)
+    bool       b_retval = false;
+    long       steps    = 0;
+    aoc_view_t count    = { 0 };
+
+    if (NULL == line.p_data || NULL == p_rotation_steps)
     {
         printf("ERROR: NULL pointer passed to determine_steps\n");
         goto EXIT;
     }
 
     // Grab steps
-    char count[MAX_LINE_LENGTH];
-    if (0 == snprintf(count, MAX_LINE_LENGTH, "%s", p_line + 1))
+    count.p_data = line.p_data + 1;
+    count.length = (0 < line.length) ? line.length - 1 : 0;
+    if (false == aoc_view_parse_long(count, &steps))
     {
-        printf("ERROR: Unable to copy steps from line: %s\n", p_line);
+        printf("ERROR: Unable to parse steps from line: %.*s\n",
+               (int)line.length,
+               line.p_data);
         goto EXIT;
     }
 
-    if (0 == strncmp(RIGHT, p_line, 1))
+    if (0 == strncmp(RIGHT, line.p_data, 1))
     {
-        *p_rotation_steps = atoi(count);
+        *p_rotation_steps = (int)steps;
     }
-    else if (0 == strncmp(LEFT, p_line, 1))
+    else if (0 == strncmp(LEFT, line.p_data, 1))
     {
-        *p_rotation_steps = -atoi(count);
+        *p_rotation_steps = (int)-steps;
     }
     else
     {
-        printf("ERROR: Invalid direction in line: %s\n", p_line);
+        printf("ERROR: Invalid direction in line: %.*s\n",
+               (int)line.length,
+               line.p_data);
         goto EXIT;
     }
 
@@ -66,11 +77,11 @@ EXIT:
 bool chal1_test_position (int current_position, int * password)
 {
     bool b_retval = false;
-    printf("Testing position: %d\n", current_position);
+    AOC_LOG_TRACE("Testing position: %ld", current_position);
     if (0 == current_position)
     {
         (*password)++;
-        printf("  -> Landed on 0! Password now: %d\n", *password);
+        AOC_LOG_TRACE("  -> Landed on 0! Password now: %ld", *password);
     }
 
     b_retval = true;
@@ -96,8 +107,9 @@ int chal1_count_zero_crossings (int start_position, int rotation_steps)
         return 0;
     }
 
-    printf(
-        "Start Pos: %d, Rotation Steps: %d\n", start_position, rotation_steps);
+    AOC_LOG_TRACE("Start Pos: %ld, Rotation Steps: %ld",
+                  start_position,
+                  rotation_steps);
 
     // Simulate each step of the rotation
     int current = start_position;
@@ -139,154 +151,642 @@ int chal1_count_zero_crossings (int start_position, int rotation_steps)
 }
 
 /**
- * @brief Loads the input file and stores each line in an array
+ * @brief Counts how many times a rotation lands on position 0 by simulating
+ * every step (the reference chal1_count_zero_crossings is checked against)
  *
- * @param p_file_path Path to the input file
- * @param ppp_lines Pointer to an array of strings to store the lines
- * @param p_line_count Pointer to an integer to store the number of lines
+ * @param start_position The starting position of the dial
+ * @param rotation_steps The number of steps to rotate
+ *
+ * @return The number of times position 0 is landed on during rotation
+ */
+int chal1_count_zero_crossings_ref (int start_position, int rotation_steps)
+{
+    int count     = 0;
+    int dial_size = DIAL_MAX + 1;
+
+    if (0 == rotation_steps)
+    {
+        return 0;
+    }
+
+    AOC_LOG_TRACE("Start Pos: %ld, Rotation Steps: %ld",
+                  start_position,
+                  rotation_steps);
+
+    // Simulate each step of the rotation
+    int current = start_position;
+
+    if (0 < rotation_steps)
+    {
+        // Rotate right
+        for (int i = 0; i < rotation_steps; i++)
+        {
+            current++;
+            if (current >= dial_size)
+            {
+                current = 0;
+            }
+            if (current == 0)
+            {
+                count++;
+            }
+        }
+    }
+    else
+    {
+        // Rotate left
+        for (int i = 0; i < -rotation_steps; i++)
+        {
+            current--;
+            if (current < 0)
+            {
+                current = dial_size - 1;
+            }
+            if (current == 0)
+            {
+                count++;
+            }
+        }
+    }
+
+    return count;
+}
+
+/**
+ * @brief Opens (maps) the input file
+ *
+ * @param p_main_args Pointer to the main arguments structure
  *
  * @return true on success, false on failure
  */
-bool chal1_load_input (const char * p_file_path,
-                       char ***     ppp_lines,
-                       int *        p_line_count)
+bool chal1_load_input (main_args_t * p_main_args)
 {
-    int  capacity   = INIT_CAPACITY;
-    int  line_count = 0;
-    bool b_retval   = false;
+    bool b_retval = false;
+
+    AOC_TRACE_SCOPE("load");
 
-    if ((NULL == p_file_path) || (NULL == ppp_lines) || (NULL == p_line_count))
+    if (NULL == p_main_args)
     {
         printf("ERROR: NULL pointer passed to load_input\n");
-        *ppp_lines    = NULL;
-        *p_line_count = 0;
         goto EXIT;
     }
 
-    char ** pp_lines = malloc(sizeof(char *) * capacity); // Must be later freed
-    if (NULL == pp_lines)
+    if (AOC_SUCCESS != aoc_input_open(p_main_args->p_file_path, &p_main_args->input))
     {
-        printf("ERROR: Unable to allocate memory for lines\n");
-        *ppp_lines    = NULL;
-        *p_line_count = 0;
         goto EXIT;
     }
 
-    char buffer[MAX_LINE_LENGTH];
+    b_retval = true;
+EXIT:
+    return b_retval;
+}
 
-    FILE * p_file = fopen(p_file_path, "r");
-    if (NULL == p_file)
+/**
+ * @brief Points the rotations at the int32 array of a snapshot, without
+ * copying or parsing anything
+ *
+ * @param p_main_args Pointer to the main arguments structure with an open
+ * snapshot input; the rotations stay valid until the input is closed
+ *
+ * @return true on success, false on failure
+ */
+bool chal1_load_snapshot (main_args_t * p_main_args)
+{
+    bool       b_retval = false;
+    aoc_snap_t snap     = { 0 };
+
+    if (NULL == p_main_args)
     {
-        printf("ERROR: Unable to open file %s\n", p_file_path);
-        *ppp_lines    = NULL;
-        *p_line_count = 0;
-        free(pp_lines);
+        printf("ERROR: NULL pointer passed to load_snapshot\n");
         goto EXIT;
     }
 
-    while (NULL != fgets(buffer, MAX_LINE_LENGTH, p_file))
+    if (AOC_SUCCESS != aoc_snap_open(&p_main_args->input, DAY_NUMBER, &snap))
     {
-        if (line_count >= capacity)
+        goto EXIT;
+    }
+
+    if ((INT_MAX < snap.count) || (snap.count * sizeof(int32_t) != snap.size))
+    {
+        printf("ERROR: Snapshot does not hold %llu rotations\n",
+               (unsigned long long)snap.count);
+        goto EXIT;
+    }
+
+    // The solvers only read the rotations, so the read-only map will do
+    p_main_args->p_rotations    = (int *)snap.p_payload;
+    p_main_args->rotation_count = (int)snap.count;
+
+    b_retval = true;
+EXIT:
+    return b_retval;
+}
+
+/**
+ * @brief Parses the input and writes its rotations as a snapshot (-s)
+ *
+ * @param p_main_args Pointer to the main arguments structure
+ * @param p_snap_path Snapshot file to write
+ *
+ * @return true on success, false on failure
+ */
+bool chal1_write_snapshot (main_args_t * p_main_args, const char * p_snap_path)
+{
+    bool b_retval = false;
+
+    if ((false == chal1_load_input(p_main_args))
+        || (false == chal1_parse_input(p_main_args)))
+    {
+        printf("ERROR: Unable to load input file\n");
+        goto EXIT;
+    }
+
+    if (AOC_SUCCESS
+        != aoc_snap_write(p_snap_path,
+                          DAY_NUMBER,
+                          (uint64_t)p_main_args->rotation_count,
+                          0,
+                          p_main_args->p_rotations,
+                          sizeof(int32_t) * p_main_args->rotation_count))
+    {
+        goto EXIT;
+    }
+
+    printf("Wrote %d rotations to %s\n",
+           p_main_args->rotation_count,
+           p_snap_path);
+    b_retval = true;
+EXIT:
+    return b_retval;
+}
+
+/**
+ * @brief Parses every non-blank line of the input into signed rotation steps
+ *
+ * @param p_main_args Pointer to the main arguments structure with an open
+ * input; the rotations are kept in its arena
+ *
+ * @return true on success, false on failure
+ */
+bool chal1_parse_input (main_args_t * p_main_args)
+{
+    int        capacity = INIT_CAPACITY;
+    bool       b_retval = false;
+    int *      p_temp   = NULL;
+    aoc_view_t line     = { 0 };
+
+    AOC_TRACE_SCOPE("parse");
+
+    if (NULL == p_main_args)
+    {
+        printf("ERROR: NULL pointer passed to parse_input\n");
+        goto EXIT;
+    }
+
+    // A snapshot already holds the rotations
+    if (true == aoc_snap_detect(&p_main_args->input))
+    {
+        b_retval = chal1_load_snapshot(p_main_args);
+        goto EXIT;
+    }
+
+    p_main_args->rotation_count = 0;
+    p_main_args->p_rotations
+        = aoc_arena_alloc(&p_main_args->arena, sizeof(int) * capacity);
+    if (NULL == p_main_args->p_rotations)
+    {
+        printf("ERROR: Unable to allocate memory for rotations\n");
+        goto EXIT;
+    }
+
+    while (true == aoc_input_next_line(&p_main_args->input, &line))
+    {
+        // Skip blank lines
+        if (0 == line.length)
         {
-            capacity *= REALLOC_SCALE;
-            char ** pp_temp = realloc(pp_lines, sizeof(char *) * capacity);
+            continue;
+        }
 
-            if (NULL == pp_temp)
+        if (p_main_args->rotation_count >= capacity)
+        {
+            // Grows in place while the rotations are the newest allocation
+            p_temp = aoc_arena_grow(&p_main_args->arena,
+                                    p_main_args->p_rotations,
+                                    sizeof(int) * capacity,
+                                    sizeof(int) * capacity * REALLOC_SCALE,
+                                    AOC_ARENA_ALIGN);
+            if (NULL == p_temp)
             {
-                printf("ERROR: Unable to reallocate memory for lines\n");
-                fclose(p_file);
-                free(pp_lines);
+                printf("ERROR: Unable to reallocate memory for rotations\n");
                 goto EXIT;
             }
-            pp_lines = pp_temp;
+            p_main_args->p_rotations = p_temp;
+            capacity *= REALLOC_SCALE;
         }
 
-        pp_lines[line_count] = malloc(strlen(buffer) + 1);
-        if (NULL == pp_lines[line_count])
+        if (false
+            == chal1_determine_steps(
+                line, &p_main_args->p_rotations[p_main_args->rotation_count]))
         {
-            printf("ERROR: Unable to allocate memory for line %d\n",
-                   line_count);
-            fclose(p_file);
+            printf("ERROR: Unable to determine rotation steps\n");
             goto EXIT;
         }
-
-        memcpy(pp_lines[line_count], buffer, strlen(buffer) + 1);
-        line_count++;
+        p_main_args->rotation_count++;
     }
 
-    fclose(p_file);
-    *ppp_lines    = pp_lines;
-    *p_line_count = line_count;
-    b_retval      = true;
-
+    b_retval = true;
 EXIT:
     return b_retval;
 }
 
-int main (void)
+/**
+ * @brief Turns the dial through every rotation, counting stops on 0 (part 1)
+ *
+ * @param p_main_args Pointer to the main arguments structure with parsed
+ * rotations
+ *
+ * @return true on success, false on failure
+ */
+bool chal1_solve_part1 (main_args_t * p_main_args)
 {
-    int     retcode          = 0;
-    char ** pp_lines         = NULL;
-    int     line_count       = 0;
-    int     current_position = STARTING_POINT;
-    int     password         = 0;
-    int     rotation_steps   = 0;
-    int     passes           = 0;
+    bool b_retval         = false;
+    int  current_position = STARTING_POINT;
+
+    AOC_TRACE_SCOPE("part1");
 
-    // Load input file
-    if (false == chal1_load_input(FILE_PATH, &pp_lines, &line_count))
+    if (NULL == p_main_args)
     {
-        printf("ERROR: Unable to load input file\n");
-        retcode = 1;
+        printf("ERROR: NULL pointer passed to solve_part1\n");
         goto EXIT;
     }
 
-    // Loop input array
-    for (int idx = 0; idx < line_count; idx++)
+    p_main_args->password = 0;
+
+    for (int idx = 0; idx < p_main_args->rotation_count; idx++)
     {
-        // Determine rotation steps
-        if (false == chal1_determine_steps(pp_lines[idx], &rotation_steps))
+        // Rotate dial
+        current_position += p_main_args->p_rotations[idx];
+        current_position
+            = ((current_position % (DIAL_MAX + 1)) + (DIAL_MAX + 1))
+              % (DIAL_MAX + 1);
+
+        // Test position
+        if (false == chal1_test_position(current_position, &p_main_args->password))
         {
-            printf("ERROR: Unable to determine rotation steps\n");
-            retcode = 1;
+            printf("ERROR: Unable to test position\n");
             goto EXIT;
         }
+    }
+
+    b_retval = true;
+EXIT:
+    return b_retval;
+}
+
+/**
+ * @brief Turns the dial through every rotation, counting every click that
+ * lands on 0 (part 2)
+ *
+ * @param p_main_args Pointer to the main arguments structure with parsed
+ * rotations
+ *
+ * @return true on success, false on failure
+ */
+bool chal1_solve_part2 (main_args_t * p_main_args)
+{
+    bool b_retval         = false;
+    int  current_position = STARTING_POINT;
+
+    AOC_TRACE_SCOPE("part2");
+
+    if (NULL == p_main_args)
+    {
+        printf("ERROR: NULL pointer passed to solve_part2\n");
+        goto EXIT;
+    }
+
+    p_main_args->passes = 0;
 
-        // Part 2: Count zero crossings
-        int zero_crossings
-            = chal1_count_zero_crossings(current_position, rotation_steps);
-        passes += zero_crossings;
+    for (int idx = 0; idx < p_main_args->rotation_count; idx++)
+    {
+        // Count zero crossings
+        p_main_args->passes += chal1_count_zero_crossings(
+            current_position, p_main_args->p_rotations[idx]);
 
         // Rotate dial
-        current_position += rotation_steps;
+        current_position += p_main_args->p_rotations[idx];
         current_position
             = ((current_position % (DIAL_MAX + 1)) + (DIAL_MAX + 1))
               % (DIAL_MAX + 1);
+    }
+
+    b_retval = true;
+EXIT:
+    return b_retval;
+}
+
+/**
+ * @brief Releases the rotations and the input so the phases can run again
+ *
+ * @param p_main_args Pointer to the main arguments structure
+ */
+void chal1_reset (main_args_t * p_main_args)
+{
+    aoc_arena_reset(&p_main_args->arena);
+    aoc_input_close(&p_main_args->input);
+    p_main_args->p_rotations    = NULL;
+    p_main_args->rotation_count = 0;
+}
+
+/**
+ * @brief Packs one line into its signed rotation steps (pipeline parser)
+ *
+ * @param p_ctx Unused
+ * @param line Line of the input
+ * @param p_out Where the steps are emitted
+ *
+ * @return AOC_SUCCESS on success, AOC_FAILURE on failure
+ */
+static uint8_t chal1_pipe_parse (void *           p_ctx,
+                                 aoc_view_t       line,
+                                 aoc_pipe_out_t * p_out)
+{
+    int * p_steps = aoc_pipe_emit(p_out, sizeof(int));
+
+    (void)p_ctx;
+
+    if ((NULL == p_steps) || (false == chal1_determine_steps(line, p_steps)))
+    {
+        return AOC_FAILURE;
+    }
+
+    return AOC_SUCCESS;
+}
+
+/**
+ * @brief Turns the dial through a batch of rotations for both parts at once
+ * (pipeline solver)
+ *
+ * @param p_ctx Pointer to the main arguments structure
+ * @param p_batch Signed rotation steps
+ *
+ * @return AOC_SUCCESS
+ */
+static uint8_t chal1_pipe_solve (void * p_ctx, const aoc_pipe_batch_t * p_batch)
+{
+    main_args_t * p_main_args = p_ctx;
+    const int *   p_steps     = (const int *)p_batch->p_data;
+
+    AOC_TRACE_SCOPE_ARG("batch", p_batch->count);
+
+    for (size_t idx = 0; idx < p_batch->count; idx++)
+    {
+        p_main_args->passes += chal1_count_zero_crossings(
+            p_main_args->position, p_steps[idx]);
+
+        p_main_args->position += p_steps[idx];
+        p_main_args->position
+            = ((p_main_args->position % (DIAL_MAX + 1)) + (DIAL_MAX + 1))
+              % (DIAL_MAX + 1);
+
+        chal1_test_position(p_main_args->position, &p_main_args->password);
+    }
+
+    return AOC_SUCCESS;
+}
+
+/**
+ * @brief Solves both parts while the input is still being read (-p)
+ *
+ * Reading, parsing and turning the dial run on three threads, so no
+ * rotation array or whole-file buffer is built.
+ *
+ * @param p_main_args Pointer to the main arguments structure
+ *
+ * @return true on success, false on failure
+ */
+bool chal1_solve_pipelined (main_args_t * p_main_args)
+{
+    aoc_pipe_t pipe = {
+        .p_file_path = p_main_args->p_file_path,
+        .p_delims    = LINE_DELIMS,
+        .p_parse     = chal1_pipe_parse,
+        .p_solve     = chal1_pipe_solve,
+        .p_ctx       = p_main_args,
+    };
+
+    p_main_args->position = STARTING_POINT;
+    p_main_args->password = 0;
+    p_main_args->passes   = 0;
+
+    return (AOC_SUCCESS == aoc_pipe_run(&pipe));
+}
+
+#ifndef AOC_RUNNER
+/**
+ * @brief Benchmark adapters from the phase functions to aoc_bench_fn_t
+ */
+static uint8_t chal1_bench_load (void * p_ctx)
+{
+    return (true == chal1_load_input(p_ctx)) ? AOC_SUCCESS : AOC_FAILURE;
+}
+
+static uint8_t chal1_bench_parse (void * p_ctx)
+{
+    return (true == chal1_parse_input(p_ctx)) ? AOC_SUCCESS : AOC_FAILURE;
+}
+
+static uint8_t chal1_bench_part1 (void * p_ctx)
+{
+    return (true == chal1_solve_part1(p_ctx)) ? AOC_SUCCESS : AOC_FAILURE;
+}
 
-        // Test position (part 1)
-        if (false == chal1_test_position(current_position, &password))
+static uint8_t chal1_bench_part2 (void * p_ctx)
+{
+    return (true == chal1_solve_part2(p_ctx)) ? AOC_SUCCESS : AOC_FAILURE;
+}
+
+static uint8_t chal1_bench_reset (void * p_ctx)
+{
+    chal1_reset(p_ctx);
+    return AOC_SUCCESS;
+}
+
+/**
+ * @brief Times the load, parse, part 1 and part 2 phases (-b [runs])
+ *
+ * @param p_main_args Pointer to the main arguments structure
+ * @param runs Number of timed runs
+ *
+ * @return true on success, false on failure
+ */
+static bool chal1_bench (main_args_t * p_main_args, size_t runs)
+{
+    static const aoc_bench_phase_t phases[] = {
+        { "load", chal1_bench_load },
+        { "parse", chal1_bench_parse },
+        { "part1", chal1_bench_part1 },
+        { "part2", chal1_bench_part2 },
+    };
+
+    aoc_bench_t bench = {
+        .p_name      = "chal1",
+        .p_file_path = p_main_args->p_file_path,
+        .p_phases    = phases,
+        .phase_count = sizeof(phases) / sizeof(phases[0]),
+        .p_reset     = chal1_bench_reset,
+        .p_ctx       = p_main_args,
+        .runs        = runs,
+        .warmup      = AOC_BENCH_WARMUP,
+    };
+
+    return (AOC_SUCCESS == aoc_bench_run(&bench));
+}
+#endif /* AOC_RUNNER */
+
+/**
+ * @brief Solves both parts of an input (aoc_day_fn_t, used by the runner)
+ *
+ * @param p_file_path Input file, "-" for stdin
+ * @param p_cache Result cache, NULL to bypass it
+ * @param p_result Receives the passwords
+ *
+ * @return AOC_SUCCESS on success, AOC_FAILURE on failure
+ */
+uint8_t chal1_run (const char *       p_file_path,
+                   aoc_cache_t *      p_cache,
+                   aoc_day_result_t * p_result)
+{
+    uint8_t         retcode   = AOC_FAILURE;
+    main_args_t     main_args = { 0 };
+    aoc_cache_key_t key       = { DAY_NUMBER, SOLVER_VERSION, "", 0, 0 };
+
+    main_args.p_file_path = p_file_path;
+    aoc_arena_init(&main_args.arena, 0);
+    p_result->b_cached = false;
+
+    if (false == chal1_load_input(&main_args))
+    {
+        printf("ERROR: Unable to load input file\n");
+        goto EXIT;
+    }
+
+    // Same input, same answers: skip parsing and solving
+    if (true == aoc_cache_lookup(p_cache, &key, &main_args.input, p_result))
+    {
+        retcode = AOC_SUCCESS;
+        goto EXIT;
+    }
+
+    if (false == chal1_parse_input(&main_args))
+    {
+        printf("ERROR: Unable to load input file\n");
+        goto EXIT;
+    }
+
+#ifdef DEBUG
+    aoc_arena_print(&main_args.arena, "parse");
+#endif
+
+    if ((false == chal1_solve_part1(&main_args))
+        || (false == chal1_solve_part2(&main_args)))
+    {
+        goto EXIT;
+    }
+
+    p_result->part1 = main_args.password;
+    p_result->part2 = main_args.passes;
+    retcode         = AOC_SUCCESS;
+
+    // An unwritable cache only warns, the answers stand
+    (void)aoc_cache_store(p_cache, &key, p_result);
+
+EXIT:
+    // Clean up the rotations and the input they were parsed from
+    aoc_arena_free(&main_args.arena);
+    aoc_input_close(&main_args.input);
+    return retcode;
+}
+
+// The runner (Runner/) links chal1_run and brings its own main
+#ifndef AOC_RUNNER
+int main (int argc, char ** argv)
+{
+    int              retcode    = 1;
+    bool             b_bench    = false;
+    bool             b_pipe     = false;
+    bool             b_no_cache = false;
+    size_t           runs       = 0;
+    const char *     p_snap     = NULL;
+    main_args_t      main_args  = { 0 };
+    aoc_day_result_t result     = { 0 };
+    aoc_cache_t      cache;
+    aoc_cache_t *    p_cache    = NULL;
+
+    main_args.p_file_path = FILE_PATH;
+    aoc_arena_init(&main_args.arena, 0);
+
+    if (AOC_SUCCESS
+        != aoc_bench_args(argc,
+                          argv,
+                          &b_bench,
+                          &runs,
+                          &b_pipe,
+                          &b_no_cache,
+                          &p_snap,
+                          &main_args.p_file_path))
+    {
+        goto EXIT;
+    }
+
+    if (NULL != p_snap)
+    {
+        retcode = (true == chal1_write_snapshot(&main_args, p_snap)) ? 0 : 1;
+        goto EXIT;
+    }
+
+    if (true == b_bench)
+    {
+        retcode = (true == chal1_bench(&main_args, runs)) ? 0 : 1;
+        goto EXIT;
+    }
+
+    if (true == b_pipe)
+    {
+        if (false == chal1_solve_pipelined(&main_args))
         {
-            printf("ERROR: Unable to test position\n");
-            retcode = 1;
             goto EXIT;
         }
-    }
-    // Output password
-    printf("Part 1 Password: %d\n", password);
-    printf("Part 2 Password: %d\n", passes);
-    retcode = 0;
 
-EXIT:
-    // Clean up allocated memory
-    if (pp_lines != NULL)
+        result.part1 = main_args.password;
+        result.part2 = main_args.passes;
+    }
+    else
     {
-        for (int idx = 0; idx < line_count; idx++)
+        // Without a usable cache directory, solve uncached
+        if ((false == b_no_cache) && (AOC_SUCCESS == aoc_cache_init(&cache, NULL)))
         {
-            free(pp_lines[idx]);
+            p_cache = &cache;
+        }
+
+        if (AOC_SUCCESS != chal1_run(main_args.p_file_path, p_cache, &result))
+        {
+            goto EXIT;
         }
-        free(pp_lines);
     }
+
+    // Output password
+    printf("Part 1 Password: %lld\n", (long long)result.part1);
+    printf("Part 2 Password: %lld\n", (long long)result.part2);
+    aoc_cache_report(p_cache);
+    retcode = 0;
+
+EXIT:
+    // The bench phases leave nothing behind; this covers a failed bench
+    aoc_arena_free(&main_args.arena);
+    aoc_input_close(&main_args.input);
     return retcode;
 }
+#endif /* AOC_RUNNER */
 
 /** END OF FILE **/
\ No newline at end of file
@@ -0,0 +1,289 @@
+/**
+ * @file chal1_check.c
+ *
+ * @brief Differential check of the Advent of Code 2025 Challenge 1 solvers
+ *
+ * Random rotations are run through the step-by-step reference
+ * (chal1_count_zero_crossings_ref) and compared with the solver's zero count,
+ * the phase solvers, the whole solver on the text and the pipelined solver.
+ * Usage: chal1_check [-n cases] [-S seed] [-o file]
+ *
+ * @author Mexeck88
+ *
+ * @date 18OCT26
+ */
+
+#include <unistd.h>
+
+#include "aoc_check.h"
+#include "chal1.h"
+
+#define CHECK_ROTATIONS 64   // Most rotations per case
+#define CHECK_TURNS     5    // Most full turns of a near-whole rotation
+#define CHECK_STEPS_MAX 5000 // Longest rotation, bounds the reference's cost
+
+static bool chal1_check_case (const aoc_check_case_t * p_case,
+                              char *                   p_why,
+                              size_t                   why_size);
+static void chal1_check_generate (aoc_rng_t * p_rng, aoc_check_case_t * p_case);
+static bool chal1_check_simplify (void * p_item, size_t step);
+static bool chal1_check_merge (void * p_item, const void * p_next);
+static void chal1_check_print (const aoc_check_case_t * p_case, FILE * p_out);
+
+static const aoc_check_t g_check = {
+    .p_name     = "chal1",
+    .item_size  = sizeof(int),
+    .max_items  = CHECK_ROTATIONS,
+    .p_generate = chal1_check_generate,
+    .p_check    = chal1_check_case,
+    .p_simplify = chal1_check_simplify,
+    .p_merge    = chal1_check_merge,
+    .p_print    = chal1_check_print,
+};
+
+/**
+ * @brief Draws random rotations: short ones, ones a step either side of
+ * whole turns and long ones, each way
+ *
+ * @param p_rng Seeded generator
+ * @param p_case Empty case to fill
+ */
+static void chal1_check_generate (aoc_rng_t * p_rng, aoc_check_case_t * p_case)
+{
+    int *  p_steps = p_case->p_items;
+    size_t count   = aoc_rng_below(p_rng, p_case->capacity + 1);
+    int    steps   = 0;
+
+    for (size_t idx = 0; idx < count; idx++)
+    {
+        switch (aoc_rng_below(p_rng, 3))
+        {
+            case 0:
+                steps = (int)aoc_rng_below(p_rng, (DIAL_MAX + 1) * 2);
+                break;
+
+            case 1:
+                // One step short of, on or past a whole number of turns
+                steps = (int)(aoc_rng_below(p_rng, CHECK_TURNS + 1)
+                              * (DIAL_MAX + 1));
+                steps += (int)aoc_rng_below(p_rng, 3) - 1;
+                steps = (0 > steps) ? 0 : steps;
+                break;
+
+            default:
+                steps = (int)aoc_rng_below(p_rng, CHECK_STEPS_MAX + 1);
+                break;
+        }
+
+        p_steps[idx] = (0 == aoc_rng_below(p_rng, 2)) ? steps : -steps;
+    }
+
+    p_case->count = count;
+}
+
+/**
+ * @brief Simplifies a rotation: to none, without its whole turns or one of
+ * them (which keeps where the dial stops), halved, a step shorter, or turned
+ * right instead of left
+ *
+ * @param p_item Rotation to simplify
+ * @param step Which way
+ *
+ * @return false once step is past the last way
+ */
+static bool chal1_check_simplify (void * p_item, size_t step)
+{
+    int * p_steps = p_item;
+
+    switch (step)
+    {
+        case 0:
+            *p_steps = 0;
+            break;
+
+        case 1:
+            *p_steps %= DIAL_MAX + 1;
+            break;
+
+        case 2:
+            if ((DIAL_MAX + 1) <= abs(*p_steps))
+            {
+                *p_steps += (0 > *p_steps) ? DIAL_MAX + 1 : -(DIAL_MAX + 1);
+            }
+            break;
+
+        case 3:
+            *p_steps /= 2;
+            break;
+
+        case 4:
+            *p_steps += (0 > *p_steps) ? 1 : ((0 < *p_steps) ? -1 : 0);
+            break;
+
+        case 5:
+            *p_steps = abs(*p_steps);
+            break;
+
+        default:
+            return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Folds a rotation into the one before it, which leaves the dial
+ * where both did
+ *
+ * @param p_item Rotation to extend
+ * @param p_next Rotation that follows it
+ *
+ * @return false if the two would be longer than a generated rotation
+ */
+static bool chal1_check_merge (void * p_item, const void * p_next)
+{
+    int * p_steps = p_item;
+    int   steps   = *p_steps + *(const int *)p_next;
+
+    if (CHECK_STEPS_MAX < abs(steps))
+    {
+        return false;
+    }
+
+    *p_steps = steps;
+    return true;
+}
+
+/**
+ * @brief Writes rotations as input lines
+ *
+ * @param p_case Case to write
+ * @param p_out Where to write it
+ */
+static void chal1_check_print (const aoc_check_case_t * p_case, FILE * p_out)
+{
+    const int * p_steps = p_case->p_items;
+
+    for (size_t idx = 0; idx < p_case->count; idx++)
+    {
+        fprintf(p_out,
+                "%s%d\n",
+                (0 > p_steps[idx]) ? LEFT : RIGHT,
+                abs(p_steps[idx]));
+    }
+}
+
+/**
+ * @brief Runs every solver on a case and compares it with the reference
+ *
+ * @param p_case Rotations to check
+ * @param p_why Receives the first mismatch
+ * @param why_size Size of p_why
+ *
+ * @return true if every solver agrees with the reference
+ */
+static bool chal1_check_case (const aoc_check_case_t * p_case,
+                              char *                   p_why,
+                              size_t                   why_size)
+{
+    bool             b_retval  = false;
+    const int *      p_steps   = p_case->p_items;
+    int              position  = STARTING_POINT;
+    int              zeros     = 0;
+    int              fd        = -1;
+    char             path[AOC_CHECK_PATH];
+    main_args_t      main_args = { 0 };
+    aoc_day_result_t want      = { 0 };
+    aoc_day_result_t got       = { 0 };
+
+    // Reference: every step of every rotation
+    for (size_t idx = 0; idx < p_case->count; idx++)
+    {
+        zeros = chal1_count_zero_crossings_ref(position, p_steps[idx]);
+        if (false
+            == aoc_check_equal("zero count",
+                               "of one rotation",
+                               chal1_count_zero_crossings(position,
+                                                          p_steps[idx]),
+                               zeros,
+                               p_why,
+                               why_size))
+        {
+            goto EXIT;
+        }
+
+        want.part2 += zeros;
+        position = (position + p_steps[idx]) % (DIAL_MAX + 1);
+        position = (position + DIAL_MAX + 1) % (DIAL_MAX + 1);
+        want.part1 += (DIAL_MIN == position) ? 1 : 0;
+    }
+
+    // Phase solvers on the rotations as parsed
+    main_args.p_rotations    = (int *)p_steps;
+    main_args.rotation_count = (int)p_case->count;
+
+    if ((false == chal1_solve_part1(&main_args))
+        || (false == chal1_solve_part2(&main_args)))
+    {
+        snprintf(p_why, why_size, "phase solvers failed");
+        goto EXIT;
+    }
+
+    got.part1 = main_args.password;
+    got.part2 = main_args.passes;
+    if (false
+        == aoc_check_result("phase solvers", &got, &want, p_why, why_size))
+    {
+        goto EXIT;
+    }
+
+    // Whole and pipelined solvers on the text
+    fd = aoc_check_text(&g_check, p_case, path, sizeof(path));
+    if (0 > fd)
+    {
+        snprintf(p_why, why_size, "unable to write the input");
+        goto EXIT;
+    }
+
+    if (AOC_SUCCESS != chal1_run(path, NULL, &got))
+    {
+        snprintf(p_why, why_size, "chal1_run failed");
+        goto EXIT;
+    }
+
+    if (false == aoc_check_result("chal1_run", &got, &want, p_why, why_size))
+    {
+        goto EXIT;
+    }
+
+    main_args.p_file_path = path;
+    if (false == chal1_solve_pipelined(&main_args))
+    {
+        snprintf(p_why, why_size, "pipelined solver failed");
+        goto EXIT;
+    }
+
+    got.part1 = main_args.password;
+    got.part2 = main_args.passes;
+    if (false
+        == aoc_check_result("pipelined solver", &got, &want, p_why, why_size))
+    {
+        goto EXIT;
+    }
+
+    b_retval = true;
+EXIT:
+    if (0 <= fd)
+    {
+        close(fd);
+    }
+
+    return b_retval;
+}
+
+int main (int argc, char ** argv)
+{
+    return aoc_check_main(&g_check, argc, argv);
+}
+
+/** END OF FILE **/
\ No newline at end of file
@@ -0,0 +1,205 @@
+/**
+ * @file chal2_gen.c
+ *
+ * @brief Input generator for Challenge 2: one line of comma separated
+ * start-end ID ranges
+ *
+ * Usage: chal2_gen [-n ranges | -s size] [-S seed] [-o output]
+ * [-w max_width] [-D max_digits] [-v overlap_percent]
+ *
+ * Each range start has a digit count drawn uniformly from 1 to max_digits,
+ * then a value of that many digits; the width is uniform from 0 to
+ * max_width. With -v, that percent of the ranges start inside the previous
+ * range instead. The default matches the checked-in input: 33 ranges of up
+ * to 250000 IDs with up to 10 digits.
+ *
+ * @author Mexeck88
+ *
+ * @date 18OCT26
+ */
+
+#include <stdio.h>
+#include <unistd.h>
+
+#include "aoc_gen.h"
+#include "aoc_input.h"
+
+/**
+ * @enum gen_info_t
+ * @brief Generator defaults and limits
+ */
+typedef enum gen_info_t
+{
+    DEFAULT_RANGES = 33,
+    DEFAULT_WIDTH  = 250000,
+    DEFAULT_DIGITS = 10,
+    MAX_DIGITS     = 18, // Ends stay below 10^18, well inside a long
+    PERCENT        = 100,
+    BASE_10        = 10,
+} gen_info_t;
+
+/**
+ * @struct gen_args_t
+ * @brief Generator options
+ */
+typedef struct gen_args_t
+{
+    aoc_gen_args_t common;
+    uint64_t       width;   // Largest end - start
+    uint64_t       digits;  // Largest start digit count
+    uint64_t       overlap; // Percent of ranges starting inside the last one
+} gen_args_t;
+
+/**
+ * @brief Computes a power of ten
+ *
+ * @param exponent 0 to MAX_DIGITS
+ *
+ * @return 10^exponent
+ */
+static uint64_t gen_pow10 (uint64_t exponent)
+{
+    uint64_t value = 1;
+
+    while (0 < exponent--)
+    {
+        value *= BASE_10;
+    }
+
+    return value;
+}
+
+/**
+ * @brief Parses the command line
+ *
+ * @param argc Argument count
+ * @param argv Argument vector
+ * @param p_args Options to fill in
+ *
+ * @return true on success, false on a bad command line
+ */
+static bool gen_parse_args (int argc, char ** argv, gen_args_t * p_args)
+{
+    int option = 0;
+
+    aoc_gen_args_init(&p_args->common, DEFAULT_RANGES);
+    p_args->width   = DEFAULT_WIDTH;
+    p_args->digits  = DEFAULT_DIGITS;
+    p_args->overlap = 0;
+
+    while (-1 != (option = getopt(argc, argv, AOC_GEN_OPTIONS "w:D:v:")))
+    {
+        switch (aoc_gen_option(&p_args->common, option, optarg))
+        {
+            case AOC_GEN_OPT_USED:
+                continue;
+            case AOC_GEN_OPT_BAD:
+                return false;
+            default:
+                break;
+        }
+
+        switch (option)
+        {
+            case 'w':
+                if ((false == aoc_gen_parse_size(optarg, &p_args->width))
+                    || (gen_pow10(MAX_DIGITS) <= p_args->width))
+                {
+                    printf("ERROR: Invalid width: %s\n", optarg);
+                    return false;
+                }
+                break;
+
+            case 'D':
+                if ((false == aoc_gen_parse_size(optarg, &p_args->digits))
+                    || (0 == p_args->digits) || (MAX_DIGITS < p_args->digits))
+                {
+                    printf("ERROR: Digits must be 1 to %d: %s\n",
+                           MAX_DIGITS,
+                           optarg);
+                    return false;
+                }
+                break;
+
+            case 'v':
+                if ((false == aoc_gen_parse_size(optarg, &p_args->overlap))
+                    || (PERCENT < p_args->overlap))
+                {
+                    printf("ERROR: Overlap percent must be 0 to 100: %s\n",
+                           optarg);
+                    return false;
+                }
+                break;
+
+            default:
+                printf("Usage: %s [-n ranges | -s size] [-S seed] [-o output] "
+                       "[-w max_width] [-D max_digits] [-v overlap_percent]\n",
+                       argv[0]);
+                return false;
+        }
+    }
+
+    return true;
+}
+
+int main (int argc, char ** argv)
+{
+    int          retcode = 1;
+    gen_args_t   args    = { 0 };
+    aoc_rng_t    rng     = { 0 };
+    aoc_writer_t writer  = { 0 };
+    uint64_t     ranges  = 0;
+    uint64_t     low     = 0;
+    uint64_t     start   = 0;
+    uint64_t     end     = 0;
+
+    if ((false == gen_parse_args(argc, argv, &args))
+        || (AOC_SUCCESS != aoc_writer_open(&writer, args.common.p_out)))
+    {
+        goto EXIT;
+    }
+
+    aoc_rng_seed(&rng, args.common.seed);
+
+    for (ranges = 0; true == aoc_gen_more(&args.common, &writer, ranges);
+         ranges++)
+    {
+        // A chain of overlaps only drifts upwards, so it restarts once the
+        // ends leave MAX_DIGITS
+        if ((0 < ranges) && (end < gen_pow10(MAX_DIGITS))
+            && (aoc_rng_below(&rng, PERCENT) < args.overlap))
+        {
+            start += aoc_rng_below(&rng, end - start + 1);
+        }
+        else
+        {
+            low   = gen_pow10(aoc_rng_below(&rng, args.digits));
+            start = low + aoc_rng_below(&rng, BASE_10 * low - low);
+        }
+        end = start + aoc_rng_below(&rng, args.width + 1);
+
+        if (((0 < ranges) && (AOC_SUCCESS != aoc_writer_put(&writer, ",", 1)))
+            || (AOC_SUCCESS != aoc_writer_number(&writer, start))
+            || (AOC_SUCCESS != aoc_writer_put(&writer, "-", 1))
+            || (AOC_SUCCESS != aoc_writer_number(&writer, end)))
+        {
+            goto CLEAN;
+        }
+    }
+
+    if (AOC_SUCCESS != aoc_writer_put(&writer, "\n", 1))
+    {
+        goto CLEAN;
+    }
+
+    retcode = 0;
+CLEAN:
+    if (AOC_SUCCESS != aoc_writer_close(&writer))
+    {
+        retcode = 1;
+    }
+EXIT:
+    return retcode;
+}
+
+/** END OF FILE **/
\ No newline at end of file
@@ -8,24 +8,120 @@
  * @date 02DEC25
  */
 
+#include <limits.h>
 #include <string.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdbool.h>
+#include <stdint.h>
+
+#include "aoc_arena.h"
+#include "aoc_bench.h"
+#include "aoc_cache.h"
+#include "aoc_cpu.h"
+#include "aoc_day.h"
+#include "aoc_input.h"
+#include "aoc_log.h"
+#include "aoc_pipe.h"
+#include "aoc_pool.h"
+#include "aoc_snap.h"
+#include "aoc_trace.h"
 
 #define INIT_CAPACITY   10
 #define MAX_LINE_LENGTH 100
 #define REALLOC_SCALE   2
 #define ELEMENT_MAX     20
 #define FILE_PATH       "src/input.txt"
-#define TOKEN_DELIM     ","
-#define ELEMENT_DELIM   "-"
+#define TOKEN_DELIM     ", \t\r\n"
+#define ELEMENT_DELIM   '-'
+#define DAY_NUMBER      2
+#define SOLVER_VERSION  "1" // Bump when the answers for an input change
+#define DIGITS_MAX      19 // Most digits in a positive long
+#define RULE_MAX        2  // Most distinct primes dividing up to DIGITS_MAX
+
+
+/**
+ * @struct chal2_range_t
+ * @brief Inclusive range of IDs from one element of the input
+ */
+typedef struct chal2_range_t
+{
+    long start;
+    long end;
+} chal2_range_t;
+
+/**
+ * @struct chal2_rule_t
+ * @brief Which IDs of one length a part counts, as divisibility tests
+ *
+ * An ID of L digits is a pattern of p digits repeated L / p times exactly
+ * when it is a multiple of (10^L - 1) / (10^p - 1), and only the p that are
+ * L over a prime need testing. Those divisors are odd, so divisor d divides
+ * an ID x exactly when x * inverse <= limit in 64-bit arithmetic, with
+ * inverse the inverse of d modulo 2^64 and limit UINT64_MAX / d.
+ */
+typedef struct chal2_rule_t
+{
+    uint64_t bound;             // 10^L, one past the largest ID of length L
+    int      count;             // Tests in use, 0 when no ID of length L counts
+    uint64_t inverse[RULE_MAX];
+    uint64_t limit[RULE_MAX];
+} chal2_rule_t;
+
+/**
+ * @brief Kernel summing the IDs first to first + count - 1 that pass a rule,
+ * all of which have the rule's length
+ */
+typedef uint64_t (*chal2_sum_fn_t)(uint64_t             first,
+                                   uint64_t             count,
+                                   const chal2_rule_t * p_rule);
+
+/**
+ * @struct chal2_span_t
+ * @brief Range being summed on the pool, offsets counted from start
+ */
+typedef struct chal2_span_t
+{
+    long                 start;
+    const chal2_rule_t * p_rules; // Indexed by length, DIGITS_MAX + 1 of them
+    chal2_sum_fn_t       p_sum;   // Kernel each piece of a chunk goes to
+} chal2_span_t;
+
+/**
+ * @struct main_args_t
+ * @brief Main arguments structure containing the input, its ranges and the
+ * passwords
+ */
+typedef struct main_args_t
+{
+    const char *    p_file_path;
+    aoc_input_t     input;        // Input the ranges are parsed from
+    aoc_arena_t     arena;        // Holds the array of ranges
+    chal2_range_t * p_ranges;
+    int             range_count;
+    long            password;     // Part 1
+    long            password_two; // Part 2
+} main_args_t;
 
-bool chal2_load_input (const char * p_file_path,
-                       char ***     ppp_lines,
-                       int *        p_line_count);
-bool chal2_process_element (const char * p_element, long * p_password, long * p_password_two);
+bool chal2_load_input (main_args_t * p_main_args);
+bool chal2_parse_input (main_args_t * p_main_args);
+bool chal2_parse_range (aoc_view_t element, chal2_range_t * p_range);
+bool chal2_load_snapshot (main_args_t * p_main_args);
+bool chal2_write_snapshot (main_args_t * p_main_args, const char * p_snap_path);
+bool chal2_solve_part1 (main_args_t * p_main_args);
+bool chal2_solve_part2 (main_args_t * p_main_args);
+void chal2_reset (main_args_t * p_main_args);
+bool chal2_solve_pipelined (main_args_t * p_main_args);
+uint8_t chal2_run (const char *       p_file_path,
+                   aoc_cache_t *      p_cache,
+                   aoc_day_result_t * p_result);
 bool chal2_is_value_counted (long * p_password, long element);
 bool chal2_is_value_counted_part2 (long * p_password_two, long element);
+void chal2_make_rules (chal2_rule_t * p_rules, bool b_any_repeats);
+int64_t chal2_sum_chunk (void * p_ctx, size_t begin, size_t end);
+uint64_t chal2_sum_repeats (uint64_t             first,
+                            uint64_t             count,
+                            const chal2_rule_t * p_rule);
+chal2_sum_fn_t chal2_sum_variant (aoc_cpu_level_t level);
 
 /** END OF FILE **/
\ No newline at end of file
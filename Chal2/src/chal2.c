@@ -10,127 +10,185 @@
 
 #include "chal2.h"
 
+// Ranges are snapshotted as pairs of 64-bit IDs and solved in place
+_Static_assert(sizeof(chal2_range_t) == 2 * sizeof(uint64_t),
+               "ranges are two 64-bit IDs");
+
 /**
- * @brief Loads the input file and stores each element in an array
+ * @brief Opens (maps) the input file
  *
- * @param p_file_path Path to the input file
- * @param ppp_lines Pointer to an array of strings to store the lines
- * @param p_line_count Pointer to an integer to store the number of elements
+ * @param p_main_args Pointer to the main arguments structure
  *
  * @return true on success, false on failure
  */
-bool chal2_load_input (const char * p_file_path,
-                       char ***     ppp_lines,
-                       int *        p_line_count)
+bool chal2_load_input (main_args_t * p_main_args)
 {
-    int  capacity   = INIT_CAPACITY;
-    int  line_count = 0;
-    bool b_retval   = false;
+    bool b_retval = false;
+
+    AOC_TRACE_SCOPE("load");
 
-    if ((NULL == p_file_path) || (NULL == ppp_lines) || (NULL == p_line_count))
+    if (NULL == p_main_args)
     {
         printf("ERROR: NULL pointer passed to load_input\n");
         goto EXIT;
     }
 
-    char ** pp_lines = malloc(sizeof(char *) * capacity); // Must be later freed
-    if (NULL == pp_lines)
+    if (AOC_SUCCESS != aoc_input_open(p_main_args->p_file_path, &p_main_args->input))
     {
-        printf("ERROR: Unable to allocate memory for lines\n");
-        *ppp_lines    = NULL;
-        *p_line_count = 0;
         goto EXIT;
     }
 
-    FILE * p_file = fopen(p_file_path, "r");
-    if (NULL == p_file)
+    b_retval = true;
+EXIT:
+    return b_retval;
+}
+
+/**
+ * @brief Points the ranges at the (start, end) pairs of a snapshot, without
+ * copying or parsing anything
+ *
+ * @param p_main_args Pointer to the main arguments structure with an open
+ * snapshot input; the ranges stay valid until the input is closed
+ *
+ * @return true on success, false on failure
+ */
+bool chal2_load_snapshot (main_args_t * p_main_args)
+{
+    bool       b_retval = false;
+    aoc_snap_t snap     = { 0 };
+
+    if (NULL == p_main_args)
     {
-        printf("ERROR: Unable to open file %s\n", p_file_path);
-        *ppp_lines    = NULL;
-        *p_line_count = 0;
-        free(pp_lines);
+        printf("ERROR: NULL pointer passed to load_snapshot\n");
         goto EXIT;
     }
 
-    fseek(p_file, 0, SEEK_END);
-    long file_size = ftell(p_file);
-    fseek(p_file, 0, SEEK_SET);
+    if (AOC_SUCCESS != aoc_snap_open(&p_main_args->input, DAY_NUMBER, &snap))
+    {
+        goto EXIT;
+    }
 
-    char * p_file_buffer = malloc(file_size + 1);
-    if (NULL == p_file_buffer)
+    if ((INT_MAX < snap.count)
+        || (snap.count * sizeof(chal2_range_t) != snap.size))
     {
-        printf("ERROR: Unable to allocate memory for file\n");
-        fclose(p_file);
-        free(pp_lines);
+        printf("ERROR: Snapshot does not hold %llu ranges\n",
+               (unsigned long long)snap.count);
         goto EXIT;
     }
 
-    fread(p_file_buffer, 1, file_size, p_file);
-    p_file_buffer[file_size] = '\0';
-    fclose(p_file);
+    // The solvers only read the ranges, so the read-only map will do
+    p_main_args->p_ranges    = (chal2_range_t *)snap.p_payload;
+    p_main_args->range_count = (int)snap.count;
+
+    b_retval = true;
+EXIT:
+    return b_retval;
+}
 
-    // Make copy for strtok
-    char * p_file_buffer_copy = malloc(file_size + 1);
-    if (NULL == p_file_buffer_copy)
+/**
+ * @brief Parses the input and writes its ranges as a snapshot (-s)
+ *
+ * @param p_main_args Pointer to the main arguments structure
+ * @param p_snap_path Snapshot file to write
+ *
+ * @return true on success, false on failure
+ */
+bool chal2_write_snapshot (main_args_t * p_main_args, const char * p_snap_path)
+{
+    bool b_retval = false;
+
+    if ((false == chal2_load_input(p_main_args))
+        || (false == chal2_parse_input(p_main_args)))
     {
-        printf("ERROR: Unable to allocate memory for file copy\n");
-        free(p_file_buffer);
-        free(pp_lines);
+        printf("ERROR: Unable to load input file\n");
         goto EXIT;
     }
 
-    strncpy(p_file_buffer_copy, p_file_buffer, file_size + 1);
-
-    char * p_token = strtok(p_file_buffer_copy, TOKEN_DELIM);
-    while (NULL != p_token)
+    if (AOC_SUCCESS
+        != aoc_snap_write(p_snap_path,
+                          DAY_NUMBER,
+                          (uint64_t)p_main_args->range_count,
+                          0,
+                          p_main_args->p_ranges,
+                          sizeof(chal2_range_t) * p_main_args->range_count))
     {
-        if (line_count >= capacity)
-        {
-            capacity *= REALLOC_SCALE;
-            char ** pp_temp = realloc(pp_lines, sizeof(char *) * capacity);
+        goto EXIT;
+    }
 
-            if (NULL == pp_temp)
-            {
-                printf("ERROR: Unable to reallocate memory for lines\n");
-                free(pp_lines);
-                free(p_file_buffer_copy);
-                free(p_file_buffer);
-                goto EXIT;
-            }
-            pp_lines = pp_temp;
-        }
+    printf("Wrote %d ranges to %s\n", p_main_args->range_count, p_snap_path);
+    b_retval = true;
+EXIT:
+    return b_retval;
+}
 
-        pp_lines[line_count] = malloc(strlen(p_token) + 1);
-        if (NULL == pp_lines[line_count])
-        {
-            printf("ERROR: Unable to allocate memory for line %d\n",
-                   line_count);
-            free(p_file_buffer_copy);
-            free(p_file_buffer);
-            goto CLEAN;
-        }
+/**
+ * @brief Parses every element of the input into a range of IDs
+ *
+ * @param p_main_args Pointer to the main arguments structure with an open
+ * input; the ranges are kept in its arena
+ *
+ * @return true on success, false on failure
+ */
+bool chal2_parse_input (main_args_t * p_main_args)
+{
+    int             capacity = INIT_CAPACITY;
+    bool            b_retval = false;
+    chal2_range_t * p_temp   = NULL;
+    aoc_view_t      token    = { 0 };
+
+    AOC_TRACE_SCOPE("parse");
+
+    if (NULL == p_main_args)
+    {
+        printf("ERROR: NULL pointer passed to parse_input\n");
+        goto EXIT;
+    }
 
-        strncpy(pp_lines[line_count], p_token, strlen(p_token) + 1);
-        line_count++;
-        p_token = strtok(NULL, TOKEN_DELIM);
+    // A snapshot already holds the ranges
+    if (true == aoc_snap_detect(&p_main_args->input))
+    {
+        b_retval = chal2_load_snapshot(p_main_args);
+        goto EXIT;
     }
 
-    free(p_file_buffer_copy);
-    free(p_file_buffer);
-    *ppp_lines    = pp_lines;
-    *p_line_count = line_count;
-    b_retval      = true;
+    p_main_args->range_count = 0;
+    p_main_args->p_ranges
+        = aoc_arena_alloc(&p_main_args->arena, sizeof(chal2_range_t) * capacity);
+    if (NULL == p_main_args->p_ranges)
+    {
+        printf("ERROR: Unable to allocate memory for ranges\n");
+        goto EXIT;
+    }
 
-CLEAN:
-    if (false == b_retval)
+    while (true == aoc_input_next_token(&p_main_args->input, TOKEN_DELIM, &token))
     {
-        for (int idx = 0; idx < line_count; idx++)
+        if (p_main_args->range_count >= capacity)
         {
-            free(pp_lines[idx]);
+            // Grows in place while the ranges are the newest allocation
+            p_temp = aoc_arena_grow(&p_main_args->arena,
+                                    p_main_args->p_ranges,
+                                    sizeof(chal2_range_t) * capacity,
+                                    sizeof(chal2_range_t) * capacity * REALLOC_SCALE,
+                                    AOC_ARENA_ALIGN);
+            if (NULL == p_temp)
+            {
+                printf("ERROR: Unable to reallocate memory for ranges\n");
+                goto EXIT;
+            }
+            p_main_args->p_ranges = p_temp;
+            capacity *= REALLOC_SCALE;
         }
-        free(pp_lines);
+
+        if (false
+            == chal2_parse_range(
+                token, &p_main_args->p_ranges[p_main_args->range_count]))
+        {
+            goto EXIT;
+        }
+        p_main_args->range_count++;
     }
 
+    b_retval = true;
 EXIT:
     return b_retval;
 }
@@ -179,7 +237,7 @@ bool chal2_is_value_counted (long * p_password, long element)
 
     if (true == b_matches)
     {
-        printf("Adding element to password (part 1): %ld\n", element);
+        AOC_LOG_TRACE("Adding element to password (part 1): %ld", element);
         *p_password += element;
     }
 
@@ -246,7 +304,7 @@ bool chal2_is_value_counted_part2 (long * p_password_two, long element)
 
     if (true == b_matches)
     {
-        printf("Adding element to password (part 2): %ld\n", element);
+        AOC_LOG_TRACE("Adding element to password (part 2): %ld", element);
         *p_password_two += element;
     }
 
@@ -257,64 +315,240 @@ EXIT:
 }
 
 /**
- * @brief Processes a single element from the input (loop through its digits)
+ * @brief Parses a single element from the input into its range of IDs
  *
- * @param p_element The element string to process
- * @param p_password Pointer to the current password value (to be passed into
- * chal2_is_value_counted)
- * @param p_password_two Pointer to the current password value for part 2
+ * @param element The element to parse ("start-end")
+ * @param p_range Pointer to the range to fill in
  *
  * @return true if the function succeeded, false otherwise
  */
-bool chal2_process_element (const char * p_element,
-                            long *       p_password,
-                            long *       p_password_two)
+bool chal2_parse_range (aoc_view_t element, chal2_range_t * p_range)
 {
-    bool b_retval = false;
+    bool         b_retval  = false;
+    const char * p_delim   = NULL;
+    aoc_view_t   start_str = { 0 };
+    aoc_view_t   end_str   = { 0 };
 
     // Null pointer check
-    if ((NULL == p_element) || (NULL == p_password))
+    if ((NULL == element.p_data) || (NULL == p_range))
     {
-        printf("ERROR: NULL pointer passed to process_element\n");
+        printf("ERROR: NULL pointer passed to parse_range\n");
         goto EXIT;
     }
 
-    // Delim p_element to get start and end of loop
-    char * p_element_copy = malloc(strlen(p_element) + 1);
-    if (NULL == p_element_copy)
+    // Delim element to get start and end of loop
+    p_delim = memchr(element.p_data, ELEMENT_DELIM, element.length);
+    if (NULL == p_delim)
     {
-        printf("ERROR: Unable to allocate memory for element copy\n");
+        printf("ERROR: Missing range delimiter in element: %.*s\n",
+               (int)element.length,
+               element.p_data);
         goto EXIT;
     }
 
-    strncpy(p_element_copy, p_element, strlen(p_element) + 1);
-    char * p_start_str = strtok(p_element_copy, ELEMENT_DELIM);
-    char * p_end_str   = strtok(NULL, ELEMENT_DELIM);
+    start_str.p_data = element.p_data;
+    start_str.length = (size_t)(p_delim - element.p_data);
+    end_str.p_data   = p_delim + 1;
+    end_str.length   = element.length - start_str.length - 1;
 
-    long start = atol(p_start_str);
-    long end   = atol(p_end_str);
+    if ((false == aoc_view_parse_long(start_str, &p_range->start))
+        || (false == aoc_view_parse_long(end_str, &p_range->end)))
+    {
+        printf("ERROR: Unable to parse range in element: %.*s\n",
+               (int)element.length,
+               element.p_data);
+        goto EXIT;
+    }
+
+    AOC_LOG_TRACE("Processing range: %ld-%ld", p_range->start, p_range->end);
+
+    b_retval = true;
+
+EXIT:
+    return b_retval;
+}
+
+/**
+ * @brief Builds the divisibility tests of a part for every ID length
+ *
+ * @param p_rules DIGITS_MAX + 1 rules, indexed by length
+ * @param b_any_repeats false for part 1 (a pattern repeated twice), true for
+ * part 2 (repeated at least twice)
+ */
+void chal2_make_rules (chal2_rule_t * p_rules, bool b_any_repeats)
+{
+    static const int primes[] = { 2, 3, 5, 7, 11, 13, 17, 19 };
+
+    uint64_t pow10[DIGITS_MAX + 1] = { 1 };
+
+    for (int length = 1; length <= DIGITS_MAX; length++)
+    {
+        pow10[length] = pow10[length - 1] * 10;
+    }
 
-    printf("Processing element: %s (from %ld to %ld)\n", p_element, start, end);
+    memset(p_rules, 0, (DIGITS_MAX + 1) * sizeof(chal2_rule_t));
 
-    // Loop from start to end
-    for (long idx = start; idx <= end; idx++)
+    for (int length = 1; length <= DIGITS_MAX; length++)
     {
-        if (false == chal2_is_value_counted(p_password, idx))
+        chal2_rule_t * p_rule = &p_rules[length];
+
+        p_rule->bound = pow10[length];
+
+        for (size_t prime = 0; prime < sizeof(primes) / sizeof(primes[0]); prime++)
         {
-            printf("ERROR: Unable to check if value is counted: %ld\n", idx);
-            free(p_element_copy);
-            goto EXIT;
+            // Part 1 only repeats a pattern twice
+            if ((0 != length % primes[prime])
+                || ((false == b_any_repeats) && (2 != primes[prime])))
+            {
+                continue;
+            }
+
+            uint64_t divisor
+                = (pow10[length] - 1) / (pow10[length / primes[prime]] - 1);
+            uint64_t inverse = divisor;
+
+            // Newton's iteration doubles the correct low bits each step
+            for (int step = 0; step < 5; step++)
+            {
+                inverse *= 2 - (divisor * inverse);
+            }
+
+            p_rule->inverse[p_rule->count] = inverse;
+            p_rule->limit[p_rule->count]   = UINT64_MAX / divisor;
+            p_rule->count++;
         }
+    }
+}
+
+/**
+ * @brief Adds up the counted IDs of one chunk of a range (pool reduction)
+ *
+ * The chunk is cut where the IDs gain a digit, and each piece goes to the
+ * span's kernel with the rule for its length.
+ *
+ * @param p_ctx Pointer to the chal2_span_t being summed
+ * @param begin Offset of the first ID from the start of the range
+ * @param end Offset one past the last ID
+ *
+ * @return Sum of the counted IDs
+ */
+int64_t chal2_sum_chunk (void * p_ctx, size_t begin, size_t end)
+{
+    const chal2_span_t * p_span = p_ctx;
+    uint64_t             sum    = 0;
+    uint64_t             id     = (uint64_t)p_span->start + begin;
+    uint64_t             count  = end - begin;
+    int                  length = 1;
 
-        if (false == chal2_is_value_counted_part2(p_password_two, idx))
+    AOC_TRACE_SCOPE_ARG("chunk", end - begin);
+
+    // Zero and negative IDs never count: their '-' cannot repeat
+    if (0 >= (long)id)
+    {
+        uint64_t skipped = 1 - id;
+
+        if (count <= skipped)
         {
-            printf("ERROR: Unable to check if value is counted (part 2): %ld\n", idx);
-            free(p_element_copy);
-            goto EXIT;
+            return 0;
+        }
+
+        id = 1;
+        count -= skipped;
+    }
+
+    while (0 < count)
+    {
+        while (id >= p_span->p_rules[length].bound)
+        {
+            length++;
         }
+
+        uint64_t piece = p_span->p_rules[length].bound - id;
+
+        if (piece > count)
+        {
+            piece = count;
+        }
+
+        if (0 < p_span->p_rules[length].count)
+        {
+            sum += p_span->p_sum(id, piece, &p_span->p_rules[length]);
+        }
+
+        id += piece;
+        count -= piece;
+    }
+
+    return (int64_t)sum;
+}
+
+/**
+ * @brief Adds up the counted IDs of every range on the shared pool
+ *
+ * Each range is split into chunks of IDs that the pool's workers check in
+ * parallel, so one huge range keeps every core busy.
+ *
+ * @param p_main_args Pointer to the main arguments structure with parsed
+ * ranges
+ * @param b_any_repeats false for part 1, true for part 2
+ *
+ * @return Sum of the counted IDs
+ */
+static long chal2_sum_ranges (main_args_t * p_main_args, bool b_any_repeats)
+{
+    chal2_rule_t rules[DIGITS_MAX + 1];
+    chal2_span_t span = { 0, rules, chal2_sum_repeats };
+    long         sum  = 0;
+
+    chal2_make_rules(rules, b_any_repeats);
+
+    for (int range = 0; range < p_main_args->range_count; range++)
+    {
+        AOC_TRACE_SCOPE_ARG("range", range);
+
+        if (p_main_args->p_ranges[range].end < p_main_args->p_ranges[range].start)
+        {
+            continue;
+        }
+
+        span.start = p_main_args->p_ranges[range].start;
+        sum += aoc_pool_reduce(aoc_pool_shared(),
+                               0,
+                               (size_t)(p_main_args->p_ranges[range].end
+                                        - span.start)
+                                   + 1,
+                               0,
+                               chal2_sum_chunk,
+                               aoc_pool_add,
+                               0,
+                               &span);
+    }
+
+    return sum;
+}
+
+/**
+ * @brief Adds up the IDs made of a pattern repeated twice (part 1)
+ *
+ * @param p_main_args Pointer to the main arguments structure with parsed
+ * ranges
+ *
+ * @return true if the function succeeded, false otherwise
+ */
+bool chal2_solve_part1 (main_args_t * p_main_args)
+{
+    bool b_retval = false;
+
+    AOC_TRACE_SCOPE("part1");
+
+    if (NULL == p_main_args)
+    {
+        printf("ERROR: NULL pointer passed to solve_part1\n");
+        goto EXIT;
     }
 
-    free(p_element_copy);
+    p_main_args->password = chal2_sum_ranges(p_main_args, false);
+
     b_retval = true;
 
 EXIT:
@@ -322,56 +556,347 @@ EXIT:
 }
 
 /**
- * @brief Main function for Advent of Code 2025 Challenge 2
+ * @brief Adds up the IDs made of a pattern repeated at least twice (part 2)
  *
- * @return int Exit code
+ * @param p_main_args Pointer to the main arguments structure with parsed
+ * ranges
+ *
+ * @return true if the function succeeded, false otherwise
  */
-int main (void)
+bool chal2_solve_part2 (main_args_t * p_main_args)
 {
-    int     retcode      = 1;
-    long    password     = 0;
-    long    password_two = 0;
-    char ** pp_lines     = NULL;
-    int     line_count   = 0;
+    bool b_retval = false;
 
-    if (false == chal2_load_input(FILE_PATH, &pp_lines, &line_count))
+    AOC_TRACE_SCOPE("part2");
+
+    if (NULL == p_main_args)
     {
-        printf("ERROR: Unable to load input file\n");
+        printf("ERROR: NULL pointer passed to solve_part2\n");
         goto EXIT;
     }
 
-    // Call processing function on each element (part 1)
-    for (int idx = 0; idx < line_count; idx++)
+    p_main_args->password_two
+        = chal2_sum_ranges(p_main_args, true);
+
+    b_retval = true;
+
+EXIT:
+    return b_retval;
+}
+
+/**
+ * @brief Releases the ranges and the input so the phases can run again
+ *
+ * @param p_main_args Pointer to the main arguments structure
+ */
+void chal2_reset (main_args_t * p_main_args)
+{
+    aoc_arena_reset(&p_main_args->arena);
+    aoc_input_close(&p_main_args->input);
+    p_main_args->p_ranges    = NULL;
+    p_main_args->range_count = 0;
+}
+
+/**
+ * @brief Packs one element into its range of IDs (pipeline parser)
+ *
+ * @param p_ctx Unused
+ * @param element Element of the input ("start-end")
+ * @param p_out Where the range is emitted
+ *
+ * @return AOC_SUCCESS on success, AOC_FAILURE on failure
+ */
+static uint8_t chal2_pipe_parse (void *           p_ctx,
+                                 aoc_view_t       element,
+                                 aoc_pipe_out_t * p_out)
+{
+    chal2_range_t * p_range = aoc_pipe_emit(p_out, sizeof(chal2_range_t));
+
+    (void)p_ctx;
+
+    if ((NULL == p_range) || (false == chal2_parse_range(element, p_range)))
+    {
+        return AOC_FAILURE;
+    }
+
+    return AOC_SUCCESS;
+}
+
+/**
+ * @brief Checks every ID of a batch of ranges for both parts (pipeline
+ * solver)
+ *
+ * @param p_ctx Pointer to the main arguments structure
+ * @param p_batch Ranges of IDs
+ *
+ * @return AOC_SUCCESS on success, AOC_FAILURE on failure
+ */
+static uint8_t chal2_pipe_solve (void * p_ctx, const aoc_pipe_batch_t * p_batch)
+{
+    main_args_t *         p_main_args = p_ctx;
+    const chal2_range_t * p_ranges    = (const chal2_range_t *)p_batch->p_data;
+
+    AOC_TRACE_SCOPE_ARG("batch", p_batch->count);
+
+    for (size_t range = 0; range < p_batch->count; range++)
     {
-        if (false
-            == chal2_process_element(pp_lines[idx], &password, &password_two))
+        for (long idx = p_ranges[range].start; idx <= p_ranges[range].end;
+             idx++)
         {
-            printf("ERROR: Unable to process element: %s\n", pp_lines[idx]);
-            goto CLEAN;
+            if ((false == chal2_is_value_counted(&p_main_args->password, idx))
+                || (false
+                    == chal2_is_value_counted_part2(&p_main_args->password_two,
+                                                    idx)))
+            {
+                printf("ERROR: Unable to check if value is counted: %ld\n", idx);
+                return AOC_FAILURE;
+            }
         }
     }
 
-    printf("Password Part 1: %ld\n", password);
-    printf("Password Part 2: %ld\n", password_two);
-    retcode = 0;
+    return AOC_SUCCESS;
+}
+
+/**
+ * @brief Solves both parts while the input is still being read (-p)
+ *
+ * Reading, parsing and checking IDs run on three threads, so no range array
+ * or whole-file buffer is built.
+ *
+ * @param p_main_args Pointer to the main arguments structure
+ *
+ * @return true on success, false on failure
+ */
+bool chal2_solve_pipelined (main_args_t * p_main_args)
+{
+    aoc_pipe_t pipe = {
+        .p_file_path = p_main_args->p_file_path,
+        .p_delims    = TOKEN_DELIM,
+        .p_parse     = chal2_pipe_parse,
+        .p_solve     = chal2_pipe_solve,
+        .p_ctx       = p_main_args,
+    };
+
+    p_main_args->password     = 0;
+    p_main_args->password_two = 0;
+
+    return (AOC_SUCCESS == aoc_pipe_run(&pipe));
+}
+
+#ifndef AOC_RUNNER
+/**
+ * @brief Benchmark adapters from the phase functions to aoc_bench_fn_t
+ */
+static uint8_t chal2_bench_load (void * p_ctx)
+{
+    return (true == chal2_load_input(p_ctx)) ? AOC_SUCCESS : AOC_FAILURE;
+}
+
+static uint8_t chal2_bench_parse (void * p_ctx)
+{
+    return (true == chal2_parse_input(p_ctx)) ? AOC_SUCCESS : AOC_FAILURE;
+}
+
+static uint8_t chal2_bench_part1 (void * p_ctx)
+{
+    return (true == chal2_solve_part1(p_ctx)) ? AOC_SUCCESS : AOC_FAILURE;
+}
+
+static uint8_t chal2_bench_part2 (void * p_ctx)
+{
+    return (true == chal2_solve_part2(p_ctx)) ? AOC_SUCCESS : AOC_FAILURE;
+}
+
+static uint8_t chal2_bench_reset (void * p_ctx)
+{
+    chal2_reset(p_ctx);
+    return AOC_SUCCESS;
+}
+
+/**
+ * @brief Times the load, parse, part 1 and part 2 phases (-b [runs])
+ *
+ * @param p_main_args Pointer to the main arguments structure
+ * @param runs Number of timed runs
+ *
+ * @return true on success, false on failure
+ */
+static bool chal2_bench (main_args_t * p_main_args, size_t runs)
+{
+    static const aoc_bench_phase_t phases[] = {
+        { "load", chal2_bench_load },
+        { "parse", chal2_bench_parse },
+        { "part1", chal2_bench_part1 },
+        { "part2", chal2_bench_part2 },
+    };
+
+    aoc_bench_t bench = {
+        .p_name      = "chal2",
+        .p_file_path = p_main_args->p_file_path,
+        .p_phases    = phases,
+        .phase_count = sizeof(phases) / sizeof(phases[0]),
+        .p_reset     = chal2_bench_reset,
+        .p_ctx       = p_main_args,
+        .runs        = runs,
+        .warmup      = AOC_BENCH_WARMUP,
+    };
+
+    return (AOC_SUCCESS == aoc_bench_run(&bench));
+}
+#endif /* AOC_RUNNER */
+
+/**
+ * @brief Solves both parts of an input (aoc_day_fn_t, used by the runner)
+ *
+ * @param p_file_path Input file, "-" for stdin
+ * @param p_cache Result cache, NULL to bypass it
+ * @param p_result Receives the passwords
+ *
+ * @return AOC_SUCCESS on success, AOC_FAILURE on failure
+ */
+uint8_t chal2_run (const char *       p_file_path,
+                   aoc_cache_t *      p_cache,
+                   aoc_day_result_t * p_result)
+{
+    uint8_t         retcode   = AOC_FAILURE;
+    main_args_t     main_args = { 0 };
+    aoc_cache_key_t key       = { DAY_NUMBER, SOLVER_VERSION, "", 0, 0 };
+
+    main_args.p_file_path = p_file_path;
+    aoc_arena_init(&main_args.arena, 0);
+    p_result->b_cached = false;
+
+    if (false == chal2_load_input(&main_args))
+    {
+        printf("ERROR: Unable to load input file\n");
+        goto CLEAN;
+    }
+
+    // Same input, same answers: skip parsing and solving
+    if (true == aoc_cache_lookup(p_cache, &key, &main_args.input, p_result))
+    {
+        retcode = AOC_SUCCESS;
+        goto CLEAN;
+    }
+
+    if (false == chal2_parse_input(&main_args))
+    {
+        printf("ERROR: Unable to load input file\n");
+        goto CLEAN;
+    }
+
+#ifdef DEBUG
+    aoc_arena_print(&main_args.arena, "parse");
+#endif
+
+    if ((false == chal2_solve_part1(&main_args))
+        || (false == chal2_solve_part2(&main_args)))
+    {
+        goto CLEAN;
+    }
+
+    p_result->part1 = main_args.password;
+    p_result->part2 = main_args.password_two;
+    retcode         = AOC_SUCCESS;
+
+    // An unwritable cache only warns, the answers stand
+    (void)aoc_cache_store(p_cache, &key, p_result);
 
 CLEAN:
-    // To clean up pp_lines elements
-    for (int idx = 0; idx < line_count; idx++)
+    // Ranges were parsed from the input, release both together
+    aoc_arena_free(&main_args.arena);
+    aoc_input_close(&main_args.input);
+
+    return retcode;
+}
+
+// The runner (Runner/) links chal2_run and brings its own main
+#ifndef AOC_RUNNER
+/**
+ * @brief Main function for Advent of Code 2025 Challenge 2
+ *
+ * @param argc Argument count
+ * @param argv Argument vector
+ *
+ * @return int Exit code
+ */
+int main (int argc, char ** argv)
+{
+    int              retcode    = 1;
+    bool             b_bench    = false;
+    bool             b_pipe     = false;
+    bool             b_no_cache = false;
+    size_t           runs       = 0;
+    const char *     p_snap     = NULL;
+    main_args_t      main_args  = { 0 };
+    aoc_day_result_t result     = { 0 };
+    aoc_cache_t      cache;
+    aoc_cache_t *    p_cache    = NULL;
+
+    main_args.p_file_path = FILE_PATH;
+    aoc_arena_init(&main_args.arena, 0);
+
+    if (AOC_SUCCESS
+        != aoc_bench_args(argc,
+                          argv,
+                          &b_bench,
+                          &runs,
+                          &b_pipe,
+                          &b_no_cache,
+                          &p_snap,
+                          &main_args.p_file_path))
     {
-        if (NULL != pp_lines[idx])
+        goto CLEAN;
+    }
+
+    if (NULL != p_snap)
+    {
+        retcode = (true == chal2_write_snapshot(&main_args, p_snap)) ? 0 : 1;
+        goto CLEAN;
+    }
+
+    if (true == b_bench)
+    {
+        retcode = (true == chal2_bench(&main_args, runs)) ? 0 : 1;
+        goto CLEAN;
+    }
+
+    if (true == b_pipe)
+    {
+        if (false == chal2_solve_pipelined(&main_args))
         {
-            free(pp_lines[idx]);
+            goto CLEAN;
         }
-    }
 
-    if (NULL != pp_lines)
+        result.part1 = main_args.password;
+        result.part2 = main_args.password_two;
+    }
+    else
     {
-        free(pp_lines);
+        // Without a usable cache directory, solve uncached
+        if ((false == b_no_cache) && (AOC_SUCCESS == aoc_cache_init(&cache, NULL)))
+        {
+            p_cache = &cache;
+        }
+
+        if (AOC_SUCCESS != chal2_run(main_args.p_file_path, p_cache, &result))
+        {
+            goto CLEAN;
+        }
     }
 
-EXIT:
+    printf("Password Part 1: %lld\n", (long long)result.part1);
+    printf("Password Part 2: %lld\n", (long long)result.part2);
+    aoc_cache_report(p_cache);
+    retcode = 0;
+
+CLEAN:
+    // The bench phases leave nothing behind; this covers a failed bench
+    aoc_arena_free(&main_args.arena);
+    aoc_input_close(&main_args.input);
+
     return retcode;
 }
+#endif /* AOC_RUNNER */
 
 /** END OF FILE **/
\ No newline at end of file
@@ -0,0 +1,272 @@
+/**
+ * @file chal2_simd.c
+ *
+ * @brief Advent of Code 2025 Challenge 2 repeated-pattern kernels, one per
+ * CPU level
+ *
+ * Every variant walks a run of consecutive IDs keeping x * inverse for each
+ * test of the rule; consecutive IDs just add inverse to it, so the scan is
+ * adds and unsigned compares with no multiply or division per ID. The
+ * vector variants do 2, 4 or 8 IDs per step and leave the tail to the
+ * scalar one. The variant is bound once at startup from aoc_cpu_level.
+ *
+ * @author Mexeck88
+ *
+ * @date 18OCT26
+ */
+
+#include "chal2.h"
+
+#if AOC_CPU_X86
+#include <immintrin.h>
+#endif
+
+/**
+ * @brief Plain C kernel, also the tail of the vector ones
+ *
+ * @param first First ID
+ * @param count Number of consecutive IDs
+ * @param p_rule Tests for the IDs' length
+ *
+ * @return Sum of the IDs that pass a test
+ */
+static uint64_t chal2_sum_scalar (uint64_t             first,
+                                  uint64_t             count,
+                                  const chal2_rule_t * p_rule)
+{
+    uint64_t sum               = 0;
+    uint64_t product[RULE_MAX] = { 0 };
+
+    for (int test = 0; test < p_rule->count; test++)
+    {
+        product[test] = first * p_rule->inverse[test];
+    }
+
+    for (uint64_t idx = 0; idx < count; idx++)
+    {
+        bool b_counted = false;
+
+        for (int test = 0; test < p_rule->count; test++)
+        {
+            b_counted |= (product[test] <= p_rule->limit[test]);
+            product[test] += p_rule->inverse[test];
+        }
+
+        if (true == b_counted)
+        {
+            sum += first + idx;
+        }
+    }
+
+    return sum;
+}
+
+#if AOC_CPU_X86
+/**
+ * @brief SSE4.2 kernel: two IDs per step
+ *
+ * SSE has no unsigned 64-bit compare, so both sides are flipped at the sign
+ * bit and compared signed.
+ */
+AOC_CPU_TARGET_SSE42 static uint64_t chal2_sum_sse42 (uint64_t             first,
+                                                      uint64_t             count,
+                                                      const chal2_rule_t * p_rule)
+{
+    const __m128i sign  = _mm_set1_epi64x(INT64_MIN);
+    const __m128i lanes = _mm_set1_epi64x(2);
+    __m128i       ids   = _mm_set_epi64x((long long)(first + 1), (long long)first);
+    __m128i       sums  = _mm_setzero_si128();
+    __m128i       product[RULE_MAX];
+    __m128i       step[RULE_MAX];
+    __m128i       limit[RULE_MAX];
+    uint64_t      blocks = count / 2;
+    uint64_t      lane[2];
+
+    for (int test = 0; test < p_rule->count; test++)
+    {
+        product[test] = _mm_set_epi64x(
+            (long long)((first + 1) * p_rule->inverse[test]),
+            (long long)(first * p_rule->inverse[test]));
+        step[test]  = _mm_set1_epi64x((long long)(2 * p_rule->inverse[test]));
+        limit[test] = _mm_set1_epi64x((long long)(p_rule->limit[test] ^ INT64_MIN));
+    }
+
+    for (uint64_t block = 0; block < blocks; block++)
+    {
+        // All ones in the lanes that fail every test
+        __m128i failed = _mm_set1_epi64x(-1);
+
+        for (int test = 0; test < p_rule->count; test++)
+        {
+            failed = _mm_and_si128(
+                failed,
+                _mm_cmpgt_epi64(_mm_xor_si128(product[test], sign), limit[test]));
+            product[test] = _mm_add_epi64(product[test], step[test]);
+        }
+
+        sums = _mm_add_epi64(sums, _mm_andnot_si128(failed, ids));
+        ids  = _mm_add_epi64(ids, lanes);
+    }
+
+    _mm_storeu_si128((__m128i *)lane, sums);
+
+    return lane[0] + lane[1]
+           + chal2_sum_scalar(first + (2 * blocks), count - (2 * blocks), p_rule);
+}
+
+/**
+ * @brief AVX2 kernel: four IDs per step, same sign-flipped compare as SSE4.2
+ */
+AOC_CPU_TARGET_AVX2 static uint64_t chal2_sum_avx2 (uint64_t             first,
+                                                    uint64_t             count,
+                                                    const chal2_rule_t * p_rule)
+{
+    const __m256i sign  = _mm256_set1_epi64x(INT64_MIN);
+    const __m256i lanes = _mm256_set1_epi64x(4);
+    __m256i       ids   = _mm256_add_epi64(_mm256_set1_epi64x((long long)first),
+                                           _mm256_set_epi64x(3, 2, 1, 0));
+    __m256i       sums  = _mm256_setzero_si256();
+    __m256i       product[RULE_MAX];
+    __m256i       step[RULE_MAX];
+    __m256i       limit[RULE_MAX];
+    uint64_t      blocks = count / 4;
+    uint64_t      lane[4];
+
+    for (int test = 0; test < p_rule->count; test++)
+    {
+        uint64_t inverse = p_rule->inverse[test];
+
+        product[test] = _mm256_set_epi64x((long long)((first + 3) * inverse),
+                                          (long long)((first + 2) * inverse),
+                                          (long long)((first + 1) * inverse),
+                                          (long long)(first * inverse));
+        step[test]    = _mm256_set1_epi64x((long long)(4 * inverse));
+        limit[test]
+            = _mm256_set1_epi64x((long long)(p_rule->limit[test] ^ INT64_MIN));
+    }
+
+    for (uint64_t block = 0; block < blocks; block++)
+    {
+        // All ones in the lanes that fail every test
+        __m256i failed = _mm256_set1_epi64x(-1);
+
+        for (int test = 0; test < p_rule->count; test++)
+        {
+            failed = _mm256_and_si256(
+                failed,
+                _mm256_cmpgt_epi64(_mm256_xor_si256(product[test], sign),
+                                   limit[test]));
+            product[test] = _mm256_add_epi64(product[test], step[test]);
+        }
+
+        sums = _mm256_add_epi64(sums, _mm256_andnot_si256(failed, ids));
+        ids  = _mm256_add_epi64(ids, lanes);
+    }
+
+    _mm256_storeu_si256((__m256i *)lane, sums);
+
+    return lane[0] + lane[1] + lane[2] + lane[3]
+           + chal2_sum_scalar(first + (4 * blocks), count - (4 * blocks), p_rule);
+}
+
+/**
+ * @brief AVX-512 kernel: eight IDs per step with native unsigned compares
+ * into a mask
+ */
+AOC_CPU_TARGET_AVX512 static uint64_t chal2_sum_avx512 (uint64_t             first,
+                                                        uint64_t             count,
+                                                        const chal2_rule_t * p_rule)
+{
+    const __m512i lanes = _mm512_set1_epi64(8);
+    __m512i       ids   = _mm512_add_epi64(_mm512_set1_epi64((long long)first),
+                                           _mm512_set_epi64(7, 6, 5, 4, 3, 2, 1, 0));
+    __m512i       sums  = _mm512_setzero_si512();
+    __m512i       product[RULE_MAX];
+    __m512i       step[RULE_MAX];
+    __m512i       limit[RULE_MAX];
+    uint64_t      blocks = count / 8;
+
+    for (int test = 0; test < p_rule->count; test++)
+    {
+        __m512i inverse = _mm512_set1_epi64((long long)p_rule->inverse[test]);
+
+        product[test] = _mm512_mullo_epi64(ids, inverse);
+        step[test]    = _mm512_slli_epi64(inverse, 3);
+        limit[test]   = _mm512_set1_epi64((long long)p_rule->limit[test]);
+    }
+
+    for (uint64_t block = 0; block < blocks; block++)
+    {
+        __mmask8 counted = 0;
+
+        for (int test = 0; test < p_rule->count; test++)
+        {
+            counted |= _mm512_cmple_epu64_mask(product[test], limit[test]);
+            product[test] = _mm512_add_epi64(product[test], step[test]);
+        }
+
+        sums = _mm512_mask_add_epi64(sums, counted, sums, ids);
+        ids  = _mm512_add_epi64(ids, lanes);
+    }
+
+    return (uint64_t)_mm512_reduce_add_epi64(sums)
+           + chal2_sum_scalar(first + (8 * blocks), count - (8 * blocks), p_rule);
+}
+#endif /* AOC_CPU_X86 */
+
+#if AOC_CPU_X86
+static const chal2_sum_fn_t g_sum_variants[AOC_CPU_LEVELS] = {
+    chal2_sum_scalar,
+    chal2_sum_sse42,
+    chal2_sum_avx2,
+    chal2_sum_avx512,
+};
+#else
+static const chal2_sum_fn_t g_sum_variants[AOC_CPU_LEVELS] = {
+    chal2_sum_scalar,
+    chal2_sum_scalar,
+    chal2_sum_scalar,
+    chal2_sum_scalar,
+};
+#endif
+
+static chal2_sum_fn_t gp_sum = chal2_sum_scalar;
+
+/**
+ * @brief Binds the kernel to the variant for this CPU, before main runs
+ */
+__attribute__((constructor)) static void chal2_simd_init (void)
+{
+    gp_sum = g_sum_variants[aoc_cpu_level()];
+}
+
+/**
+ * @brief Sums the IDs of one length that pass a rule, with the bound kernel
+ *
+ * @param first First ID
+ * @param count Number of consecutive IDs, all of the rule's length
+ * @param p_rule Tests for the IDs' length
+ *
+ * @return Sum of the IDs that pass a test
+ */
+uint64_t chal2_sum_repeats (uint64_t             first,
+                            uint64_t             count,
+                            const chal2_rule_t * p_rule)
+{
+    return gp_sum(first, count, p_rule);
+}
+
+/**
+ * @brief Kernel of a given level, whatever the CPU, for checking the
+ * variants against each other
+ *
+ * @param level Level of the variant, which the CPU must support to run it
+ *
+ * @return The variant, NULL for a level out of range
+ */
+chal2_sum_fn_t chal2_sum_variant (aoc_cpu_level_t level)
+{
+    return ((unsigned)level < AOC_CPU_LEVELS) ? g_sum_variants[level] : NULL;
+}
+
+/** END OF FILE **/
\ No newline at end of file
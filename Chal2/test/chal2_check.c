@@ -0,0 +1,372 @@
+/**
+ * @file chal2_check.c
+ *
+ * @brief Differential check of the Advent of Code 2025 Challenge 2 solvers
+ *
+ * Random ranges, many of them around repeated-pattern IDs or where the IDs
+ * gain a digit, are scanned ID by ID with the string-comparing reference
+ * (chal2_is_value_counted and chal2_is_value_counted_part2). That is
+ * compared with every kernel the CPU runs through the chunk splitter, the
+ * pool solvers, the whole solver on the text and the pipelined solver.
+ * Usage: chal2_check [-n cases] [-S seed] [-o file]
+ *
+ * @author Mexeck88
+ *
+ * @date 18OCT26
+ */
+
+#include <unistd.h>
+
+#include "aoc_check.h"
+#include "chal2.h"
+
+#define CHECK_RANGES 8   // Most ranges per case
+#define CHECK_WIDTH  256 // Most IDs per range, bounds the reference's cost
+#define CHECK_DIGITS 17  // Longest ID drawn, so the sums fit in a long
+#define CHECK_NAME   32
+
+static bool chal2_check_case (const aoc_check_case_t * p_case,
+                              char *                   p_why,
+                              size_t                   why_size);
+static void chal2_check_generate (aoc_rng_t * p_rng, aoc_check_case_t * p_case);
+static bool chal2_check_simplify (void * p_item, size_t step);
+static void chal2_check_print (const aoc_check_case_t * p_case, FILE * p_out);
+
+static const aoc_check_t g_check = {
+    .p_name     = "chal2",
+    .item_size  = sizeof(chal2_range_t),
+    .max_items  = CHECK_RANGES,
+    .p_generate = chal2_check_generate,
+    .p_check    = chal2_check_case,
+    .p_simplify = chal2_check_simplify,
+    .p_merge    = NULL,
+    .p_print    = chal2_check_print,
+};
+
+static chal2_rule_t g_rules[2][DIGITS_MAX + 1]; // Part 1, part 2
+
+/**
+ * @brief Draws an ID of a given length made of a repeated pattern
+ *
+ * @param p_rng Seeded generator
+ * @param length Digits of the ID, at least 2
+ *
+ * @return The ID
+ */
+static long chal2_check_repeat (aoc_rng_t * p_rng, int length)
+{
+    int  pattern = 0;
+    long digits  = 0;
+    long value   = 0;
+
+    // Any proper divisor of the length is a pattern length
+    do
+    {
+        pattern = 1 + (int)aoc_rng_below(p_rng, (uint64_t)length / 2);
+    } while (0 != length % pattern);
+
+    digits = 1 + (long)aoc_rng_below(p_rng, 9);
+    for (int idx = 1; idx < pattern; idx++)
+    {
+        digits = (digits * 10) + (long)aoc_rng_below(p_rng, 10);
+    }
+
+    for (int idx = 0; idx < length; idx += pattern)
+    {
+        for (int digit = 0; digit < pattern; digit++)
+        {
+            value *= 10;
+        }
+        value += digits;
+    }
+
+    return value;
+}
+
+/**
+ * @brief Draws random ranges: anywhere, across a power of ten, around a
+ * repeated-pattern ID, and now and then empty or starting at 0
+ *
+ * @param p_rng Seeded generator
+ * @param p_case Empty case to fill
+ */
+static void chal2_check_generate (aoc_rng_t * p_rng, aoc_check_case_t * p_case)
+{
+    chal2_range_t * p_ranges = p_case->p_items;
+    size_t          count    = aoc_rng_below(p_rng, p_case->capacity + 1);
+    int             length   = 0;
+    long            power    = 1;
+    long            start    = 0;
+
+    for (size_t idx = 0; idx < count; idx++)
+    {
+        length = 2 + (int)aoc_rng_below(p_rng, CHECK_DIGITS - 1);
+        power  = 1;
+        for (int digit = 1; digit < length; digit++)
+        {
+            power *= 10;
+        }
+
+        switch (aoc_rng_below(p_rng, 4))
+        {
+            case 0:
+                start = power + (long)aoc_rng_below(p_rng, (uint64_t)power * 9);
+                break;
+
+            case 1:
+                start = power - (long)aoc_rng_below(p_rng, CHECK_WIDTH);
+                break;
+
+            case 2:
+                start = chal2_check_repeat(p_rng, length)
+                        - (long)aoc_rng_below(p_rng, CHECK_WIDTH);
+                break;
+
+            default:
+                start = (long)aoc_rng_below(p_rng, CHECK_WIDTH);
+                break;
+        }
+
+        p_ranges[idx].start = (0 > start) ? 0 : start;
+        p_ranges[idx].end
+            = p_ranges[idx].start + (long)aoc_rng_below(p_rng, CHECK_WIDTH);
+
+        // One range in 16 ends before it starts
+        if (0 == aoc_rng_below(p_rng, 16))
+        {
+            p_ranges[idx].end -= CHECK_WIDTH;
+        }
+    }
+
+    p_case->count = count;
+}
+
+/**
+ * @brief Simplifies a range: to its first ID, either half, one ID fewer at
+ * either end, or a digit shorter
+ *
+ * @param p_item Range to simplify
+ * @param step Which way
+ *
+ * @return false once step is past the last way
+ */
+static bool chal2_check_simplify (void * p_item, size_t step)
+{
+    chal2_range_t * p_range = p_item;
+    long            width   = p_range->end - p_range->start;
+
+    switch (step)
+    {
+        case 0:
+            p_range->end = p_range->start;
+            break;
+
+        case 1:
+            p_range->start += (0 < width) ? (width + 1) / 2 : 0;
+            break;
+
+        case 2:
+            p_range->end -= (0 < width) ? (width + 1) / 2 : 0;
+            break;
+
+        case 3:
+            p_range->start += (0 < width) ? 1 : 0;
+            break;
+
+        case 4:
+            p_range->end -= (0 < width) ? 1 : 0;
+            break;
+
+        case 5:
+            p_range->start /= 10;
+            p_range->end /= 10;
+            break;
+
+        default:
+            return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Writes ranges as one comma-separated input line
+ *
+ * @param p_case Case to write
+ * @param p_out Where to write it
+ */
+static void chal2_check_print (const aoc_check_case_t * p_case, FILE * p_out)
+{
+    const chal2_range_t * p_ranges = p_case->p_items;
+
+    for (size_t idx = 0; idx < p_case->count; idx++)
+    {
+        fprintf(p_out,
+                "%s%ld-%ld",
+                (0 < idx) ? "," : "",
+                p_ranges[idx].start,
+                p_ranges[idx].end);
+    }
+
+    fprintf(p_out, "\n");
+}
+
+/**
+ * @brief Sums the ranges with one kernel through the chunk splitter, each
+ * range cut in two chunks
+ *
+ * @param p_case Ranges to sum
+ * @param p_sum Kernel to run
+ * @param p_result Receives both parts
+ */
+static void chal2_check_kernel (const aoc_check_case_t * p_case,
+                                chal2_sum_fn_t           p_sum,
+                                aoc_day_result_t *       p_result)
+{
+    const chal2_range_t * p_ranges   = p_case->p_items;
+    chal2_span_t          span       = { 0 };
+    int64_t *             p_parts[2] = { &p_result->part1, &p_result->part2 };
+    size_t                ids        = 0;
+
+    p_result->part1 = 0;
+    p_result->part2 = 0;
+    span.p_sum      = p_sum;
+
+    for (size_t idx = 0; idx < p_case->count; idx++)
+    {
+        if (p_ranges[idx].end < p_ranges[idx].start)
+        {
+            continue;
+        }
+
+        span.start = p_ranges[idx].start;
+        ids        = (size_t)(p_ranges[idx].end - p_ranges[idx].start) + 1;
+
+        for (int part = 0; part < 2; part++)
+        {
+            span.p_rules = g_rules[part];
+            *p_parts[part] += chal2_sum_chunk(&span, 0, ids / 3)
+                              + chal2_sum_chunk(&span, ids / 3, ids);
+        }
+    }
+}
+
+/**
+ * @brief Runs every solver on a case and compares it with the reference
+ *
+ * @param p_case Ranges to check
+ * @param p_why Receives the first mismatch
+ * @param why_size Size of p_why
+ *
+ * @return true if every solver agrees with the reference
+ */
+static bool chal2_check_case (const aoc_check_case_t * p_case,
+                              char *                   p_why,
+                              size_t                   why_size)
+{
+    bool                  b_retval     = false;
+    const chal2_range_t * p_ranges     = p_case->p_items;
+    long                  password     = 0;
+    long                  password_two = 0;
+    int                   fd           = -1;
+    char                  path[AOC_CHECK_PATH];
+    char                  name[CHECK_NAME];
+    main_args_t           main_args = { 0 };
+    aoc_day_result_t      want      = { 0 };
+    aoc_day_result_t      got       = { 0 };
+
+    // Reference: every ID of every range, as text
+    for (size_t idx = 0; idx < p_case->count; idx++)
+    {
+        for (long id = p_ranges[idx].start; id <= p_ranges[idx].end; id++)
+        {
+            chal2_is_value_counted(&password, id);
+            chal2_is_value_counted_part2(&password_two, id);
+        }
+    }
+
+    want.part1 = password;
+    want.part2 = password_two;
+
+    // Every kernel this CPU can run, whichever one is bound
+    for (int level = 0; level <= (int)aoc_cpu_detect(); level++)
+    {
+        chal2_check_kernel(p_case, chal2_sum_variant(level), &got);
+        snprintf(name, sizeof(name), "%s kernel", aoc_cpu_name(level));
+        if (false == aoc_check_result(name, &got, &want, p_why, why_size))
+        {
+            goto EXIT;
+        }
+    }
+
+    // Pool solvers on the ranges as parsed
+    main_args.p_ranges    = (chal2_range_t *)p_ranges;
+    main_args.range_count = (int)p_case->count;
+
+    if ((false == chal2_solve_part1(&main_args))
+        || (false == chal2_solve_part2(&main_args)))
+    {
+        snprintf(p_why, why_size, "pool solvers failed");
+        goto EXIT;
+    }
+
+    got.part1 = main_args.password;
+    got.part2 = main_args.password_two;
+    if (false == aoc_check_result("pool solvers", &got, &want, p_why, why_size))
+    {
+        goto EXIT;
+    }
+
+    // Whole and pipelined solvers on the text
+    fd = aoc_check_text(&g_check, p_case, path, sizeof(path));
+    if (0 > fd)
+    {
+        snprintf(p_why, why_size, "unable to write the input");
+        goto EXIT;
+    }
+
+    if (AOC_SUCCESS != chal2_run(path, NULL, &got))
+    {
+        snprintf(p_why, why_size, "chal2_run failed");
+        goto EXIT;
+    }
+
+    if (false == aoc_check_result("chal2_run", &got, &want, p_why, why_size))
+    {
+        goto EXIT;
+    }
+
+    main_args.p_file_path = path;
+    if (false == chal2_solve_pipelined(&main_args))
+    {
+        snprintf(p_why, why_size, "pipelined solver failed");
+        goto EXIT;
+    }
+
+    got.part1 = main_args.password;
+    got.part2 = main_args.password_two;
+    if (false
+        == aoc_check_result("pipelined solver", &got, &want, p_why, why_size))
+    {
+        goto EXIT;
+    }
+
+    b_retval = true;
+EXIT:
+    if (0 <= fd)
+    {
+        close(fd);
+    }
+
+    return b_retval;
+}
+
+int main (int argc, char ** argv)
+{
+    chal2_make_rules(g_rules[0], false);
+    chal2_make_rules(g_rules[1], true);
+
+    return aoc_check_main(&g_check, argc, argv);
+}
+
+/** END OF FILE **/
\ No newline at end of file
@@ -0,0 +1,158 @@
+/**
+ * @file chal3_gen.c
+ *
+ * @brief Input generator for Challenge 3: battery banks, one line of digits
+ * 1 to 9 per bank
+ *
+ * Usage: chal3_gen [-n banks | -s size] [-S seed] [-o output] [-L length]
+ *
+ * Lines of any length are written a chunk at a time, so a single bank can be
+ * larger than memory. The default matches the checked-in input: 200 banks of
+ * 100 digits.
+ *
+ * @author Mexeck88
+ *
+ * @date 18OCT26
+ */
+
+#include <stdio.h>
+#include <unistd.h>
+
+#include "aoc_gen.h"
+#include "aoc_input.h"
+
+/**
+ * @enum gen_info_t
+ * @brief Generator defaults and limits
+ */
+typedef enum gen_info_t
+{
+    DEFAULT_BANKS  = 200,
+    DEFAULT_LENGTH = 100,
+    MIN_LENGTH     = 12,   // Part 2 picks twelve batteries per bank
+    CHUNK_SIZE     = 4096, // Digits drawn before each write
+    DIGIT_COUNT    = 9,
+} gen_info_t;
+
+/**
+ * @struct gen_args_t
+ * @brief Generator options
+ */
+typedef struct gen_args_t
+{
+    aoc_gen_args_t common;
+    uint64_t       length; // Digits per bank
+} gen_args_t;
+
+/**
+ * @brief Parses the command line
+ *
+ * @param argc Argument count
+ * @param argv Argument vector
+ * @param p_args Options to fill in
+ *
+ * @return true on success, false on a bad command line
+ */
+static bool gen_parse_args (int argc, char ** argv, gen_args_t * p_args)
+{
+    int option = 0;
+
+    aoc_gen_args_init(&p_args->common, DEFAULT_BANKS);
+    p_args->length = DEFAULT_LENGTH;
+
+    while (-1 != (option = getopt(argc, argv, AOC_GEN_OPTIONS "L:")))
+    {
+        switch (aoc_gen_option(&p_args->common, option, optarg))
+        {
+            case AOC_GEN_OPT_USED:
+                continue;
+            case AOC_GEN_OPT_BAD:
+                return false;
+            default:
+                break;
+        }
+
+        if (('L' != option)
+            || (false == aoc_gen_parse_size(optarg, &p_args->length))
+            || (MIN_LENGTH > p_args->length))
+        {
+            printf("Usage: %s [-n banks | -s size] [-S seed] [-o output] "
+                   "[-L length (at least %d)]\n",
+                   argv[0],
+                   MIN_LENGTH);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * @brief Writes one bank and its newline
+ *
+ * @param p_rng Seeded generator
+ * @param p_writer Open writer
+ * @param length Digits in the bank
+ *
+ * @return AOC_SUCCESS on success, AOC_FAILURE on failure
+ */
+static uint8_t gen_bank (aoc_rng_t *    p_rng,
+                         aoc_writer_t * p_writer,
+                         uint64_t       length)
+{
+    char   chunk[CHUNK_SIZE];
+    size_t count = 0;
+
+    while (0 < length)
+    {
+        count = (CHUNK_SIZE < length) ? CHUNK_SIZE : (size_t)length;
+        for (size_t idx = 0; idx < count; idx++)
+        {
+            chunk[idx] = (char)('1' + aoc_rng_below(p_rng, DIGIT_COUNT));
+        }
+
+        if (AOC_SUCCESS != aoc_writer_put(p_writer, chunk, count))
+        {
+            return AOC_FAILURE;
+        }
+        length -= count;
+    }
+
+    return aoc_writer_put(p_writer, "\n", 1);
+}
+
+int main (int argc, char ** argv)
+{
+    int          retcode = 1;
+    gen_args_t   args    = { 0 };
+    aoc_rng_t    rng     = { 0 };
+    aoc_writer_t writer  = { 0 };
+    uint64_t     banks   = 0;
+
+    if ((false == gen_parse_args(argc, argv, &args))
+        || (AOC_SUCCESS != aoc_writer_open(&writer, args.common.p_out)))
+    {
+        goto EXIT;
+    }
+
+    aoc_rng_seed(&rng, args.common.seed);
+
+    for (banks = 0; true == aoc_gen_more(&args.common, &writer, banks); banks++)
+    {
+        if (AOC_SUCCESS != gen_bank(&rng, &writer, args.length))
+        {
+            goto CLEAN;
+        }
+    }
+
+    retcode = 0;
+CLEAN:
+    if (AOC_SUCCESS != aoc_writer_close(&writer))
+    {
+        retcode = 1;
+    }
+EXIT:
+    return retcode;
+}
+
+/** END OF FILE **/
\ No newline at end of file
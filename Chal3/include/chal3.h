@@ -11,12 +11,28 @@
 #ifndef CHAL3_H
 #define CHAL3_H
 
+#include <limits.h>
 #include <string.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdint.h>
+#include <stdbool.h>
 
-#define FILE_PATH "src/input.txt"
+#include "aoc_arena.h"
+#include "aoc_bench.h"
+#include "aoc_cache.h"
+#include "aoc_day.h"
+#include "aoc_input.h"
+#include "aoc_pipe.h"
+#include "aoc_pool.h"
+#include "aoc_snap.h"
+#include "aoc_trace.h"
+#include "chal3_simd.h"
+
+#define FILE_PATH      "src/input.txt"
+#define LINE_DELIMS    "\r\n"
+#define DAY_NUMBER     3
+#define SOLVER_VERSION "1" // Bump when the answers for an input change
 
 /**
  * @enum numbers_t
@@ -35,8 +51,9 @@ typedef enum numbers_t
  */
 typedef enum line_info_t
 {
-    LINE_SIZE = 101,
-    NUM_LINES = 200,
+    LINE_SIZE     = 101,
+    NUM_LINES     = 200, // Initial line capacity
+    REALLOC_SCALE = 2,
 } line_info_t;
 
 /**
@@ -56,19 +73,31 @@ typedef enum retcode_t
  */
 typedef struct main_args_t
 {
-    char **   pp_lines;
-    int       line_count;
-    long      solution_1;
-    long long solution_2;
+    const char * p_file_path;
+    aoc_input_t  input;   // Input the line views point into
+    aoc_arena_t  arena;   // Holds the array of line views
+    aoc_view_t * p_lines;
+    int          line_count;
+    long         solution_1;
+    long long    solution_2;
 
 } main_args_t;
 
-static uint8_t chal3_load_input (const char *  p_file_path,
-                                 main_args_t * p_main_args);
-static uint8_t chal3_process_input (main_args_t * p_main_args);
-static uint8_t chal3_process_line_part1 (const char *  p_line,
-                                         main_args_t * p_main_args);
-static uint8_t chal3_process_line_part2 (const char *  p_line,
-                                         main_args_t * p_main_args);
+/**
+ * @struct chal3_lines_t
+ * @brief Lines being summed on the pool
+ */
+typedef struct chal3_lines_t
+{
+    const aoc_view_t * p_lines;
+    atomic_bool        b_failed; // Set by any chunk with a bad line
+} chal3_lines_t;
+
+uint8_t   chal3_run (const char *       p_file_path,
+                     aoc_cache_t *      p_cache,
+                     aoc_day_result_t * p_result);
+uint8_t   chal3_solve_pipelined (main_args_t * p_main_args);
+long      chal3_best_pair_ref (const aoc_view_t * p_line);
+long long chal3_best_twelve_ref (const aoc_view_t * p_line);
 
 #endif /* CHAL3_H  */
\ No newline at end of file
@@ -0,0 +1,31 @@
+/**
+ * @file chal3_simd.h
+ *
+ * @brief Digit-picking kernels for Advent of Code 2025 Challenge 3, one per
+ * CPU level, and the greedy digit selection built on them.
+ *
+ * @author Mexeck88
+ *
+ * @date 18OCT26
+ */
+
+#ifndef CHAL3_SIMD_H
+#define CHAL3_SIMD_H
+
+#include <stddef.h>
+
+#include "aoc_cpu.h"
+
+/**
+ * @brief Kernel finding the next digit to pick: the first '9' of the bytes,
+ * else the first of the largest byte; length must not be 0
+ */
+typedef size_t (*chal3_pick_fn_t)(const char * p_data, size_t length);
+
+long long       chal3_select_digits (chal3_pick_fn_t p_pick,
+                                     const char *    p_data,
+                                     size_t          length,
+                                     size_t          digits);
+chal3_pick_fn_t chal3_pick_variant (aoc_cpu_level_t level);
+
+#endif /* CHAL3_SIMD_H */
\ No newline at end of file
@@ -10,137 +10,397 @@
 
 #include "chal3.h"
 
+static uint8_t chal3_load_input (main_args_t * p_main_args);
+static uint8_t chal3_parse_input (main_args_t * p_main_args);
+static uint8_t chal3_load_snapshot (main_args_t * p_main_args);
+#ifndef AOC_RUNNER
+static uint8_t chal3_write_snapshot (main_args_t * p_main_args,
+                                     const char *  p_snap_path);
+#endif /* AOC_RUNNER */
+static uint8_t chal3_solve_part1 (main_args_t * p_main_args);
+static uint8_t chal3_solve_part2 (main_args_t * p_main_args);
+static uint8_t chal3_process_line_part1 (const aoc_view_t * p_line,
+                                         long *             p_sum);
+static uint8_t chal3_process_line_part2 (const aoc_view_t * p_line,
+                                         long long *        p_sum);
+
 /**
- * @brief Processes the input lines to compute the two solutions
+ * @brief Opens (maps) the input file
  *
- * @param p_file_path Path to the input file
- * @param p_main_args Pointer to the main arguments structure containing input
- * lines
+ * @param p_main_args Pointer to the main arguments structure
  *
  * @return RET_SUCCESS on success, RET_FAILURE on failure
  */
-static uint8_t chal3_load_input (const char *  p_file_path,
-                                 main_args_t * p_main_args)
+static uint8_t chal3_load_input (main_args_t * p_main_args)
 {
-    uint8_t retcode               = RET_FAILURE;
-    char    buffer[LINE_SIZE + 1] = { 0 }; // fgets null terminator
+    uint8_t retcode = RET_FAILURE;
+
+    AOC_TRACE_SCOPE("load");
 
-    if ((NULL == p_file_path) || (NULL == p_main_args))
+    if (NULL == p_main_args)
     {
         perror("ERROR: NULL pointer passed to load_input\n");
         retcode = RET_NULL_POINTER;
         goto EXIT;
     }
 
-    FILE * p_file = fopen(p_file_path, "r");
-    if (NULL == p_file)
+    if (AOC_SUCCESS != aoc_input_open(p_main_args->p_file_path, &p_main_args->input))
     {
-        perror("ERROR: Unable to open file");
         goto EXIT;
     }
 
-    p_main_args->pp_lines = malloc(sizeof(char *) * NUM_LINES);
-    if (NULL == p_main_args->pp_lines)
+    retcode = RET_SUCCESS;
+EXIT:
+    return retcode;
+}
+
+/**
+ * @brief Hands out a view of each non-blank line of the input
+ *
+ * @param p_main_args Pointer to the main arguments structure with an open
+ * input; the views are kept in its arena
+ *
+ * @return RET_SUCCESS on success, RET_FAILURE on failure
+ */
+static uint8_t chal3_parse_input (main_args_t * p_main_args)
+{
+    uint8_t      retcode  = RET_FAILURE;
+    int          capacity = NUM_LINES;
+    aoc_view_t * p_temp   = NULL;
+    aoc_view_t   line     = { 0 };
+
+    AOC_TRACE_SCOPE("parse");
+
+    if (NULL == p_main_args)
+    {
+        perror("ERROR: NULL pointer passed to parse_input\n");
+        retcode = RET_NULL_POINTER;
+        goto EXIT;
+    }
+
+    // A snapshot already holds the lines, back to back
+    if (true == aoc_snap_detect(&p_main_args->input))
+    {
+        retcode = chal3_load_snapshot(p_main_args);
+        goto EXIT;
+    }
+
+    p_main_args->line_count = 0;
+    p_main_args->p_lines
+        = aoc_arena_alloc(&p_main_args->arena, sizeof(aoc_view_t) * capacity);
+    if (NULL == p_main_args->p_lines)
     {
         perror("ERROR: Unable to allocate memory for lines");
-        goto CLEAN;
+        goto EXIT;
     }
 
-    // Copy into struct
-    while (NULL != fgets(buffer, LINE_SIZE + 1, p_file))
+    // Views into the input, nothing is copied
+    while (true == aoc_input_next_line(&p_main_args->input, &line))
     {
-        // Check bounds before allocating
-        if (NUM_LINES + 1 <= p_main_args->line_count)
+        if (0 == line.length)
         {
-            printf("ERROR: Exceeded maximum number of lines (%d)\n",
-                   p_main_args->line_count);
-            goto CLEAN;
+            continue;
         }
 
-        p_main_args->pp_lines[p_main_args->line_count] = malloc(
-            (LINE_SIZE) * sizeof(char)); // replace the \n with null terminator
-        if (NULL == p_main_args->pp_lines[p_main_args->line_count])
+        if (capacity <= p_main_args->line_count)
         {
-            printf("ERROR: Unable to allocate memory for line %d\n",
-                   p_main_args->line_count);
-            goto CLEAN;
+            // Grows in place while the lines are the newest allocation
+            p_temp = aoc_arena_grow(&p_main_args->arena,
+                                    p_main_args->p_lines,
+                                    sizeof(aoc_view_t) * capacity,
+                                    sizeof(aoc_view_t) * capacity * REALLOC_SCALE,
+                                    AOC_ARENA_ALIGN);
+            if (NULL == p_temp)
+            {
+                perror("ERROR: Unable to reallocate memory for lines");
+                goto EXIT;
+            }
+            p_main_args->p_lines = p_temp;
+            capacity *= REALLOC_SCALE;
         }
 
-        strncpy(
-            p_main_args->pp_lines[p_main_args->line_count], buffer, LINE_SIZE);
-        p_main_args->pp_lines[p_main_args->line_count][LINE_SIZE - 1]
-            = '\0'; // Null terminate
-
+        p_main_args->p_lines[p_main_args->line_count] = line;
         p_main_args->line_count++;
     }
 
     retcode = RET_SUCCESS;
-    goto EXIT;
+EXIT:
+    return retcode;
+}
 
-CLEAN:
-    for (int idx = 0; idx < p_main_args->line_count; idx++)
+/**
+ * @brief Hands out a view of each line of a snapshot. The payload is count + 1
+ * offsets into the digits that follow them, so line i is digits
+ * [offsets[i], offsets[i + 1]); the digits stay ASCII for the kernels.
+ *
+ * @param p_main_args Pointer to the main arguments structure with an open
+ * snapshot input; the views are kept in its arena and point into the input
+ *
+ * @return RET_SUCCESS on success, RET_FAILURE on failure
+ */
+static uint8_t chal3_load_snapshot (main_args_t * p_main_args)
+{
+    uint8_t          retcode   = RET_FAILURE;
+    aoc_snap_t       snap      = { 0 };
+    const uint64_t * p_offsets = NULL;
+    const char *     p_digits  = NULL;
+    size_t           table     = 0;
+
+    if (NULL == p_main_args)
     {
-        if (NULL != p_main_args->pp_lines[idx])
-        {
-            free(p_main_args->pp_lines[idx]);
-            p_main_args->pp_lines[idx] = NULL;
-        }
+        perror("ERROR: NULL pointer passed to load_snapshot\n");
+        retcode = RET_NULL_POINTER;
+        goto EXIT;
     }
 
-    if (NULL != p_main_args->pp_lines)
+    if (AOC_SUCCESS != aoc_snap_open(&p_main_args->input, DAY_NUMBER, &snap))
     {
-        free(p_main_args->pp_lines);
-        p_main_args->pp_lines = NULL;
+        goto EXIT;
     }
 
-EXIT:
-    if (NULL != p_file)
+    // The header keeps the payload 8-byte aligned, so the table is read as is
+    p_offsets = (const uint64_t *)snap.p_payload;
+    table     = sizeof(uint64_t) * (snap.count + 1);
+    if ((INT_MAX < snap.count) || (table > snap.size)
+        || (0 != p_offsets[0]) || (snap.size - table != p_offsets[snap.count]))
     {
-        fclose(p_file);
+        printf("ERROR: Snapshot does not hold %llu lines\n",
+               (unsigned long long)snap.count);
+        goto EXIT;
+    }
+
+    p_main_args->p_lines
+        = aoc_arena_alloc(&p_main_args->arena, sizeof(aoc_view_t) * snap.count);
+    if (NULL == p_main_args->p_lines)
+    {
+        perror("ERROR: Unable to allocate memory for lines");
+        goto EXIT;
+    }
+
+    p_digits = (const char *)snap.p_payload + table;
+    for (size_t idx = 0; idx < snap.count; idx++)
+    {
+        if (p_offsets[idx] > p_offsets[idx + 1])
+        {
+            printf("ERROR: Snapshot line %zu ends before it starts\n", idx);
+            goto EXIT;
+        }
+
+        p_main_args->p_lines[idx].p_data = p_digits + p_offsets[idx];
+        p_main_args->p_lines[idx].length
+            = (size_t)(p_offsets[idx + 1] - p_offsets[idx]);
     }
+    p_main_args->line_count = (int)snap.count;
 
+    retcode = RET_SUCCESS;
+EXIT:
     return retcode;
 }
 
+#ifndef AOC_RUNNER
 /**
- * @brief Processes all input lines to compute solutions
+ * @brief Parses the input and writes its lines as a snapshot (-s): the offset
+ * table, then the digits of every line back to back
  *
- * @param p_main_args Pointer to the main arguments structure containing input
- * lines
+ * @param p_main_args Pointer to the main arguments structure
+ * @param p_snap_path Snapshot file to write
  *
- * @return true on success, false otherwise
+ * @return RET_SUCCESS on success, RET_FAILURE on failure
  */
-static uint8_t chal3_process_input (main_args_t * p_main_args)
+static uint8_t chal3_write_snapshot (main_args_t * p_main_args,
+                                     const char *  p_snap_path)
 {
-    uint8_t      retcode = RET_FAILURE;
-    const char * p_line  = NULL;
-    // Loop through all lines
-    if (NULL == p_main_args)
+    uint8_t    retcode   = RET_FAILURE;
+    size_t     count     = 0;
+    size_t     table     = 0;
+    size_t     digits    = 0;
+    uint64_t * p_offsets = NULL;
+    char *     p_digits  = NULL;
+
+    if ((RET_SUCCESS != chal3_load_input(p_main_args))
+        || (RET_SUCCESS != chal3_parse_input(p_main_args)))
+    {
+        perror("ERROR: Unable to load input file");
+        goto EXIT;
+    }
+
+    count = (size_t)p_main_args->line_count;
+    table = sizeof(uint64_t) * (count + 1);
+    for (size_t idx = 0; idx < count; idx++)
+    {
+        digits += p_main_args->p_lines[idx].length;
+    }
+
+    p_offsets = aoc_arena_alloc(&p_main_args->arena, table + digits);
+    if (NULL == p_offsets)
     {
-        perror("ERROR: NULL pointer passed to process_input\n");
+        perror("ERROR: Unable to allocate memory for snapshot");
         goto EXIT;
     }
 
-    for (int idx = 0; idx < p_main_args->line_count; idx++)
+    p_digits     = (char *)p_offsets + table;
+    p_offsets[0] = 0;
+    for (size_t idx = 0; idx < count; idx++)
     {
-        p_line = (const char *)p_main_args->pp_lines[idx];
-        // Process line for part 1
-        if (RET_FAILURE == chal3_process_line_part1(p_line, p_main_args))
+        memcpy(p_digits + p_offsets[idx],
+               p_main_args->p_lines[idx].p_data,
+               p_main_args->p_lines[idx].length);
+        p_offsets[idx + 1] = p_offsets[idx] + p_main_args->p_lines[idx].length;
+    }
+
+    if (AOC_SUCCESS
+        != aoc_snap_write(
+            p_snap_path, DAY_NUMBER, count, 0, p_offsets, table + digits))
+    {
+        goto EXIT;
+    }
+
+    printf("Wrote %zu lines to %s\n", count, p_snap_path);
+    retcode = RET_SUCCESS;
+EXIT:
+    return retcode;
+}
+#endif /* AOC_RUNNER */
+
+/**
+ * @brief Adds up the part 1 values of a chunk of lines (pool reduction)
+ *
+ * @param p_ctx Pointer to the chal3_lines_t being summed
+ * @param begin First line of the chunk
+ * @param end One past the last line
+ *
+ * @return Sum of the chunk's values
+ */
+static int64_t chal3_sum_part1 (void * p_ctx, size_t begin, size_t end)
+{
+    chal3_lines_t * p_lines = p_ctx;
+    long            sum     = 0;
+
+    AOC_TRACE_SCOPE_ARG("lines", begin);
+
+    for (size_t idx = begin; idx < end; idx++)
+    {
+        if (RET_SUCCESS != chal3_process_line_part1(&p_lines->p_lines[idx], &sum))
         {
-            perror("ERROR: Unable to process line for part 1");
-            goto EXIT;
+            atomic_store(&p_lines->b_failed, true);
+            break;
         }
+    }
+
+    return sum;
+}
+
+/**
+ * @brief Adds up the part 2 values of a chunk of lines (pool reduction)
+ *
+ * @param p_ctx Pointer to the chal3_lines_t being summed
+ * @param begin First line of the chunk
+ * @param end One past the last line
+ *
+ * @return Sum of the chunk's values
+ */
+static int64_t chal3_sum_part2 (void * p_ctx, size_t begin, size_t end)
+{
+    chal3_lines_t * p_lines = p_ctx;
+    long long       sum     = 0;
+
+    AOC_TRACE_SCOPE_ARG("lines", begin);
 
-        // Process line for part 2
-        if (RET_FAILURE == chal3_process_line_part2(p_line, p_main_args))
+    for (size_t idx = begin; idx < end; idx++)
+    {
+        if (RET_SUCCESS != chal3_process_line_part2(&p_lines->p_lines[idx], &sum))
         {
-            perror("ERROR: Unable to process line for part 2");
-            goto EXIT;
+            atomic_store(&p_lines->b_failed, true);
+            break;
         }
     }
 
+    return sum;
+}
+
+/**
+ * @brief Adds up the best two-digit value of every line (part 1)
+ *
+ * @param p_main_args Pointer to the main arguments structure containing input
+ * lines
+ *
+ * @return RET_SUCCESS on success, RET_FAILURE on failure
+ */
+static uint8_t chal3_solve_part1 (main_args_t * p_main_args)
+{
+    uint8_t       retcode = RET_FAILURE;
+    chal3_lines_t lines;
+
+    AOC_TRACE_SCOPE("part1");
+
+    if (NULL == p_main_args)
+    {
+        perror("ERROR: NULL pointer passed to solve_part1\n");
+        goto EXIT;
+    }
+
+    lines.p_lines = p_main_args->p_lines;
+    atomic_init(&lines.b_failed, false);
+
+    p_main_args->solution_1 = aoc_pool_reduce(aoc_pool_shared(),
+                                              0,
+                                              (size_t)p_main_args->line_count,
+                                              0,
+                                              chal3_sum_part1,
+                                              aoc_pool_add,
+                                              0,
+                                              &lines);
+    if (true == atomic_load(&lines.b_failed))
+    {
+        perror("ERROR: Unable to process line for part 1");
+        goto EXIT;
+    }
+
+    retcode = RET_SUCCESS;
 EXIT:
+    return retcode;
+}
+
+/**
+ * @brief Adds up the best twelve-digit value of every line (part 2)
+ *
+ * @param p_main_args Pointer to the main arguments structure containing input
+ * lines
+ *
+ * @return RET_SUCCESS on success, RET_FAILURE on failure
+ */
+static uint8_t chal3_solve_part2 (main_args_t * p_main_args)
+{
+    uint8_t       retcode = RET_FAILURE;
+    chal3_lines_t lines;
+
+    AOC_TRACE_SCOPE("part2");
+
+    if (NULL == p_main_args)
+    {
+        perror("ERROR: NULL pointer passed to solve_part2\n");
+        goto EXIT;
+    }
+
+    lines.p_lines = p_main_args->p_lines;
+    atomic_init(&lines.b_failed, false);
+
+    p_main_args->solution_2 = aoc_pool_reduce(aoc_pool_shared(),
+                                              0,
+                                              (size_t)p_main_args->line_count,
+                                              0,
+                                              chal3_sum_part2,
+                                              aoc_pool_add,
+                                              0,
+                                              &lines);
+    if (true == atomic_load(&lines.b_failed))
+    {
+        perror("ERROR: Unable to process line for part 2");
+        goto EXIT;
+    }
+
     retcode = RET_SUCCESS;
+EXIT:
     return retcode;
 }
 
@@ -148,55 +408,77 @@ EXIT:
  * @brief Processes a single line for part 1 solution
  *
  * @param p_line The input line to process
- * @param p_main_args Pointer to the main arguments structure
+ * @param p_sum Sum the line's value is added to
  *
  * @return RET_SUCCESS on success, RET_FAILURE on failure
  */
-static uint8_t chal3_process_line_part1 (const char *  p_line,
-                                         main_args_t * p_main_args)
+static uint8_t chal3_process_line_part1 (const aoc_view_t * p_line,
+                                         long *             p_sum)
 {
-    uint8_t retcode     = RET_FAILURE;
-    long    max_sum     = 0;
-    long    num_1       = 0;
-    long    num_2       = 0;
-    long    sum         = 0;
-    char *  p_endptr    = NULL;
-    char    buffer[TWO] = { 0 };
+    uint8_t retcode = RET_FAILURE;
 
-    if ((NULL == p_line) || (NULL == p_main_args))
+    if ((NULL == p_line) || (NULL == p_sum))
     {
         perror("ERROR: NULL pointer passed to process_line_part1\n");
         goto EXIT;
     }
 
-    for (int idx = 0; idx < LINE_SIZE - 1; idx++)
+    // A single digit makes no pair
+    if (TWO <= p_line->length)
     {
-        for (int jdx = idx + 1; jdx < LINE_SIZE - 1; jdx++)
-        {
-            memcpy(buffer, &p_line[idx], 1);
-            buffer[1] = '\0';
+        *p_sum += (long)chal3_select_digits(
+            NULL, p_line->p_data, p_line->length, TWO);
+    }
 
-            num_1 = strtol(buffer, &p_endptr, BASE_10);
-            if (p_endptr == &buffer[0])
-            {
-                printf("ERROR: Unable to parse first number: %d\n", buffer[0]);
-                p_endptr = NULL;
-                goto EXIT;
-            }
+    retcode = RET_SUCCESS;
+EXIT:
+    return retcode;
+}
+
+/**
+ * @brief Processes a single line for part 2 solution
+ *
+ * @param p_line The input line to process
+ * @param p_sum Sum the line's value is added to
+ *
+ * @return RET_SUCCESS on success, RET_FAILURE on failure
+ */
+static uint8_t chal3_process_line_part2 (const aoc_view_t * p_line,
+                                         long long *        p_sum)
+{
+    uint8_t retcode = RET_FAILURE;
 
-            memset(buffer, 0, TWO);
-            memcpy(buffer, &p_line[jdx], 1);
-            buffer[1] = '\0';
+    if ((NULL == p_line) || (NULL == p_sum))
+    {
+        printf("ERROR: NULL pointer passed to process_line_part2\n");
+        goto EXIT;
+    }
 
-            num_2 = strtol(buffer, &p_endptr, BASE_10);
-            if (p_endptr == &buffer[0])
-            {
-                printf("ERROR: Unable to parse second number: %d\n", buffer[0]);
-                p_endptr = NULL;
-                goto EXIT;
-            }
+    *p_sum += chal3_select_digits(NULL, p_line->p_data, p_line->length, TWELVE);
+    retcode = RET_SUCCESS;
+EXIT:
+    return retcode;
+}
 
-            sum = num_1 * BASE_10 + num_2;
+/**
+ * @brief Best two-digit value of a line by trying every pair (the reference
+ * chal3_select_digits is checked against for part 1)
+ *
+ * @param p_line The input line
+ *
+ * @return The value, 0 for a line of fewer than two digits
+ */
+long chal3_best_pair_ref (const aoc_view_t * p_line)
+{
+    long max_sum = 0;
+    long sum     = 0;
+
+    for (size_t idx = 0; idx < p_line->length; idx++)
+    {
+        for (size_t jdx = idx + 1; jdx < p_line->length; jdx++)
+        {
+            sum = (p_line->p_data[idx] - '0') * BASE_10
+                  + (p_line->p_data[jdx] - '0');
             if (max_sum < sum)
             {
                 max_sum = sum;
@@ -204,47 +486,32 @@ static uint8_t chal3_process_line_part1 (const char *  p_line,
         }
     }
 
-    p_main_args->solution_1 += max_sum;
-    retcode = RET_SUCCESS;
-EXIT:
-    return retcode;
+    return max_sum;
 }
 
 /**
- * @brief Processes a single line for part 2 solution (sliding window)
+ * @brief Best twelve-digit value of a line with a greedy deque (the
+ * reference chal3_select_digits is checked against for part 2)
  *
- * @param p_line The input line to process
- * @param p_main_args Pointer to the main arguments structure
+ * @param p_line The input line, at most LINE_SIZE digits
  *
- * @return RET_SUCCESS on success, RET_FAILURE on failure
+ * @return The value, all of the line for one shorter than twelve digits
  */
-static uint8_t chal3_process_line_part2 (const char *  p_line,
-                                         main_args_t * p_main_args)
+long long chal3_best_twelve_ref (const aoc_view_t * p_line)
 {
-    uint8_t   retcode          = RET_FAILURE;
     int       deque[LINE_SIZE] = { 0 }; // Deque to store selected digits
     int       front            = 0;     // Front of deque
     int       rear             = -1;    // Rear of deque
     long long result           = 0;     // Result from 12 digits
-    int       line_len         = 0;
+    int       line_len         = (int)p_line->length;
     int       selected_count   = 0;
     int       remaining_digits = 0;
     int       digit            = 0;
     int       full_digits      = 0;
 
-    if ((NULL == p_line) || (NULL == p_main_args))
-    {
-        printf("ERROR: NULL pointer passed to process_line_part2\n");
-        goto EXIT;
-    }
-
-    line_len = strlen(p_line);
-
-    // Greedy algorithm with deque: select 12 largest digits while preserving
-    // order
     for (int idx = 0; idx < line_len; idx++)
     {
-        digit = p_line[idx] - '0'; // This is certainly not allowed in Barr C
+        digit            = p_line->p_data[idx] - '0';
         selected_count   = rear - front + 1;
         remaining_digits = line_len - idx - 1;
 
@@ -263,7 +530,6 @@ static uint8_t chal3_process_line_part2 (const char *  p_line,
         }
     }
 
-    // Build result from selected 12 digits
     full_digits = (rear - front + 1 > TWELVE) ? TWELVE : (rear - front + 1);
 
     for (int idx = front; idx < front + full_digits; idx++)
@@ -271,72 +537,354 @@ static uint8_t chal3_process_line_part2 (const char *  p_line,
         result = result * BASE_10 + deque[idx];
     }
 
-    p_main_args->solution_2 += result;
-    retcode = RET_SUCCESS;
-EXIT:
-    return retcode;
+    return result;
 }
 
+#ifndef AOC_RUNNER
 /**
- * @brief Main function for Advent of Code 2025 Challenge 3
+ * @brief Releases the line views and the input so the phases can run again
+ *
+ * @param p_ctx Pointer to the main arguments structure
  *
- * @return int Exit code
+ * @return RET_SUCCESS
  */
-int main (void)
+static uint8_t chal3_reset (void * p_ctx)
 {
-    int retcode = 0;
+    main_args_t * p_main_args = p_ctx;
 
-    main_args_t * p_main_args = malloc(sizeof(main_args_t));
+    aoc_arena_reset(&p_main_args->arena);
+    aoc_input_close(&p_main_args->input);
+    p_main_args->p_lines    = NULL;
+    p_main_args->line_count = 0;
+
+    return RET_SUCCESS;
+}
+#endif /* AOC_RUNNER */
+
+/**
+ * @brief Copies one bank line into a record: its length, then its digits
+ * (pipeline parser)
+ *
+ * @param p_ctx Unused
+ * @param line Line of the input
+ * @param p_out Where the record is emitted
+ *
+ * @return AOC_SUCCESS on success, AOC_FAILURE on failure
+ */
+static uint8_t chal3_pipe_parse (void *           p_ctx,
+                                 aoc_view_t       line,
+                                 aoc_pipe_out_t * p_out)
+{
+    uint8_t * p_record = aoc_pipe_emit(p_out, sizeof(size_t) + line.length);
+
+    (void)p_ctx;
+
+    if (NULL == p_record)
+    {
+        return AOC_FAILURE;
+    }
+
+    // Records are packed, so the length may be unaligned
+    memcpy(p_record, &line.length, sizeof(size_t));
+    memcpy(p_record + sizeof(size_t), line.p_data, line.length);
+
+    return AOC_SUCCESS;
+}
+
+/**
+ * @brief Adds the best two- and twelve-digit values of a batch of bank lines
+ * (pipeline solver)
+ *
+ * @param p_ctx Pointer to the main arguments structure
+ * @param p_batch Length-prefixed bank lines
+ *
+ * @return AOC_SUCCESS on success, AOC_FAILURE on failure
+ */
+static uint8_t chal3_pipe_solve (void * p_ctx, const aoc_pipe_batch_t * p_batch)
+{
+    main_args_t *   p_main_args = p_ctx;
+    const uint8_t * p_record    = p_batch->p_data;
+    aoc_view_t      line        = { 0 };
+
+    AOC_TRACE_SCOPE_ARG("batch", p_batch->count);
+
+    for (size_t idx = 0; idx < p_batch->count; idx++)
+    {
+        memcpy(&line.length, p_record, sizeof(size_t));
+        line.p_data = (const char *)p_record + sizeof(size_t);
+        p_record += sizeof(size_t) + line.length;
+
+        if ((RET_SUCCESS
+             != chal3_process_line_part1(&line, &p_main_args->solution_1))
+            || (RET_SUCCESS
+                != chal3_process_line_part2(&line, &p_main_args->solution_2)))
+        {
+            return AOC_FAILURE;
+        }
+    }
+
+    return AOC_SUCCESS;
+}
+
+/**
+ * @brief Solves both parts while the input is still being read (-p)
+ *
+ * Reading, splitting lines and solving run on three threads, so stdin never
+ * has to be held whole.
+ *
+ * @param p_main_args Pointer to the main arguments structure
+ *
+ * @return RET_SUCCESS on success, RET_FAILURE on failure
+ */
+uint8_t chal3_solve_pipelined (main_args_t * p_main_args)
+{
+    aoc_pipe_t pipe = {
+        .p_file_path = p_main_args->p_file_path,
+        .p_delims    = LINE_DELIMS,
+        .p_parse     = chal3_pipe_parse,
+        .p_solve     = chal3_pipe_solve,
+        .p_ctx       = p_main_args,
+    };
+
+    p_main_args->solution_1 = 0;
+    p_main_args->solution_2 = 0;
+
+    return (AOC_SUCCESS == aoc_pipe_run(&pipe)) ? RET_SUCCESS : RET_FAILURE;
+}
+
+#ifndef AOC_RUNNER
+/**
+ * @brief Benchmark adapters from the phase functions to aoc_bench_fn_t
+ */
+static uint8_t chal3_bench_load (void * p_ctx)
+{
+    return chal3_load_input(p_ctx);
+}
+
+static uint8_t chal3_bench_parse (void * p_ctx)
+{
+    return chal3_parse_input(p_ctx);
+}
+
+static uint8_t chal3_bench_part1 (void * p_ctx)
+{
+    return chal3_solve_part1(p_ctx);
+}
+
+static uint8_t chal3_bench_part2 (void * p_ctx)
+{
+    return chal3_solve_part2(p_ctx);
+}
+
+/**
+ * @brief Times the load, parse, part 1 and part 2 phases (-b [runs])
+ *
+ * @param p_main_args Pointer to the main arguments structure
+ * @param runs Number of timed runs
+ *
+ * @return RET_SUCCESS on success, RET_FAILURE on failure
+ */
+static uint8_t chal3_bench (main_args_t * p_main_args, size_t runs)
+{
+    static const aoc_bench_phase_t phases[] = {
+        { "load", chal3_bench_load },
+        { "parse", chal3_bench_parse },
+        { "part1", chal3_bench_part1 },
+        { "part2", chal3_bench_part2 },
+    };
+
+    aoc_bench_t bench = {
+        .p_name      = "chal3",
+        .p_file_path = p_main_args->p_file_path,
+        .p_phases    = phases,
+        .phase_count = sizeof(phases) / sizeof(phases[0]),
+        .p_reset     = chal3_reset,
+        .p_ctx       = p_main_args,
+        .runs        = runs,
+        .warmup      = AOC_BENCH_WARMUP,
+    };
+
+    return (AOC_SUCCESS == aoc_bench_run(&bench)) ? RET_SUCCESS : RET_FAILURE;
+}
+#endif /* AOC_RUNNER */
+
+/**
+ * @brief Solves both parts of an input (aoc_day_fn_t, used by the runner)
+ *
+ * @param p_file_path Input file, "-" for stdin
+ * @param p_cache Result cache, NULL to bypass it
+ * @param p_result Receives the solutions
+ *
+ * @return RET_SUCCESS on success, RET_FAILURE on failure
+ */
+uint8_t chal3_run (const char *       p_file_path,
+                   aoc_cache_t *      p_cache,
+                   aoc_day_result_t * p_result)
+{
+    uint8_t         retcode = RET_FAILURE;
+    aoc_cache_key_t key     = { DAY_NUMBER, SOLVER_VERSION, "", 0, 0 };
+
+    main_args_t * p_main_args = calloc(1, sizeof(main_args_t));
     if (NULL == p_main_args)
     {
         perror("ERROR: Unable to allocate memory for main args\n");
         goto EXIT;
     }
 
-    p_main_args->solution_1 = 0;
-    p_main_args->solution_2 = 0;
-    p_main_args->pp_lines   = NULL;
-    p_main_args->line_count = 0;
+    p_main_args->p_file_path = p_file_path;
+    aoc_arena_init(&p_main_args->arena, 0);
+    p_result->b_cached = false;
 
     // Load input file
-    if (RET_FAILURE == chal3_load_input(FILE_PATH, p_main_args))
+    if (RET_SUCCESS != chal3_load_input(p_main_args))
+    {
+        perror("ERROR: Unable to load input file\n");
+        goto CLEAN;
+    }
+
+    // Same input, same answers: skip parsing and solving
+    if (true == aoc_cache_lookup(p_cache, &key, &p_main_args->input, p_result))
+    {
+        retcode = RET_SUCCESS;
+        goto CLEAN;
+    }
+
+    if (RET_SUCCESS != chal3_parse_input(p_main_args))
     {
         perror("ERROR: Unable to load input file\n");
         goto CLEAN;
     }
 
+#ifdef DEBUG
+    aoc_arena_print(&p_main_args->arena, "parse");
+#endif
+
     // Process input file to get solutions
-    if (RET_FAILURE == chal3_process_input(p_main_args))
+    if ((RET_SUCCESS != chal3_solve_part1(p_main_args))
+        || (RET_SUCCESS != chal3_solve_part2(p_main_args)))
     {
         perror("ERROR: Unable to process input file\n");
         goto CLEAN;
     }
 
-    printf("Solution 1: %ld\n", p_main_args->solution_1);
-    printf("Solution 2: %lld\n", p_main_args->solution_2);
+    p_result->part1 = p_main_args->solution_1;
+    p_result->part2 = p_main_args->solution_2;
+    retcode         = RET_SUCCESS;
 
-    retcode = 1;
+    // An unwritable cache only warns, the answers stand
+    (void)aoc_cache_store(p_cache, &key, p_result);
 
 CLEAN:
-    if (NULL != p_main_args)
+    aoc_arena_free(&p_main_args->arena);
+    aoc_input_close(&p_main_args->input);
+    free(p_main_args);
+
+EXIT:
+    return retcode;
+}
+
+// The runner (Runner/) links chal3_run and brings its own main
+#ifndef AOC_RUNNER
+/**
+ * @brief Main function for Advent of Code 2025 Challenge 3
+ *
+ * @param argc Argument count
+ * @param argv Argument vector
+ *
+ * @return 0 on success, 1 on failure
+ */
+int main (int argc, char ** argv)
+{
+    int              retcode    = 1;
+    bool             b_bench    = false;
+    bool             b_pipe     = false;
+    bool             b_no_cache = false;
+    size_t           runs       = 0;
+    const char *     p_snap     = NULL;
+    aoc_day_result_t result     = { 0 };
+    aoc_cache_t      cache;
+    aoc_cache_t *    p_cache    = NULL;
+
+    main_args_t * p_main_args = malloc(sizeof(main_args_t));
+    if (NULL == p_main_args)
+    {
+        perror("ERROR: Unable to allocate memory for main args\n");
+        goto EXIT;
+    }
+
+    memset(p_main_args, 0, sizeof(main_args_t));
+    p_main_args->p_file_path = FILE_PATH;
+    aoc_arena_init(&p_main_args->arena, 0);
+
+    if (AOC_SUCCESS
+        != aoc_bench_args(argc,
+                          argv,
+                          &b_bench,
+                          &runs,
+                          &b_pipe,
+                          &b_no_cache,
+                          &p_snap,
+                          &p_main_args->p_file_path))
+    {
+        goto CLEAN;
+    }
+
+    if (NULL != p_snap)
+    {
+        retcode = (RET_SUCCESS == chal3_write_snapshot(p_main_args, p_snap))
+                      ? 0
+                      : 1;
+        goto CLEAN;
+    }
+
+    if (true == b_bench)
+    {
+        retcode = (RET_SUCCESS == chal3_bench(p_main_args, runs)) ? 0 : 1;
+        goto CLEAN;
+    }
+
+    if (true == b_pipe)
     {
-        if (NULL != p_main_args->pp_lines)
+        if (RET_SUCCESS != chal3_solve_pipelined(p_main_args))
         {
-            for (int idx = 0; idx < p_main_args->line_count; idx++)
-            {
-                if (NULL != p_main_args->pp_lines[idx])
-                {
-                    free(p_main_args->pp_lines[idx]);
-                }
-            }
-            free(p_main_args->pp_lines);
+            goto CLEAN;
+        }
+
+        result.part1 = p_main_args->solution_1;
+        result.part2 = p_main_args->solution_2;
+    }
+    else
+    {
+        // Without a usable cache directory, solve uncached
+        if ((false == b_no_cache) && (AOC_SUCCESS == aoc_cache_init(&cache, NULL)))
+        {
+            p_cache = &cache;
         }
+
+        if (RET_SUCCESS != chal3_run(p_main_args->p_file_path, p_cache, &result))
+        {
+            goto CLEAN;
+        }
+    }
+
+    printf("Solution 1: %lld\n", (long long)result.part1);
+    printf("Solution 2: %lld\n", (long long)result.part2);
+    aoc_cache_report(p_cache);
+
+    retcode = 0;
+
+CLEAN:
+    if (NULL != p_main_args)
+    {
+        aoc_arena_free(&p_main_args->arena);
+        aoc_input_close(&p_main_args->input);
         free(p_main_args);
     }
 
 EXIT:
     return retcode;
 }
+#endif /* AOC_RUNNER */
 
 /** END OF FILE **/
 
@@ -0,0 +1,318 @@
+/**
+ * @file chal3_simd.c
+ *
+ * @brief Advent of Code 2025 Challenge 3 digit-picking kernels, one per CPU
+ * level
+ *
+ * The best value of a bank is built greedily, each digit being the first
+ * largest one that still leaves room for the rest, so nearly all the work is
+ * finding the first largest byte of a window. The vector variants compare
+ * 16, 32 or 64 bytes a step, stop at the first '9' (nothing beats it) and
+ * otherwise keep a running byte maximum, then let memchr find its first
+ * place. The variant is bound once at startup from aoc_cpu_level.
+ *
+ * @author Mexeck88
+ *
+ * @date 18OCT26
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include "chal3_simd.h"
+
+#if AOC_CPU_X86
+#include <immintrin.h>
+#endif
+
+#define DIGIT_MAX  '9'
+#define DIGIT_BASE 10
+
+/**
+ * @brief Plain C kernel, also the tail of the SSE4.2 and AVX2 ones
+ *
+ * @param p_data Bytes to search
+ * @param length Number of bytes, not 0
+ *
+ * @return Index of the first '9', else of the first largest byte
+ */
+static size_t chal3_pick_scalar (const char * p_data, size_t length)
+{
+    const uint8_t * p_bytes = (const uint8_t *)p_data;
+    size_t          best    = 0;
+
+    for (size_t idx = 0; idx < length; idx++)
+    {
+        if (DIGIT_MAX == p_bytes[idx])
+        {
+            return idx;
+        }
+
+        if (p_bytes[idx] > p_bytes[best])
+        {
+            best = idx;
+        }
+    }
+
+    return best;
+}
+
+#if AOC_CPU_X86
+/**
+ * @brief First place of the largest of a block maximum and a tail's best
+ * byte
+ *
+ * @param p_data Bytes searched
+ * @param length Number of bytes
+ * @param block_max Largest byte of the vector blocks, 0 if none
+ * @param tail Index of the tail's pick, length if there was no tail
+ *
+ * @return Index of the first largest byte
+ */
+static size_t chal3_pick_merge (const char * p_data,
+                                size_t       length,
+                                uint8_t      block_max,
+                                size_t       tail)
+{
+    const uint8_t * p_bytes = (const uint8_t *)p_data;
+
+    if ((tail < length) && (p_bytes[tail] > block_max))
+    {
+        return tail;
+    }
+
+    // The blocks come first, so their maximum's first place wins ties
+    return (size_t)((const uint8_t *)memchr(p_data, block_max, length) - p_bytes);
+}
+
+/**
+ * @brief SSE4.2 kernel: 16 bytes per step
+ */
+AOC_CPU_TARGET_SSE42 static size_t chal3_pick_sse42 (const char * p_data,
+                                                     size_t       length)
+{
+    const __m128i nine   = _mm_set1_epi8(DIGIT_MAX);
+    __m128i       best   = _mm_setzero_si128();
+    size_t        blocks = length & ~(size_t)15;
+    size_t        tail   = length;
+
+    for (size_t idx = 0; idx < blocks; idx += 16)
+    {
+        __m128i block = _mm_loadu_si128((const __m128i *)(p_data + idx));
+        int     hits  = _mm_movemask_epi8(_mm_cmpeq_epi8(block, nine));
+
+        if (0 != hits)
+        {
+            return idx + (size_t)__builtin_ctz((unsigned)hits);
+        }
+
+        best = _mm_max_epu8(best, block);
+    }
+
+    if (0 == blocks)
+    {
+        return chal3_pick_scalar(p_data, length);
+    }
+
+    if (blocks < length)
+    {
+        tail = blocks + chal3_pick_scalar(p_data + blocks, length - blocks);
+
+        if (DIGIT_MAX == (uint8_t)p_data[tail])
+        {
+            return tail;
+        }
+    }
+
+    best = _mm_max_epu8(best, _mm_srli_si128(best, 8));
+    best = _mm_max_epu8(best, _mm_srli_si128(best, 4));
+    best = _mm_max_epu8(best, _mm_srli_si128(best, 2));
+    best = _mm_max_epu8(best, _mm_srli_si128(best, 1));
+
+    return chal3_pick_merge(p_data,
+                            length,
+                            (uint8_t)_mm_cvtsi128_si32(best),
+                            tail);
+}
+
+/**
+ * @brief AVX2 kernel: 32 bytes per step
+ */
+AOC_CPU_TARGET_AVX2 static size_t chal3_pick_avx2 (const char * p_data,
+                                                   size_t       length)
+{
+    const __m256i nine   = _mm256_set1_epi8(DIGIT_MAX);
+    __m256i       best   = _mm256_setzero_si256();
+    __m128i       half   = _mm_setzero_si128();
+    size_t        blocks = length & ~(size_t)31;
+    size_t        tail   = length;
+
+    for (size_t idx = 0; idx < blocks; idx += 32)
+    {
+        __m256i  block = _mm256_loadu_si256((const __m256i *)(p_data + idx));
+        uint32_t hits  = (uint32_t)_mm256_movemask_epi8(
+            _mm256_cmpeq_epi8(block, nine));
+
+        if (0 != hits)
+        {
+            return idx + (size_t)__builtin_ctz(hits);
+        }
+
+        best = _mm256_max_epu8(best, block);
+    }
+
+    if (0 == blocks)
+    {
+        return chal3_pick_scalar(p_data, length);
+    }
+
+    if (blocks < length)
+    {
+        tail = blocks + chal3_pick_scalar(p_data + blocks, length - blocks);
+
+        if (DIGIT_MAX == (uint8_t)p_data[tail])
+        {
+            return tail;
+        }
+    }
+
+    half = _mm_max_epu8(_mm256_castsi256_si128(best),
+                        _mm256_extracti128_si256(best, 1));
+    half = _mm_max_epu8(half, _mm_srli_si128(half, 8));
+    half = _mm_max_epu8(half, _mm_srli_si128(half, 4));
+    half = _mm_max_epu8(half, _mm_srli_si128(half, 2));
+    half = _mm_max_epu8(half, _mm_srli_si128(half, 1));
+
+    return chal3_pick_merge(p_data,
+                            length,
+                            (uint8_t)_mm_cvtsi128_si32(half),
+                            tail);
+}
+
+/**
+ * @brief AVX-512 kernel: 64 bytes per step, the tail through a masked load
+ * so no scalar loop is needed
+ */
+AOC_CPU_TARGET_AVX512 static size_t chal3_pick_avx512 (const char * p_data,
+                                                       size_t       length)
+{
+    const __m512i nine = _mm512_set1_epi8(DIGIT_MAX);
+    __m512i       best = _mm512_setzero_si512();
+    __m256i       quad = _mm256_setzero_si256();
+    __m128i       half = _mm_setzero_si128();
+
+    for (size_t idx = 0; idx < length; idx += 64)
+    {
+        // Masked-off bytes read as 0 and never fault
+        __mmask64 valid = (64 <= length - idx)
+                              ? ~(__mmask64)0
+                              : (((__mmask64)1 << (length - idx)) - 1);
+        __m512i   block = _mm512_maskz_loadu_epi8(valid, p_data + idx);
+        __mmask64 hits  = _mm512_cmpeq_epi8_mask(block, nine);
+
+        if (0 != hits)
+        {
+            return idx + (size_t)__builtin_ctzll(hits);
+        }
+
+        best = _mm512_max_epu8(best, block);
+    }
+
+    quad = _mm256_max_epu8(_mm512_castsi512_si256(best),
+                           _mm512_extracti64x4_epi64(best, 1));
+    half = _mm_max_epu8(_mm256_castsi256_si128(quad),
+                        _mm256_extracti128_si256(quad, 1));
+    half = _mm_max_epu8(half, _mm_srli_si128(half, 8));
+    half = _mm_max_epu8(half, _mm_srli_si128(half, 4));
+    half = _mm_max_epu8(half, _mm_srli_si128(half, 2));
+    half = _mm_max_epu8(half, _mm_srli_si128(half, 1));
+
+    return chal3_pick_merge(p_data,
+                            length,
+                            (uint8_t)_mm_cvtsi128_si32(half),
+                            length);
+}
+#endif /* AOC_CPU_X86 */
+
+#if AOC_CPU_X86
+static const chal3_pick_fn_t g_pick_variants[AOC_CPU_LEVELS] = {
+    chal3_pick_scalar,
+    chal3_pick_sse42,
+    chal3_pick_avx2,
+    chal3_pick_avx512,
+};
+#else
+static const chal3_pick_fn_t g_pick_variants[AOC_CPU_LEVELS] = {
+    chal3_pick_scalar,
+    chal3_pick_scalar,
+    chal3_pick_scalar,
+    chal3_pick_scalar,
+};
+#endif
+
+static chal3_pick_fn_t gp_pick = chal3_pick_scalar;
+
+/**
+ * @brief Binds the kernel to the variant for this CPU, before main runs
+ */
+__attribute__((constructor)) static void chal3_simd_init (void)
+{
+    gp_pick = g_pick_variants[aoc_cpu_level()];
+}
+
+/**
+ * @brief Largest number made of some digits of a line, kept in order
+ *
+ * Each digit is the first largest one that still leaves enough digits after
+ * it for the rest.
+ *
+ * @param p_pick Kernel finding each digit, NULL for the bound one
+ * @param p_data Digits of the line
+ * @param length Number of digits
+ * @param digits Digits to pick, all of the line if it is shorter
+ *
+ * @return The number
+ */
+long long chal3_select_digits (chal3_pick_fn_t p_pick,
+                               const char *    p_data,
+                               size_t          length,
+                               size_t          digits)
+{
+    long long result = 0;
+    size_t    start  = 0;
+    size_t    pick   = 0;
+
+    if (NULL == p_pick)
+    {
+        p_pick = gp_pick;
+    }
+
+    if (digits > length)
+    {
+        digits = length;
+    }
+
+    for (size_t left = digits; left > 0; left--)
+    {
+        pick   = start + p_pick(&p_data[start], length - start - (left - 1));
+        result = result * DIGIT_BASE + (p_data[pick] - '0');
+        start  = pick + 1;
+    }
+
+    return result;
+}
+
+/**
+ * @brief Kernel of a given level, whatever the CPU, for checking the
+ * variants against each other
+ *
+ * @param level Level of the variant, which the CPU must support to run it
+ *
+ * @return The variant, NULL for a level out of range
+ */
+chal3_pick_fn_t chal3_pick_variant (aoc_cpu_level_t level)
+{
+    return ((unsigned)level < AOC_CPU_LEVELS) ? g_pick_variants[level] : NULL;
+}
+
+/** END OF FILE **/
\ No newline at end of file
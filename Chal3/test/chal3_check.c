@@ -0,0 +1,303 @@
+/**
+ * @file chal3_check.c
+ *
+ * @brief Differential check of the Advent of Code 2025 Challenge 3 solvers
+ *
+ * Random bank lines, some with few distinct digits, without a '9' or with a
+ * '9' here and there, are valued by the pair search and the greedy deque
+ * (chal3_best_pair_ref and chal3_best_twelve_ref). That is compared with the
+ * digit selection on every kernel the CPU runs, the whole solver on the text
+ * and the pipelined solver.
+ * Usage: chal3_check [-n cases] [-S seed] [-o file]
+ *
+ * @author Mexeck88
+ *
+ * @date 18OCT26
+ */
+
+#include <unistd.h>
+
+#include "aoc_check.h"
+#include "chal3.h"
+
+#define CHECK_LINES 32 // Most lines per case
+#define CHECK_SHORT 16 // Longest short line, around the twelve picked
+#define CHECK_NAME  32
+
+/**
+ * @struct chal3_check_line_t
+ * @brief One bank line of a case
+ */
+typedef struct chal3_check_line_t
+{
+    size_t length; // At least 1, at most LINE_SIZE
+    char   digits[LINE_SIZE];
+} chal3_check_line_t;
+
+static bool chal3_check_case (const aoc_check_case_t * p_case,
+                              char *                   p_why,
+                              size_t                   why_size);
+static void chal3_check_generate (aoc_rng_t * p_rng, aoc_check_case_t * p_case);
+static bool chal3_check_simplify (void * p_item, size_t step);
+static void chal3_check_print (const aoc_check_case_t * p_case, FILE * p_out);
+
+static const aoc_check_t g_check = {
+    .p_name     = "chal3",
+    .item_size  = sizeof(chal3_check_line_t),
+    .max_items  = CHECK_LINES,
+    .p_generate = chal3_check_generate,
+    .p_check    = chal3_check_case,
+    .p_simplify = chal3_check_simplify,
+    .p_merge    = NULL,
+    .p_print    = chal3_check_print,
+};
+
+/**
+ * @brief Draws random bank lines: any digits, two digits only, no '9', or
+ * low digits with a '9' here and there, short or up to LINE_SIZE long
+ *
+ * @param p_rng Seeded generator
+ * @param p_case Empty case to fill
+ */
+static void chal3_check_generate (aoc_rng_t * p_rng, aoc_check_case_t * p_case)
+{
+    chal3_check_line_t * p_lines = p_case->p_items;
+    size_t               count   = aoc_rng_below(p_rng, p_case->capacity + 1);
+    uint64_t             mode    = 0;
+    char                 pair[2] = { 0 };
+
+    for (size_t idx = 0; idx < count; idx++)
+    {
+        chal3_check_line_t * p_line = &p_lines[idx];
+
+        p_line->length = (0 == aoc_rng_below(p_rng, 2))
+                             ? 1 + aoc_rng_below(p_rng, CHECK_SHORT)
+                             : 1 + aoc_rng_below(p_rng, LINE_SIZE);
+        mode           = aoc_rng_below(p_rng, 4);
+        pair[0]        = (char)('1' + aoc_rng_below(p_rng, 9));
+        pair[1]        = (char)('1' + aoc_rng_below(p_rng, 9));
+
+        for (size_t digit = 0; digit < p_line->length; digit++)
+        {
+            switch (mode)
+            {
+                case 0:
+                    p_line->digits[digit]
+                        = (char)('1' + aoc_rng_below(p_rng, 9));
+                    break;
+
+                case 1:
+                    p_line->digits[digit] = pair[aoc_rng_below(p_rng, 2)];
+                    break;
+
+                case 2:
+                    p_line->digits[digit]
+                        = (char)('1' + aoc_rng_below(p_rng, 8));
+                    break;
+
+                default:
+                    p_line->digits[digit]
+                        = (0 == aoc_rng_below(p_rng, 16))
+                              ? '9'
+                              : (char)('1' + aoc_rng_below(p_rng, 4));
+                    break;
+            }
+        }
+    }
+
+    p_case->count = count;
+}
+
+/**
+ * @brief Simplifies a line: to either half, one digit fewer, or one digit
+ * lower
+ *
+ * @param p_item Line to simplify
+ * @param step Which way: 0 and 1 the halves, then each digit removed, then
+ * each digit lowered
+ *
+ * @return false once step is past the last way
+ */
+static bool chal3_check_simplify (void * p_item, size_t step)
+{
+    chal3_check_line_t * p_line = p_item;
+    size_t               half   = p_line->length / 2;
+
+    if (2 > step)
+    {
+        if (0 < half)
+        {
+            if (1 == step)
+            {
+                memmove(p_line->digits,
+                        &p_line->digits[half],
+                        p_line->length - half);
+            }
+            p_line->length -= half;
+        }
+        return true;
+    }
+
+    step -= 2;
+    if (step < p_line->length)
+    {
+        if (1 < p_line->length)
+        {
+            memmove(&p_line->digits[step],
+                    &p_line->digits[step + 1],
+                    p_line->length - step - 1);
+            p_line->length--;
+        }
+        return true;
+    }
+
+    step -= p_line->length;
+    if (step < p_line->length)
+    {
+        if ('1' < p_line->digits[step])
+        {
+            p_line->digits[step]--;
+        }
+        return true;
+    }
+
+    return false;
+}
+
+/**
+ * @brief Writes lines as input lines
+ *
+ * @param p_case Case to write
+ * @param p_out Where to write it
+ */
+static void chal3_check_print (const aoc_check_case_t * p_case, FILE * p_out)
+{
+    const chal3_check_line_t * p_lines = p_case->p_items;
+
+    for (size_t idx = 0; idx < p_case->count; idx++)
+    {
+        fprintf(p_out,
+                "%.*s\n",
+                (int)p_lines[idx].length,
+                p_lines[idx].digits);
+    }
+}
+
+/**
+ * @brief Runs every solver on a case and compares it with the reference
+ *
+ * @param p_case Lines to check
+ * @param p_why Receives the first mismatch
+ * @param why_size Size of p_why
+ *
+ * @return true if every solver agrees with the reference
+ */
+static bool chal3_check_case (const aoc_check_case_t * p_case,
+                              char *                   p_why,
+                              size_t                   why_size)
+{
+    bool                       b_retval  = false;
+    const chal3_check_line_t * p_lines   = p_case->p_items;
+    aoc_view_t                 line      = { 0 };
+    chal3_pick_fn_t            p_pick    = NULL;
+    long long                  pair      = 0;
+    long long                  twelve    = 0;
+    int                        fd        = -1;
+    char                       path[AOC_CHECK_PATH];
+    char                       name[CHECK_NAME];
+    main_args_t                main_args = { 0 };
+    aoc_day_result_t           want      = { 0 };
+    aoc_day_result_t           got       = { 0 };
+
+    // Reference, then the selection on every kernel this CPU can run
+    for (size_t idx = 0; idx < p_case->count; idx++)
+    {
+        line.p_data = p_lines[idx].digits;
+        line.length = p_lines[idx].length;
+        pair        = chal3_best_pair_ref(&line);
+        twelve      = chal3_best_twelve_ref(&line);
+        want.part1 += pair;
+        want.part2 += twelve;
+
+        for (int level = 0; level <= (int)aoc_cpu_detect(); level++)
+        {
+            p_pick = chal3_pick_variant(level);
+            snprintf(name, sizeof(name), "%s kernel", aoc_cpu_name(level));
+
+            if (((TWO <= line.length)
+                 && (false
+                     == aoc_check_equal(name,
+                                        "picking two",
+                                        chal3_select_digits(p_pick,
+                                                            line.p_data,
+                                                            line.length,
+                                                            TWO),
+                                        pair,
+                                        p_why,
+                                        why_size)))
+                || (false
+                    == aoc_check_equal(name,
+                                       "picking twelve",
+                                       chal3_select_digits(p_pick,
+                                                           line.p_data,
+                                                           line.length,
+                                                           TWELVE),
+                                       twelve,
+                                       p_why,
+                                       why_size)))
+            {
+                goto EXIT;
+            }
+        }
+    }
+
+    // Whole and pipelined solvers on the text
+    fd = aoc_check_text(&g_check, p_case, path, sizeof(path));
+    if (0 > fd)
+    {
+        snprintf(p_why, why_size, "unable to write the input");
+        goto EXIT;
+    }
+
+    if (RET_SUCCESS != chal3_run(path, NULL, &got))
+    {
+        snprintf(p_why, why_size, "chal3_run failed");
+        goto EXIT;
+    }
+
+    if (false == aoc_check_result("chal3_run", &got, &want, p_why, why_size))
+    {
+        goto EXIT;
+    }
+
+    main_args.p_file_path = path;
+    if (RET_SUCCESS != chal3_solve_pipelined(&main_args))
+    {
+        snprintf(p_why, why_size, "pipelined solver failed");
+        goto EXIT;
+    }
+
+    got.part1 = main_args.solution_1;
+    got.part2 = main_args.solution_2;
+    if (false
+        == aoc_check_result("pipelined solver", &got, &want, p_why, why_size))
+    {
+        goto EXIT;
+    }
+
+    b_retval = true;
+EXIT:
+    if (0 <= fd)
+    {
+        close(fd);
+    }
+
+    return b_retval;
+}
+
+int main (int argc, char ** argv)
+{
+    return aoc_check_main(&g_check, argc, argv);
+}
+
+/** END OF FILE **/
\ No newline at end of file
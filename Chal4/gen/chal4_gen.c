@@ -0,0 +1,160 @@
+/**
+ * @file chal4_gen.c
+ *
+ * @brief Input generator for Challenge 4: a grid of paper rolls ('@') and
+ * empty cells ('.')
+ *
+ * Usage: chal4_gen [-n rows | -s size] [-S seed] [-o output] [-w width]
+ * [-p density_percent]
+ *
+ * Rows are written one at a time, so only the width has to fit in memory.
+ * The default matches the checked-in input: 140 by 140 at 64% rolls.
+ *
+ * @author Mexeck88
+ *
+ * @date 18OCT26
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "aoc_gen.h"
+#include "aoc_input.h"
+
+/**
+ * @enum gen_info_t
+ * @brief Generator defaults
+ */
+typedef enum gen_info_t
+{
+    DEFAULT_ROWS    = 140,
+    DEFAULT_WIDTH   = 140,
+    DEFAULT_DENSITY = 64,
+    PERCENT         = 100,
+} gen_info_t;
+
+/**
+ * @struct gen_args_t
+ * @brief Generator options
+ */
+typedef struct gen_args_t
+{
+    aoc_gen_args_t common;
+    uint64_t       width;
+    uint64_t       density; // Percent of cells holding a roll
+} gen_args_t;
+
+/**
+ * @brief Parses the command line
+ *
+ * @param argc Argument count
+ * @param argv Argument vector
+ * @param p_args Options to fill in
+ *
+ * @return true on success, false on a bad command line
+ */
+static bool
+gen_parse_args (int argc, char ** argv, gen_args_t * p_args)
+{
+    int option = 0;
+
+    aoc_gen_args_init(&p_args->common, DEFAULT_ROWS);
+    p_args->width   = DEFAULT_WIDTH;
+    p_args->density = DEFAULT_DENSITY;
+
+    while (-1 != (option = getopt(argc, argv, AOC_GEN_OPTIONS "w:p:")))
+    {
+        switch (aoc_gen_option(&p_args->common, option, optarg))
+        {
+            case AOC_GEN_OPT_USED:
+                continue;
+            case AOC_GEN_OPT_BAD:
+                return false;
+            default:
+                break;
+        }
+
+        switch (option)
+        {
+            case 'w':
+                if ((false == aoc_gen_parse_size(optarg, &p_args->width))
+                    || (0 == p_args->width))
+                {
+                    printf("ERROR: Width must be positive: %s\n", optarg);
+                    return false;
+                }
+                break;
+
+            case 'p':
+                if ((false == aoc_gen_parse_size(optarg, &p_args->density))
+                    || (PERCENT < p_args->density))
+                {
+                    printf("ERROR: Density must be 0 to 100: %s\n", optarg);
+                    return false;
+                }
+                break;
+
+            default:
+                printf("Usage: %s [-n rows | -s size] [-S seed] [-o output] "
+                       "[-w width] [-p density_percent]\n",
+                       argv[0]);
+                return false;
+        }
+    }
+
+    return true;
+}
+
+int
+main (int argc, char ** argv)
+{
+    int          retcode = 1;
+    gen_args_t   args    = { 0 };
+    aoc_rng_t    rng     = { 0 };
+    aoc_writer_t writer  = { 0 };
+    uint64_t     rows    = 0;
+    char *       p_row   = NULL;
+
+    if ((false == gen_parse_args(argc, argv, &args))
+        || (AOC_SUCCESS != aoc_writer_open(&writer, args.common.p_out)))
+    {
+        goto EXIT;
+    }
+
+    p_row = malloc(args.width + 1);
+    if (NULL == p_row)
+    {
+        perror("ERROR: Unable to allocate row");
+        goto CLEAN;
+    }
+    p_row[args.width] = '\n';
+
+    aoc_rng_seed(&rng, args.common.seed);
+
+    for (rows = 0; true == aoc_gen_more(&args.common, &writer, rows); rows++)
+    {
+        for (uint64_t col = 0; col < args.width; col++)
+        {
+            p_row[col]
+                = (aoc_rng_below(&rng, PERCENT) < args.density) ? '@' : '.';
+        }
+
+        if (AOC_SUCCESS != aoc_writer_put(&writer, p_row, args.width + 1))
+        {
+            goto CLEAN;
+        }
+    }
+
+    retcode = 0;
+CLEAN:
+    free(p_row);
+    if (AOC_SUCCESS != aoc_writer_close(&writer))
+    {
+        retcode = 1;
+    }
+EXIT:
+    return retcode;
+}
+
+/** END OF FILE **/
\ No newline at end of file
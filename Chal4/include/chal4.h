@@ -16,8 +16,18 @@
 #include <stdlib.h>
 #include <stdint.h>
 #include <stdbool.h>
+#include <time.h>
 
-#define FILE_PATH "src/input.txt"
+#include "aoc_bench.h"
+#include "aoc_cache.h"
+#include "aoc_day.h"
+#include "aoc_trace.h"
+#include "chal4_grid.h"
+
+#define FILE_PATH      "src/input.txt"
+#define DEFAULT_RULE   "moore:1:4"
+#define DAY_NUMBER     4
+#define SOLVER_VERSION "1" // Bump when the answers for an input change
 
 /**
  * @enum numbers_t
@@ -28,20 +38,11 @@ typedef enum numbers_t
     TWO     = 2,
     TWELVE  = 12,
     BASE_10 = 10,
-    NEIGHBOR_COUNT = 4
+    NEIGHBOR_COUNT = 4,
+    MS_PER_SEC     = 1000,
+    NS_PER_MS      = 1000000,
 } numbers_t;
 
-/**
- * @enum line_info_t
- * @brief Line information constants
- */
-typedef enum line_info_t
-{
-    LINE_SIZE  = 140, // Actual data size
-    NUM_LINES  = 140, // Number of data lines in input
-    GRID_SIZE  = 142, // 140 + 2 (padding rows/cols)
-} line_info_t;
-
 /**
  * @enum retcode_t
  * @brief Return code constants
@@ -53,24 +54,76 @@ typedef enum retcode_t
     RET_NULL_POINTER = 2,
 } retcode_t;
 
+/**
+ * @enum chal4_engine_t
+ * @brief Solver engines selectable with -m
+ */
+typedef enum chal4_engine_t
+{
+    ENGINE_SERIAL = 0, // Reference full-rescan solver
+    ENGINE_BANDS,      // Multi-threaded row bands (-t)
+    ENGINE_STREAM,     // Part 1 only, three-row ring buffer
+    ENGINE_TILES,      // Dirty-tile active set, per-wave report
+    ENGINE_RULE,       // Configurable neighborhood rule (-r)
+    ENGINE_RULE_BENCH, // Specialized vs generic rule kernel timings
+    ENGINE_EDIT,       // Incremental part 1 count over an edit file (-e)
+    ENGINE_TILED,        // 64 x 64 tiled layout
+    ENGINE_MORTON,       // 64 x 64 tiles in Z-order
+    ENGINE_LAYOUT_BENCH, // Row-major vs tiled vs Morton at several sizes
+    ENGINE_PEEL,         // Lock-free work-stealing peeling (-t)
+    ENGINE_SPARSE,       // Run-length rows
+    ENGINE_AUTO,         // Sparse or serial, picked from the occupancy
+    ENGINE_PIPE,         // Serial solver on a grid loaded by the pipeline
+    ENGINE_POOL,         // Row chunks on a work-stealing pool (-t)
+    ENGINE_COUNT,
+} chal4_engine_t;
+
+/**
+ * @struct chal4_round_stats_t
+ * @brief Rolls removed and wall time of every part 2 round
+ */
+typedef struct chal4_round_stats_t
+{
+    long *   p_removed; // Rolls removed in each round
+    double * p_millis;  // Wall time of each round in milliseconds
+    size_t   count;
+    size_t   capacity;
+} chal4_round_stats_t;
+
 /**
  * @struct main_args_t
- * @brief Main arguments structure containing input lines and solutions
+ * @brief Main arguments structure containing the grid and solutions
  */
 typedef struct main_args_t
 {
-    char ** pp_lines;
-    int     line_count;
-    int     grid[GRID_SIZE][GRID_SIZE]; // 141x141: padding on edges + 139x139 data
-    long    solution_1;
-    long    solution_2;
+    const char *        p_file_path;
+    chal4_engine_t      engine;
+    int                 thread_count; // Threads for threaded engines
+    const char *        p_rule_text;  // Rule for the rule engine (-r)
+    const char *        p_edit_path;  // Edits for the edit engine (-e)
+    size_t              bench_runs;   // Timed runs for -b, 0 to solve once
+    bool                b_no_cache;   // -n: solve even if the answers are cached
+    const char *        p_snap_path;  // -s: write the grid here, don't solve
+    aoc_input_t         input;        // Open input for the benchmark phases
+    aoc_arena_t         arena;        // Owns the parsed input (grid or runs)
+    chal4_grid_t        grid;         // Padded input grid
+    chal4_grid_t        scratch;      // Next-round buffer for part 2
+    chal4_round_stats_t rounds;       // Filled by round-reporting engines
+    long                solution_1;
+    long                solution_2;
 
 } main_args_t;
 
-static uint8_t chal4_load_input (const char *  p_file_path,
-                                 main_args_t * p_main_args);
-static uint8_t chal4_process_input (main_args_t * p_main_args);
-static uint8_t chal4_process_line_part1 (main_args_t * p_main_args);
-// static uint8_t chal4_process_line_part2 (const char *  p_line, main_args_t * p_main_args);
+uint8_t chal4_round_stats_add (chal4_round_stats_t * p_stats,
+                               long                  removed,
+                               double                millis);
+void    chal4_round_stats_print (const chal4_round_stats_t * p_stats);
+void    chal4_round_stats_free (chal4_round_stats_t * p_stats);
+double  chal4_elapsed_ms (const struct timespec * p_start);
+uint8_t chal4_process_line_part1 (main_args_t * p_main_args);
+uint8_t chal4_process_line_part2 (main_args_t * p_main_args);
+uint8_t chal4_run (const char *       p_file_path,
+                   aoc_cache_t *      p_cache,
+                   aoc_day_result_t * p_result);
 
-#endif /* CHAL3_H  */
\ No newline at end of file
+#endif /* CHAL4_H  */
\ No newline at end of file
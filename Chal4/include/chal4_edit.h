@@ -0,0 +1,50 @@
+/**
+ * @file chal4_edit.h
+ *
+ * @brief Incremental cell-edit API for Advent of Code 2025 Challenge 4.
+ *
+ * @author Mexeck88
+ *
+ * @date 18OCT26
+ */
+
+#ifndef CHAL4_EDIT_H
+#define CHAL4_EDIT_H
+
+#include "chal4.h"
+
+/**
+ * @enum edit_info_t
+ * @brief Edit file constants
+ */
+typedef enum edit_info_t
+{
+    EDIT_SET   = '+', // "+ row col" places a roll
+    EDIT_CLEAR = '-', // "- row col" removes a roll
+} edit_info_t;
+
+/**
+ * @struct chal4_edit_state_t
+ * @brief Grid plus per-cell neighbor counts and the live part 1 count
+ */
+typedef struct chal4_edit_state_t
+{
+    chal4_grid_t grid;       // Occupancy, owned by the state
+    chal4_grid_t counts;     // Occupied neighbors of every cell
+    long         accessible; // Rolls with fewer than NEIGHBOR_COUNT neighbors
+} chal4_edit_state_t;
+
+uint8_t chal4_edit_init (chal4_edit_state_t * p_state, chal4_grid_t * p_grid);
+void    chal4_edit_free (chal4_edit_state_t * p_state);
+uint8_t chal4_edit_set_cell (chal4_edit_state_t * p_state,
+                             size_t               row,
+                             size_t               col);
+uint8_t chal4_edit_clear_cell (chal4_edit_state_t * p_state,
+                               size_t               row,
+                               size_t               col);
+uint8_t chal4_edit_apply_file (chal4_edit_state_t * p_state,
+                               const char *         p_file_path);
+
+#endif /* CHAL4_EDIT_H */
+
+/** END OF FILE **/
\ No newline at end of file
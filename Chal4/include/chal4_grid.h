@@ -0,0 +1,103 @@
+/**
+ * @file chal4_grid.h
+ *
+ * @brief Runtime-sized, padded grid used by the Challenge 4 solvers.
+ *
+ * @author Mexeck88
+ *
+ * @date 18OCT26
+ */
+
+#ifndef CHAL4_GRID_H
+#define CHAL4_GRID_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "aoc_arena.h"
+#include "aoc_input.h"
+
+/**
+ * @enum grid_info_t
+ * @brief Grid layout constants
+ */
+typedef enum grid_info_t
+{
+    GRID_BORDER     = 1,   // Empty cells kept around the data on every side
+    CACHE_LINE_SIZE = 64,  // Alignment of the block and of every row
+    INIT_ROWS       = 64,  // Row capacity when the height is not known
+    REALLOC_SCALE   = 2,   // Row capacity growth factor
+    ROLL_CHAR       = '@', // Input character for an occupied cell
+    SNAP_WORD_BITS  = 64,  // Cells per uint64 word of a snapshot row
+} grid_info_t;
+
+/**
+ * @struct chal4_grid_t
+ * @brief One heap block of uint8 cells (0 or 1) with an empty border
+ *
+ * Rows are stride bytes apart and every row starts on a cache line. Data cell
+ * (0, 0) is at p_cells, so the border is reachable through negative offsets.
+ * A block carved from an arena is released with the arena, not the grid.
+ */
+typedef struct chal4_grid_t
+{
+    uint8_t *     p_block; // Aligned allocation, border included
+    uint8_t *     p_cells; // Data cell (0, 0)
+    aoc_arena_t * p_arena; // Owner of p_block, NULL for the heap
+    size_t        width;   // Data columns
+    size_t        height;  // Data rows
+    size_t        stride;  // Bytes between rows, multiple of CACHE_LINE_SIZE
+    size_t        border;  // Empty cells on every side of the data
+} chal4_grid_t;
+
+/**
+ * @brief Returns a pointer to the first data cell of a row
+ */
+#define CHAL4_ROW(p_grid, row) ((p_grid)->p_cells + ((row) * (p_grid)->stride))
+
+uint8_t chal4_grid_alloc (chal4_grid_t * p_grid,
+                          size_t         width,
+                          size_t         height,
+                          size_t         border);
+uint8_t chal4_grid_alloc_arena (chal4_grid_t * p_grid,
+                                size_t         width,
+                                size_t         height,
+                                size_t         border,
+                                aoc_arena_t *  p_arena);
+void    chal4_grid_free (chal4_grid_t * p_grid);
+uint8_t chal4_grid_append_row (chal4_grid_t *  p_grid,
+                               size_t *        p_row_capacity,
+                               const uint8_t * p_cells,
+                               size_t          width);
+void    chal4_grid_seal (chal4_grid_t * p_grid);
+uint8_t chal4_parse_input (aoc_input_t *  p_input,
+                           size_t         border,
+                           aoc_arena_t *  p_arena,
+                           chal4_grid_t * p_grid);
+uint8_t chal4_load_input (const char *   p_file_path,
+                          size_t         border,
+                          aoc_arena_t *  p_arena,
+                          chal4_grid_t * p_grid);
+uint8_t chal4_grid_write_snapshot (const chal4_grid_t * p_grid,
+                                   const char *         p_snap_path);
+size_t  chal4_trim_line (char * p_line, size_t length);
+
+/**
+ * @brief Counts the occupied cells in the 8-neighbor Moore neighborhood
+ *
+ * @param p_cell Pointer to the cell in a padded grid
+ * @param stride Bytes between rows of the grid
+ *
+ * @return Number of occupied neighbors (0 - 8)
+ */
+static inline int
+chal4_check_neighbors (const uint8_t * p_cell, ptrdiff_t stride)
+{
+    return p_cell[-stride - 1] + p_cell[-stride] + p_cell[-stride + 1] // Top
+           + p_cell[-1] + p_cell[1]                                    // Sides
+           + p_cell[stride - 1] + p_cell[stride] + p_cell[stride + 1]; // Bottom
+}
+
+#endif /* CHAL4_GRID_H */
+
+/** END OF FILE **/
\ No newline at end of file
@@ -0,0 +1,83 @@
+/**
+ * @file chal4_layout.h
+ *
+ * @brief Tiled and Morton (Z-order) grid layouts for Advent of Code 2025
+ * Challenge 4.
+ *
+ * @author Mexeck88
+ *
+ * @date 18OCT26
+ */
+
+#ifndef CHAL4_LAYOUT_H
+#define CHAL4_LAYOUT_H
+
+#include "chal4.h"
+
+/**
+ * @enum layout_info_t
+ * @brief Layout tile and benchmark constants
+ */
+typedef enum layout_info_t
+{
+    LAYOUT_TILE_SHIFT   = 6,                         // 64 x 64 cell tiles
+    LAYOUT_TILE_EDGE    = 1 << LAYOUT_TILE_SHIFT,    // Cells per tile edge
+    LAYOUT_TILE_MASK    = LAYOUT_TILE_EDGE - 1,      // In-tile coordinate
+    LAYOUT_TILE_CELLS   = 1 << (2 * LAYOUT_TILE_SHIFT), // 4 KiB per tile
+    LAYOUT_BENCH_PASSES = 10,     // Part 1 passes timed per layout
+} layout_info_t;
+
+/**
+ * @enum chal4_layout_kind_t
+ * @brief Order of the cells inside each 64 x 64 tile
+ */
+typedef enum chal4_layout_kind_t
+{
+    LAYOUT_ROW_MAJOR = 0, // Padded row-major chal4_grid_t (reference)
+    LAYOUT_TILED,         // Row-major inside each tile
+    LAYOUT_MORTON,        // Z-order inside each tile
+    LAYOUT_COUNT,
+} chal4_layout_kind_t;
+
+/**
+ * @struct chal4_layout_t
+ * @brief Grid stored as row-major 64 x 64 tiles of 4 KiB
+ *
+ * Layout coordinates are shifted by one, so (y, x) = (row + 1, col + 1) and
+ * the one-cell border sits at y or x = 0 and y = height + 1, x = width + 1.
+ */
+typedef struct chal4_layout_t
+{
+    chal4_layout_kind_t kind;
+    uint8_t *           p_cells; // tiles_x * tiles_y tiles, page aligned
+    size_t              width;   // Data columns
+    size_t              height;  // Data rows
+    size_t              tiles_x; // Tiles per tile row (border included)
+    size_t              tiles_y; // Tile rows (border included)
+    uint16_t            row_code[LAYOUT_TILE_EDGE]; // In-tile offset of a row
+    uint16_t            col_code[LAYOUT_TILE_EDGE]; // Of a column, OR'd in
+} chal4_layout_t;
+
+uint8_t chal4_layout_from_grid (const chal4_grid_t * p_grid,
+                                chal4_layout_kind_t  kind,
+                                chal4_layout_t *     p_layout);
+uint8_t chal4_layout_alloc_like (const chal4_layout_t * p_model,
+                                 chal4_layout_t *       p_layout);
+void    chal4_layout_free (chal4_layout_t * p_layout);
+size_t  chal4_layout_index (const chal4_layout_t * p_layout,
+                            size_t                 y,
+                            size_t                 x);
+int     chal4_layout_neighbors (const chal4_layout_t * p_layout,
+                                size_t                 y,
+                                size_t                 x);
+long    chal4_layout_pass (const chal4_layout_t * p_layout,
+                           chal4_layout_t *       p_next);
+uint8_t chal4_layout_part2 (chal4_layout_t *      p_layout,
+                            chal4_layout_t *      p_next,
+                            long *                p_removed,
+                            chal4_round_stats_t * p_stats);
+uint8_t chal4_layout_bench (void);
+
+#endif /* CHAL4_LAYOUT_H */
+
+/** END OF FILE **/
\ No newline at end of file
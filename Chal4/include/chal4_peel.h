@@ -0,0 +1,24 @@
+/**
+ * @file chal4_peel.h
+ *
+ * @brief Lock-free parallel peeling for Advent of Code 2025 Challenge 4.
+ *
+ * @author Mexeck88
+ *
+ * @date 18OCT26
+ */
+
+#ifndef CHAL4_PEEL_H
+#define CHAL4_PEEL_H
+
+#include "chal4.h"
+
+uint8_t chal4_peel_run (chal4_grid_t * p_grid,
+                        int            thread_count,
+                        long *         p_accessible,
+                        long *         p_removed,
+                        long *         p_stolen);
+
+#endif /* CHAL4_PEEL_H */
+
+/** END OF FILE **/
\ No newline at end of file
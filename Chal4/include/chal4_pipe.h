@@ -0,0 +1,36 @@
+/**
+ * @file chal4_pipe.h
+ *
+ * @brief Pipelined grid loader for Advent of Code 2025 Challenge 4.
+ *
+ * @author Mexeck88
+ *
+ * @date 18OCT26
+ */
+
+#ifndef CHAL4_PIPE_H
+#define CHAL4_PIPE_H
+
+#include "aoc_pipe.h"
+#include "chal4.h"
+
+#define LINE_DELIMS "\r\n"
+
+/**
+ * @struct chal4_pipe_t
+ * @brief Solver-side state of a pipelined load
+ */
+typedef struct chal4_pipe_t
+{
+    chal4_grid_t * p_grid;       // Grid the rows are appended to
+    size_t         row_capacity; // Rows the grid has room for
+} chal4_pipe_t;
+
+uint8_t chal4_pipe_load_input (const char *   p_file_path,
+                               size_t         border,
+                               aoc_arena_t *  p_arena,
+                               chal4_grid_t * p_grid);
+
+#endif /* CHAL4_PIPE_H */
+
+/** END OF FILE **/
\ No newline at end of file
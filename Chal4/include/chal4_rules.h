@@ -0,0 +1,95 @@
+/**
+ * @file chal4_rules.h
+ *
+ * @brief Configurable neighborhood rules for Advent of Code 2025 Challenge 4.
+ *
+ * @author Mexeck88
+ *
+ * @date 18OCT26
+ */
+
+#ifndef CHAL4_RULES_H
+#define CHAL4_RULES_H
+
+#include <stddef.h>
+
+#include "chal4.h"
+
+/**
+ * @enum rule_info_t
+ * @brief Rule limits and benchmark settings
+ */
+typedef enum rule_info_t
+{
+    RULE_RADIUS_MAX   = 2,  // Largest supported neighborhood radius
+    RULE_OFFSETS_MAX  = 24, // Cells in a radius 2 Moore neighborhood
+    RULE_NAME_SIZE    = 16, // Buffer for a shape name on the command line
+    RULE_BENCH_PASSES = 50, // Part 1 passes timed per kernel
+} rule_info_t;
+
+/**
+ * @enum chal4_shape_t
+ * @brief Neighborhood shapes
+ */
+typedef enum chal4_shape_t
+{
+    SHAPE_MOORE = 0,   // Square: max(|dr|, |dc|) <= radius
+    SHAPE_VON_NEUMANN, // Diamond: |dr| + |dc| <= radius
+    SHAPE_COUNT,
+} chal4_shape_t;
+
+/**
+ * @struct chal4_rule_t
+ * @brief A roll is accessible when fewer than threshold neighbors are rolls
+ */
+typedef struct chal4_rule_t
+{
+    chal4_shape_t shape;
+    int           radius;
+    int           threshold;
+} chal4_rule_t;
+
+/**
+ * @brief Runs one pass of a rule over a grid
+ *
+ * With p_next NULL only the accessible rolls are counted (part 1); otherwise
+ * the survivors are written into p_next (one part 2 round).
+ *
+ * @return Number of accessible (removed) rolls
+ */
+typedef long (*chal4_rule_kernel_t)(const chal4_grid_t * p_grid,
+                                    chal4_grid_t *       p_next);
+
+/**
+ * @struct chal4_rule_engine_t
+ * @brief A rule bound to its kernel
+ */
+typedef struct chal4_rule_engine_t
+{
+    chal4_rule_t        rule;
+    chal4_rule_kernel_t p_kernel;      // Specialized kernel, NULL if none
+    ptrdiff_t           offsets[RULE_OFFSETS_MAX]; // Generic fallback
+    int                 offset_count;
+} chal4_rule_engine_t;
+
+uint8_t chal4_rule_parse (const char * p_text, chal4_rule_t * p_rule);
+uint8_t chal4_rule_bind (const chal4_rule_t * p_rule,
+                         size_t               stride,
+                         bool                 b_generic,
+                         chal4_rule_engine_t * p_engine);
+long    chal4_rule_pass (const chal4_rule_engine_t * p_engine,
+                         const chal4_grid_t *        p_grid,
+                         chal4_grid_t *              p_next);
+uint8_t chal4_rule_part2 (const chal4_rule_engine_t * p_engine,
+                          chal4_grid_t *              p_grid,
+                          chal4_grid_t *              p_next,
+                          long *                      p_removed,
+                          chal4_round_stats_t *       p_stats);
+void    chal4_rule_name (const chal4_rule_t * p_rule,
+                         char *               p_buffer,
+                         size_t               size);
+uint8_t chal4_rule_bench (const chal4_grid_t * p_grid);
+
+#endif /* CHAL4_RULES_H */
+
+/** END OF FILE **/
\ No newline at end of file
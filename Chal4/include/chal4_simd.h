@@ -0,0 +1,43 @@
+/**
+ * @file chal4_simd.h
+ *
+ * @brief Neighbor-count row kernels for Advent of Code 2025 Challenge 4, one
+ * per CPU level.
+ *
+ * @author Mexeck88
+ *
+ * @date 18OCT26
+ */
+
+#ifndef CHAL4_SIMD_H
+#define CHAL4_SIMD_H
+
+#include "aoc_cpu.h"
+#include "chal4.h"
+
+/**
+ * @brief Kernel applying the default rule to a run of cells of one row
+ *
+ * @param p_row First cell of the run in a padded grid; the cells left and
+ * right of the run and the rows above and below it must be readable
+ * @param stride Bytes between rows of the grid
+ * @param p_dest Where the run's cells after removal are written, NULL to only
+ * count
+ * @param width Cells in the run
+ *
+ * @return Number of rolls with fewer than NEIGHBOR_COUNT neighbors
+ */
+typedef long (*chal4_row_fn_t)(const uint8_t * p_row,
+                               ptrdiff_t       stride,
+                               uint8_t *       p_dest,
+                               size_t          width);
+
+long           chal4_row_step (const uint8_t * p_row,
+                               ptrdiff_t       stride,
+                               uint8_t *       p_dest,
+                               size_t          width);
+chal4_row_fn_t chal4_row_variant (aoc_cpu_level_t level);
+
+#endif /* CHAL4_SIMD_H */
+
+/** END OF FILE **/
\ No newline at end of file
@@ -0,0 +1,79 @@
+/**
+ * @file chal4_sparse.h
+ *
+ * @brief Sparse run-length grid for Advent of Code 2025 Challenge 4.
+ *
+ * @author Mexeck88
+ *
+ * @date 18OCT26
+ */
+
+#ifndef CHAL4_SPARSE_H
+#define CHAL4_SPARSE_H
+
+#include "chal4.h"
+
+/**
+ * @enum sparse_info_t
+ * @brief Sparse grid sizing and dense/sparse selection
+ */
+typedef enum sparse_info_t
+{
+    SPARSE_INIT_RUNS     = 1024, // Initial run capacity
+    SPARSE_INIT_ROWS     = 64,   // Initial row capacity
+    SPARSE_MAX_WIDTH     = INT32_MAX, // Run bounds are 32-bit
+    SPARSE_MAX_OCCUPANCY = 20, // Percent of cells occupied up to which the
+                               // auto engine solves on runs
+} sparse_info_t;
+
+/**
+ * @struct chal4_run_t
+ * @brief Occupied columns [start, end) of one row
+ */
+typedef struct chal4_run_t
+{
+    uint32_t start;
+    uint32_t end;
+} chal4_run_t;
+
+/**
+ * @struct chal4_sparse_t
+ * @brief Grid stored as the occupied runs of every row, left to right
+ *
+ * Row r owns p_runs[p_rows[r]] up to p_runs[p_rows[r + 1]]; runs of a row
+ * never touch, so at least one empty cell separates them. Buffers carved
+ * from an arena are released with the arena, not the grid.
+ */
+typedef struct chal4_sparse_t
+{
+    chal4_run_t * p_runs;
+    size_t *      p_rows;       // height + 1 run indexes
+    aoc_arena_t * p_arena;      // Owner of the buffers, NULL for the heap
+    size_t        run_count;
+    size_t        run_capacity;
+    size_t        row_capacity;
+    size_t        width;
+    size_t        height;
+    size_t        occupied;     // Rolls in the grid
+} chal4_sparse_t;
+
+uint8_t chal4_sparse_parse (aoc_input_t *    p_input,
+                            aoc_arena_t *    p_arena,
+                            chal4_sparse_t * p_sparse);
+uint8_t chal4_sparse_load (const char *     p_file_path,
+                           aoc_arena_t *    p_arena,
+                           chal4_sparse_t * p_sparse);
+void    chal4_sparse_free (chal4_sparse_t * p_sparse);
+uint8_t chal4_sparse_to_grid (const chal4_sparse_t * p_sparse,
+                              chal4_grid_t *         p_grid);
+bool    chal4_sparse_prefer (const chal4_sparse_t * p_sparse);
+long    chal4_sparse_pass (const chal4_sparse_t * p_sparse,
+                           chal4_sparse_t *       p_next);
+uint8_t chal4_sparse_part2 (chal4_sparse_t *      p_sparse,
+                            chal4_sparse_t *      p_next,
+                            long *                p_removed,
+                            chal4_round_stats_t * p_stats);
+
+#endif /* CHAL4_SPARSE_H */
+
+/** END OF FILE **/
\ No newline at end of file
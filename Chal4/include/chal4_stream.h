@@ -0,0 +1,29 @@
+/**
+ * @file chal4_stream.h
+ *
+ * @brief Streaming part 1 solver for Advent of Code 2025 Challenge 4.
+ *
+ * @author Mexeck88
+ *
+ * @date 18OCT26
+ */
+
+#ifndef CHAL4_STREAM_H
+#define CHAL4_STREAM_H
+
+#include "chal4.h"
+
+/**
+ * @enum stream_info_t
+ * @brief Streaming ring buffer constants
+ */
+typedef enum stream_info_t
+{
+    RING_ROWS = 3, // Row above, row being classified, row below
+} stream_info_t;
+
+uint8_t chal4_stream_part1 (const char * p_file_path, long * p_count);
+
+#endif /* CHAL4_STREAM_H */
+
+/** END OF FILE **/
\ No newline at end of file
@@ -0,0 +1,36 @@
+/**
+ * @file chal4_threads.h
+ *
+ * @brief Multi-threaded row-band and thread pool stencils for Advent of Code 2025 Challenge 4.
+ *
+ * @author Mexeck88
+ *
+ * @date 18OCT26
+ */
+
+#ifndef CHAL4_THREADS_H
+#define CHAL4_THREADS_H
+
+#include "aoc_pool.h"
+#include "chal4.h"
+
+uint8_t chal4_threads_part1 (const chal4_grid_t * p_grid,
+                             int                  thread_count,
+                             long *               p_count);
+uint8_t chal4_threads_part2 (chal4_grid_t *        p_grid,
+                             chal4_grid_t *        p_next,
+                             int                   thread_count,
+                             long *                p_removed,
+                             chal4_round_stats_t * p_stats);
+uint8_t chal4_pool_part1 (const chal4_grid_t * p_grid,
+                          aoc_pool_t *         p_pool,
+                          long *               p_count);
+uint8_t chal4_pool_part2 (chal4_grid_t *        p_grid,
+                          chal4_grid_t *        p_next,
+                          aoc_pool_t *          p_pool,
+                          long *                p_removed,
+                          chal4_round_stats_t * p_stats);
+
+#endif /* CHAL4_THREADS_H */
+
+/** END OF FILE **/
\ No newline at end of file
@@ -0,0 +1,34 @@
+/**
+ * @file chal4_tiles.h
+ *
+ * @brief Dirty-tile synchronous round engine for Advent of Code 2025
+ * Challenge 4.
+ *
+ * @author Mexeck88
+ *
+ * @date 18OCT26
+ */
+
+#ifndef CHAL4_TILES_H
+#define CHAL4_TILES_H
+
+#include "chal4.h"
+
+/**
+ * @enum tile_info_t
+ * @brief Tile and bitmap constants
+ */
+typedef enum tile_info_t
+{
+    TILE_SIZE     = 64, // Tile edge in cells
+    BITS_PER_WORD = 64, // Tiles tracked by one bitmap word
+} tile_info_t;
+
+uint8_t chal4_tiles_part2 (chal4_grid_t *        p_grid,
+                           chal4_grid_t *        p_next,
+                           long *                p_removed,
+                           chal4_round_stats_t * p_stats);
+
+#endif /* CHAL4_TILES_H */
+
+/** END OF FILE **/
\ No newline at end of file
@@ -8,445 +8,1340 @@
  * @date 03DEC25
  */
 
+#include <unistd.h>
+
+#include "aoc_snap.h"
 #include "chal4.h"
+#include "chal4_edit.h"
+#include "chal4_layout.h"
+#include "chal4_peel.h"
+#include "chal4_pipe.h"
+#include "chal4_stream.h"
+#include "chal4_rules.h"
+#include "chal4_simd.h"
+#include "chal4_sparse.h"
+#include "chal4_threads.h"
+#include "chal4_tiles.h"
+
+/**
+ * @brief Records the removals and wall time of one part 2 round
+ *
+ * @param p_stats Round statistics to append to
+ * @param removed Rolls removed in the round
+ * @param millis Wall time of the round in milliseconds
+ *
+ * @return RET_SUCCESS on success, RET_FAILURE on failure
+ */
+uint8_t
+chal4_round_stats_add (chal4_round_stats_t * p_stats,
+                       long                  removed,
+                       double                millis)
+{
+    uint8_t  retcode    = RET_FAILURE;
+    size_t   capacity   = 0;
+    long *   p_removed  = NULL;
+    double * p_millis   = NULL;
+
+    if (NULL == p_stats)
+    {
+        perror("ERROR: NULL pointer passed to round_stats_add\n");
+        goto EXIT;
+    }
+
+    if (p_stats->count == p_stats->capacity)
+    {
+        capacity = (0 == p_stats->capacity) ? INIT_ROWS
+                                            : p_stats->capacity * REALLOC_SCALE;
+
+        p_removed = realloc(p_stats->p_removed, capacity * sizeof(long));
+        if (NULL == p_removed)
+        {
+            perror("ERROR: Unable to grow round statistics");
+            goto EXIT;
+        }
+        p_stats->p_removed = p_removed;
+
+        p_millis = realloc(p_stats->p_millis, capacity * sizeof(double));
+        if (NULL == p_millis)
+        {
+            perror("ERROR: Unable to grow round statistics");
+            goto EXIT;
+        }
+        p_stats->p_millis = p_millis;
+
+        p_stats->capacity = capacity;
+    }
+
+    p_stats->p_removed[p_stats->count] = removed;
+    p_stats->p_millis[p_stats->count]  = millis;
+    p_stats->count++;
+
+    retcode = RET_SUCCESS;
+EXIT:
+    return retcode;
+}
+
+/**
+ * @brief Prints every recorded round followed by the round count
+ *
+ * @param p_stats Round statistics to print
+ */
+void
+chal4_round_stats_print (const chal4_round_stats_t * p_stats)
+{
+    double total_ms = 0.0;
+
+    if (NULL == p_stats)
+    {
+        return;
+    }
+
+    for (size_t idx = 0; idx < p_stats->count; idx++)
+    {
+        printf("Round %zu: removed %ld in %.3f ms\n",
+               idx + 1,
+               p_stats->p_removed[idx],
+               p_stats->p_millis[idx]);
+        total_ms += p_stats->p_millis[idx];
+    }
+
+    printf("Rounds: %zu (%.3f ms)\n", p_stats->count, total_ms);
+}
+
+/**
+ * @brief Releases the arrays owned by round statistics
+ *
+ * @param p_stats Round statistics to release
+ */
+void
+chal4_round_stats_free (chal4_round_stats_t * p_stats)
+{
+    if (NULL != p_stats)
+    {
+        free(p_stats->p_removed);
+        free(p_stats->p_millis);
+        memset(p_stats, 0, sizeof(*p_stats));
+    }
+}
+
+/**
+ * @brief Milliseconds elapsed on the monotonic clock since a start time
+ *
+ * @param p_start Start time taken with CLOCK_MONOTONIC
+ *
+ * @return Elapsed time in milliseconds
+ */
+double
+chal4_elapsed_ms (const struct timespec * p_start)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return ((double)(now.tv_sec - p_start->tv_sec) * MS_PER_SEC)
+           + ((double)(now.tv_nsec - p_start->tv_nsec) / NS_PER_MS);
+}
+
+/**
+ * @brief Processes the grid for part 1 solution
+ *
+ * @param p_main_args Pointer to the main arguments structure containing the
+ * grid
+ *
+ * @return RET_SUCCESS on success, RET_FAILURE on failure
+ */
+uint8_t
+chal4_process_line_part1 (main_args_t * p_main_args)
+{
+    uint8_t              retcode = RET_FAILURE;
+    const chal4_grid_t * p_grid  = NULL;
+    const uint8_t *      p_row   = NULL;
+
+    AOC_TRACE_SCOPE("part1");
+
+    if (NULL == p_main_args)
+    {
+        perror("ERROR: NULL pointer passed to process_line_part1\n");
+        goto EXIT;
+    }
+
+    p_grid = &p_main_args->grid;
+
+    // Check each row's neighbors (padding is never visited, it only
+    // supplies the zero neighbors at the edges)
+    for (size_t row = 0; row < p_grid->height; row++)
+    {
+        p_row = CHAL4_ROW(p_grid, row);
+        p_main_args->solution_1
+            += chal4_row_step(p_row, p_grid->stride, NULL, p_grid->width);
+    }
+
+    retcode = RET_SUCCESS;
+EXIT:
+    return retcode;
+}
+
+/**
+ * @brief Processes the grid for part 2 solution
+ *
+ * Each round reads the current grid and writes the survivors into the scratch
+ * grid, then the two are swapped. The loop stops on the first round that
+ * removes nothing.
+ *
+ * @param p_main_args Pointer to the main arguments structure containing the
+ * grid and its zeroed scratch grid of the same size
+ *
+ * @return RET_SUCCESS on success, RET_FAILURE on failure
+ */
+uint8_t
+chal4_process_line_part2 (main_args_t * p_main_args)
+{
+    uint8_t        retcode     = RET_FAILURE;
+    bool           b_stablized = false;
+    long           round_count = 0;
+    long           round       = 0; // Numbers the trace spans
+    chal4_grid_t * p_grid      = NULL;
+    chal4_grid_t * p_next      = NULL;
+    chal4_grid_t   swap;
+
+    AOC_TRACE_SCOPE("part2");
+
+    if (NULL == p_main_args)
+    {
+        perror("ERROR: NULL pointer passed to process_line_part2\n");
+        goto EXIT;
+    }
+
+    p_grid = &p_main_args->grid;
+    p_next = &p_main_args->scratch;
+
+    if (NULL == p_next->p_block)
+    {
+        perror("ERROR: Part 2 scratch grid is not allocated\n");
+        goto EXIT;
+    }
+
+    // Loop that stops when the count is no longer updated
+    for (round = 0; false == b_stablized; round++)
+    {
+        AOC_TRACE_SCOPE_ARG("round", round);
+
+        round_count = 0;
+
+        // remove cells that have less than 4 neighbors; the next grid gets
+        // the result so checks in this round aren't influenced
+        for (size_t row = 0; row < p_grid->height; row++)
+        {
+            round_count += chal4_row_step(CHAL4_ROW(p_grid, row),
+                                          p_grid->stride,
+                                          CHAL4_ROW(p_next, row),
+                                          p_grid->width);
+        }
+
+        // Next grid becomes current (selected are now removed)
+        swap    = *p_grid;
+        *p_grid = *p_next;
+        *p_next = swap;
+
+        p_main_args->solution_2 += round_count;
+
+        if (0 == round_count)
+        {
+            b_stablized = true;
+        }
+    }
+
+    retcode = RET_SUCCESS;
+
+EXIT:
+    return retcode;
+}
+
+#ifndef AOC_RUNNER
+/**
+ * @brief Engine names accepted by -m, indexed by chal4_engine_t
+ */
+static const char * const gp_engine_names[ENGINE_COUNT] = {
+    "serial",
+    "bands",
+    "stream",
+    "tiles",
+    "rule",
+    "rule-bench",
+    "edit",
+    "tiled",
+    "morton",
+    "layout-bench",
+    "peel",
+    "sparse",
+    "auto",
+    "pipe",
+    "pool",
+};
+
+/**
+ * @brief Parses the command line into the main arguments structure
+ *
+ * Usage: chal4 [-m engine] [-t threads] [-r rule] [-e edits] [-b runs] [-n]
+ * [-s snapshot] [input_file]
+ *
+ * Without an engine the auto engine picks the dense or the sparse solver from
+ * the measured occupancy; the others stay for explicit selection. Giving -t
+ * without -m selects the bands engine, -r the rule engine and -e the edit
+ * engine. -t also sizes the shared pool the pool engine runs on. Rules are
+ * written shape:radius:threshold, e.g. vonneumann:2:6. -b times the phases
+ * of the serial engine instead of printing the solutions, and selects it
+ * when no engine is given. -n solves even when the answers for the input are
+ * cached. -s writes the parsed grid as a snapshot instead of solving.
+ *
+ * @param argc Argument count
+ * @param argv Argument vector
+ * @param p_main_args Pointer to the main arguments structure
+ *
+ * @return RET_SUCCESS on success, RET_FAILURE on failure
+ */
+static uint8_t
+chal4_parse_args (int argc, char ** argv, main_args_t * p_main_args)
+{
+    uint8_t retcode = RET_FAILURE;
+    int     option  = 0;
+    int     engine  = ENGINE_COUNT; // Not chosen yet
+
+    p_main_args->p_file_path  = FILE_PATH;
+    p_main_args->thread_count = 1;
+    p_main_args->p_rule_text  = DEFAULT_RULE;
+    p_main_args->p_edit_path  = NULL;
+    p_main_args->p_snap_path  = NULL;
+
+    while (-1 != (option = getopt(argc, argv, "m:t:r:e:b:ns:")))
+    {
+        switch (option)
+        {
+            case 'm':
+                for (engine = 0; engine < ENGINE_COUNT; engine++)
+                {
+                    if (0 == strcmp(optarg, gp_engine_names[engine]))
+                    {
+                        break;
+                    }
+                }
+
+                if (ENGINE_COUNT == engine)
+                {
+                    printf("ERROR: Unknown engine: %s\n", optarg);
+                    goto EXIT;
+                }
+                break;
+
+            case 't':
+                p_main_args->thread_count = atoi(optarg);
+                if (0 >= p_main_args->thread_count)
+                {
+                    printf("ERROR: Thread count must be positive: %s\n",
+                           optarg);
+                    goto EXIT;
+                }
+
+                // Sizes the shared pool too, which starts on first use
+                setenv(AOC_POOL_ENV, optarg, 1);
+
+                if (ENGINE_COUNT == engine)
+                {
+                    engine = ENGINE_BANDS;
+                }
+                break;
+
+            case 'r':
+                p_main_args->p_rule_text = optarg;
+                if (ENGINE_COUNT == engine)
+                {
+                    engine = ENGINE_RULE;
+                }
+                break;
+
+            case 'e':
+                p_main_args->p_edit_path = optarg;
+                if (ENGINE_COUNT == engine)
+                {
+                    engine = ENGINE_EDIT;
+                }
+                break;
+
+            case 'b':
+                if (0 >= atoi(optarg))
+                {
+                    printf("ERROR: Run count must be positive: %s\n", optarg);
+                    goto EXIT;
+                }
+
+                p_main_args->bench_runs = (size_t)atoi(optarg); // > 0
+                break;
+
+            case 'n':
+                p_main_args->b_no_cache = true;
+                break;
+
+            case 's':
+                p_main_args->p_snap_path = optarg;
+                break;
+
+            default:
+                printf("Usage: %s [-m engine] [-t threads] [-r rule] "
+                       "[-e edits] [-b runs] [-n] [-s snapshot] "
+                       "[input_file]\n",
+                       argv[0]);
+                printf("Engines:");
+                for (int idx = 0; idx < ENGINE_COUNT; idx++)
+                {
+                    printf(" %s", gp_engine_names[idx]);
+                }
+                printf(" (default: auto, serial with -b)\n");
+                goto EXIT;
+        }
+    }
+
+    // The bench times the serial phases, everything else measures first
+    if (ENGINE_COUNT == engine)
+    {
+        engine = (0 < p_main_args->bench_runs) ? ENGINE_SERIAL : ENGINE_AUTO;
+    }
+
+    p_main_args->engine = (chal4_engine_t)engine;
+
+    if ((0 < p_main_args->bench_runs)
+        && (ENGINE_SERIAL != p_main_args->engine))
+    {
+        printf("ERROR: -b times the serial engine only\n");
+        goto EXIT;
+    }
+
+    if ((ENGINE_EDIT == p_main_args->engine)
+        && (NULL == p_main_args->p_edit_path))
+    {
+        printf("ERROR: The edit engine needs an edit file (-e)\n");
+        goto EXIT;
+    }
+
+    // Optional input path, otherwise the checked-in input
+    if (optind < argc)
+    {
+        p_main_args->p_file_path = argv[optind];
+    }
+
+    retcode = RET_SUCCESS;
+EXIT:
+    return retcode;
+}
+#endif /* AOC_RUNNER */
+
+/**
+ * @brief Runs both parts with the multi-threaded row-band engine
+ *
+ * @param p_main_args Pointer to the main arguments structure with a loaded
+ * grid and scratch grid
+ *
+ * @return RET_SUCCESS on success, RET_FAILURE on failure
+ */
+static uint8_t
+chal4_solve_bands (main_args_t * p_main_args)
+{
+    uint8_t retcode = RET_FAILURE;
+
+    if (RET_SUCCESS
+        != chal4_threads_part1(&p_main_args->grid,
+                               p_main_args->thread_count,
+                               &p_main_args->solution_1))
+    {
+        perror("ERROR: Unable to process threaded part 1\n");
+        goto EXIT;
+    }
+
+    if (RET_SUCCESS
+        != chal4_threads_part2(&p_main_args->grid,
+                               &p_main_args->scratch,
+                               p_main_args->thread_count,
+                               &p_main_args->solution_2,
+                               &p_main_args->rounds))
+    {
+        perror("ERROR: Unable to process threaded part 2\n");
+        goto EXIT;
+    }
+
+    chal4_round_stats_print(&p_main_args->rounds);
+
+    retcode = RET_SUCCESS;
+EXIT:
+    return retcode;
+}
+
+/**
+ * @brief Runs both parts as row chunks on the shared work-stealing pool
+ * (aoc_pool_shared), sized by -t through AOC_THREADS
+ *
+ * @param p_main_args Pointer to the main arguments structure with a loaded
+ * grid and scratch grid
+ *
+ * @return RET_SUCCESS on success, RET_FAILURE on failure
+ */
+static uint8_t
+chal4_solve_pool (main_args_t * p_main_args)
+{
+    uint8_t      retcode = RET_FAILURE;
+    aoc_pool_t * p_pool  = aoc_pool_shared(); // NULL runs serially
+    uint64_t     chunks  = 0;
+    uint64_t     steals  = 0;
+
+    if ((RET_SUCCESS
+         != chal4_pool_part1(
+             &p_main_args->grid, p_pool, &p_main_args->solution_1))
+        || (RET_SUCCESS
+            != chal4_pool_part2(&p_main_args->grid,
+                                &p_main_args->scratch,
+                                p_pool,
+                                &p_main_args->solution_2,
+                                &p_main_args->rounds)))
+    {
+        perror("ERROR: Unable to process pool engine\n");
+        goto EXIT;
+    }
+
+    chal4_round_stats_print(&p_main_args->rounds);
+    aoc_pool_counters(p_pool, &chunks, &steals);
+    printf("Pool: %d workers ran %llu chunks, %llu stolen\n",
+           aoc_pool_size(p_pool),
+           (unsigned long long)chunks,
+           (unsigned long long)steals);
+
+    retcode = RET_SUCCESS;
+EXIT:
+    return retcode;
+}
+
+/**
+ * @brief Runs both parts with the dirty-tile engine
+ *
+ * The first wave removes exactly the rolls that are accessible in the input,
+ * so its size is the part 1 answer.
+ *
+ * @param p_main_args Pointer to the main arguments structure with a loaded
+ * grid and scratch grid
+ *
+ * @return RET_SUCCESS on success, RET_FAILURE on failure
+ */
+static uint8_t
+chal4_solve_tiles (main_args_t * p_main_args)
+{
+    uint8_t retcode = RET_FAILURE;
+
+    if (RET_SUCCESS
+        != chal4_tiles_part2(&p_main_args->grid,
+                             &p_main_args->scratch,
+                             &p_main_args->solution_2,
+                             &p_main_args->rounds))
+    {
+        perror("ERROR: Unable to process dirty-tile part 2\n");
+        goto EXIT;
+    }
+
+    p_main_args->solution_1 = p_main_args->rounds.p_removed[0];
+    chal4_round_stats_print(&p_main_args->rounds);
+
+    retcode = RET_SUCCESS;
+EXIT:
+    return retcode;
+}
+
+/**
+ * @brief Runs both parts with the rule given by -r
+ *
+ * @param p_main_args Pointer to the main arguments structure with a grid
+ * loaded with a border of at least the rule radius
+ * @param p_rule Parsed rule
+ *
+ * @return RET_SUCCESS on success, RET_FAILURE on failure
+ */
+static uint8_t
+chal4_solve_rule (main_args_t * p_main_args, const chal4_rule_t * p_rule)
+{
+    uint8_t             retcode = RET_FAILURE;
+    char                name[RULE_NAME_SIZE * 2];
+    chal4_rule_engine_t engine;
+
+    if (RET_SUCCESS
+        != chal4_rule_bind(p_rule, p_main_args->grid.stride, false, &engine))
+    {
+        goto EXIT;
+    }
+
+    chal4_rule_name(p_rule, name, sizeof(name));
+    printf("Rule %s: %s kernel\n",
+           name,
+           (NULL != engine.p_kernel) ? "specialized" : "generic");
+
+    p_main_args->solution_1
+        = chal4_rule_pass(&engine, &p_main_args->grid, NULL);
+
+    if (RET_SUCCESS
+        != chal4_rule_part2(&engine,
+                            &p_main_args->grid,
+                            &p_main_args->scratch,
+                            &p_main_args->solution_2,
+                            &p_main_args->rounds))
+    {
+        perror("ERROR: Unable to process rule part 2\n");
+        goto EXIT;
+    }
+
+    chal4_round_stats_print(&p_main_args->rounds);
+
+    retcode = RET_SUCCESS;
+EXIT:
+    return retcode;
+}
+
+/**
+ * @brief Applies the edit file given by -e, reporting the part 1 count after
+ * every batch
+ *
+ * @param p_main_args Pointer to the main arguments structure with a loaded
+ * grid (handed over to the edit state)
+ *
+ * @return RET_SUCCESS on success, RET_FAILURE on failure
+ */
+static uint8_t
+chal4_solve_edit (main_args_t * p_main_args)
+{
+    uint8_t            retcode = RET_FAILURE;
+    chal4_edit_state_t state;
+
+    if (RET_SUCCESS != chal4_edit_init(&state, &p_main_args->grid))
+    {
+        goto EXIT;
+    }
+
+    printf("Initial accessible: %ld\n", state.accessible);
+
+    if (RET_SUCCESS
+        != chal4_edit_apply_file(&state, p_main_args->p_edit_path))
+    {
+        perror("ERROR: Unable to apply edit file\n");
+        goto CLEAN;
+    }
+
+    p_main_args->solution_1 = state.accessible;
+    retcode                 = RET_SUCCESS;
+
+CLEAN:
+    chal4_edit_free(&state);
+EXIT:
+    return retcode;
+}
+
+/**
+ * @brief Runs both parts on a tiled or Morton copy of the loaded grid
+ *
+ * @param p_main_args Pointer to the main arguments structure with a loaded
+ * grid
+ * @param kind LAYOUT_TILED or LAYOUT_MORTON
+ *
+ * @return RET_SUCCESS on success, RET_FAILURE on failure
+ */
+static uint8_t
+chal4_solve_layout (main_args_t * p_main_args, chal4_layout_kind_t kind)
+{
+    uint8_t        retcode = RET_FAILURE;
+    chal4_layout_t layout;
+    chal4_layout_t next;
+
+    memset(&layout, 0, sizeof(layout));
+    memset(&next, 0, sizeof(next));
+
+    if ((RET_SUCCESS
+         != chal4_layout_from_grid(&p_main_args->grid, kind, &layout))
+        || (RET_SUCCESS != chal4_layout_alloc_like(&layout, &next)))
+    {
+        perror("ERROR: Unable to build grid layout\n");
+        goto EXIT;
+    }
+
+    p_main_args->solution_1 = chal4_layout_pass(&layout, NULL);
+
+    if (RET_SUCCESS
+        != chal4_layout_part2(
+            &layout, &next, &p_main_args->solution_2, &p_main_args->rounds))
+    {
+        perror("ERROR: Unable to process layout part 2\n");
+        goto EXIT;
+    }
+
+    chal4_round_stats_print(&p_main_args->rounds);
+
+    retcode = RET_SUCCESS;
+EXIT:
+    chal4_layout_free(&layout);
+    chal4_layout_free(&next);
+    return retcode;
+}
+
+/**
+ * @brief Runs both parts with the lock-free peeling engine
+ *
+ * @param p_main_args Pointer to the main arguments structure with a loaded
+ * grid
+ *
+ * @return RET_SUCCESS on success, RET_FAILURE on failure
+ */
+static uint8_t
+chal4_solve_peel (main_args_t * p_main_args)
+{
+    uint8_t retcode = RET_FAILURE;
+    long    stolen  = 0;
+
+    if (RET_SUCCESS
+        != chal4_peel_run(&p_main_args->grid,
+                          p_main_args->thread_count,
+                          &p_main_args->solution_1,
+                          &p_main_args->solution_2,
+                          &stolen))
+    {
+        perror("ERROR: Unable to process peeling part 2\n");
+        goto EXIT;
+    }
+
+    printf("Peel: %ld cells stolen between queues\n", stolen);
+
+    retcode = RET_SUCCESS;
+EXIT:
+    return retcode;
+}
 
 /**
- * @brief Processes the input lines to compute the two solutions
+ * @brief Loads the input as runs and solves both parts on them
+ *
+ * The auto engine measures the occupancy first and expands busy maps into
+ * the dense grid, leaving them to the serial solver. Its choice goes to
+ * stderr so that, like the serial engine, it prints only the answers.
  *
- * @param p_file_path Path to the input file
- * @param p_main_args Pointer to the main arguments structure containing input
- * lines
+ * @param p_main_args Pointer to the main arguments structure
+ * @param p_b_dense Set to true if the grid was expanded and still needs
+ * solving
  *
  * @return RET_SUCCESS on success, RET_FAILURE on failure
  */
 static uint8_t
-chal4_load_input (const char * p_file_path, main_args_t * p_main_args)
+chal4_solve_sparse (main_args_t * p_main_args, bool * p_b_dense)
 {
-    uint8_t retcode               = RET_FAILURE;
-    char    buffer[LINE_SIZE + 1] = { 0 }; // +1 for newline + null terminator
+    uint8_t        retcode = RET_FAILURE;
+    chal4_sparse_t sparse;
+    chal4_sparse_t next;
 
-    if ((NULL == p_file_path) || (NULL == p_main_args))
-    {
-        perror("ERROR: NULL pointer passed to load_input\n");
-        retcode = RET_NULL_POINTER;
-        goto EXIT;
-    }
+    memset(&sparse, 0, sizeof(sparse));
+    memset(&next, 0, sizeof(next));
+    *p_b_dense = false;
 
-    FILE * p_file = fopen(p_file_path, "r");
-    if (NULL == p_file)
+    // Auto opened the input already; sparse reads it here
+    if (NULL != p_main_args->input.p_data)
     {
-        perror("ERROR: Unable to open file");
-        goto EXIT;
+        retcode = chal4_sparse_parse(
+            &p_main_args->input, &p_main_args->arena, &sparse);
     }
-
-    p_main_args->pp_lines = malloc(sizeof(char *) * NUM_LINES);
-    if (NULL == p_main_args->pp_lines)
+    else
     {
-        perror("ERROR: Unable to allocate memory for lines");
-        goto CLEAN;
+        retcode = chal4_sparse_load(
+            p_main_args->p_file_path, &p_main_args->arena, &sparse);
     }
 
-    // Copy into struct
-    while (NULL != fgets(buffer, LINE_SIZE + 1, p_file))
+    if (RET_SUCCESS != retcode)
     {
-        // Check bounds before allocating
-        if (NUM_LINES <= p_main_args->line_count)
-        {
-            printf("ERROR: Exceeded maximum number of lines (%d)\n", NUM_LINES);
-            goto CLEAN;
-        }
-
-        p_main_args->pp_lines[p_main_args->line_count]
-            = malloc((LINE_SIZE + 1) * sizeof(char));
-        if (NULL == p_main_args->pp_lines[p_main_args->line_count])
-        {
-            printf("ERROR: Unable to allocate memory for line %d\n",
-                   p_main_args->line_count);
-            goto CLEAN;
-        }
+        perror("ERROR: Unable to load input file\n");
+        goto EXIT;
+    }
 
-        strncpy(
-            p_main_args->pp_lines[p_main_args->line_count], buffer, LINE_SIZE);
+    retcode = RET_FAILURE;
 
-        char * p_newline
-            = strchr(p_main_args->pp_lines[p_main_args->line_count], '\n');
-        if (NULL != p_newline)
-        {
-            *p_newline = '\0';
-        }
-        else
-        {
+#ifdef DEBUG
+    aoc_arena_print(&p_main_args->arena, "load");
+#endif
 
-            p_main_args->pp_lines[p_main_args->line_count][LINE_SIZE] = '\0';
-        }
+    if (ENGINE_AUTO == p_main_args->engine)
+    {
+        *p_b_dense = (false == chal4_sparse_prefer(&sparse));
+        fprintf(stderr,
+                "Auto: %zu of %zu cells occupied, %s grid\n",
+                sparse.occupied,
+                sparse.width * sparse.height,
+                (true == *p_b_dense) ? "dense" : "sparse");
+    }
 
-        p_main_args->line_count++;
+    if (true == *p_b_dense)
+    {
+        retcode = chal4_sparse_to_grid(&sparse, &p_main_args->grid);
+        goto EXIT;
     }
 
-    retcode = RET_SUCCESS;
-    goto EXIT;
+    p_main_args->solution_1 = chal4_sparse_pass(&sparse, NULL);
 
-CLEAN:
-    for (int idx = 0; idx < p_main_args->line_count; idx++)
+    if (RET_SUCCESS
+        != chal4_sparse_part2(
+            &sparse, &next, &p_main_args->solution_2, &p_main_args->rounds))
     {
-        if (NULL != p_main_args->pp_lines[idx])
-        {
-            free(p_main_args->pp_lines[idx]);
-            p_main_args->pp_lines[idx] = NULL;
-        }
+        perror("ERROR: Unable to process sparse part 2\n");
+        goto EXIT;
     }
 
-    if (NULL != p_main_args->pp_lines)
+    // Auto is the default engine, its stdout is only the answers
+    if (ENGINE_SPARSE == p_main_args->engine)
     {
-        free(p_main_args->pp_lines);
-        p_main_args->pp_lines = NULL;
+        chal4_round_stats_print(&p_main_args->rounds);
     }
 
+    retcode = RET_SUCCESS;
 EXIT:
-    if (NULL != p_file)
+    chal4_sparse_free(&sparse);
+    chal4_sparse_free(&next);
+    return retcode;
+}
+
+#ifndef AOC_RUNNER
+/**
+ * @brief Prints the solutions computed by the selected engine
+ *
+ * @param p_main_args Pointer to the main arguments structure
+ */
+static void
+chal4_print_solutions (const main_args_t * p_main_args)
+{
+    switch (p_main_args->engine)
     {
-        fclose(p_file);
-    }
+        case ENGINE_RULE_BENCH:
+        case ENGINE_LAYOUT_BENCH:
+            break; // Timings only
 
-    return retcode;
+        case ENGINE_STREAM:
+        case ENGINE_EDIT:
+            printf("Solution 1: %ld\n", p_main_args->solution_1);
+            break;
+
+        default:
+            printf("Solution 1: %ld\n", p_main_args->solution_1);
+            printf("Solution 2: %ld\n", p_main_args->solution_2);
+            break;
+    }
 }
+#endif /* AOC_RUNNER */
 
 /**
- * @brief Converts the input lines into the grid struct for processing
+ * @brief Loads the grid and runs the engine selected on the command line
+ *
+ * The stream engine reads the input itself and only solves part 1; the layout
+ * benchmark generates its own grids. The sparse and auto engines load runs,
+ * and auto falls through to the serial solver for busy maps and snapshots.
+ * The pipe engine loads the grid while the input is still being read, then
+ * solves it serially.
  *
- * @param p_main_args Pointer to the main arguments structure containing input
- * lines
+ * @param p_main_args Pointer to the main arguments structure
  *
- * @return true on success, false otherwise
+ * @return RET_SUCCESS on success, RET_FAILURE on failure
  */
 static uint8_t
-chal4_process_input (main_args_t * p_main_args)
+chal4_solve (main_args_t * p_main_args)
 {
-    uint8_t      retcode = RET_FAILURE;
-    const char * p_line  = NULL;
+    uint8_t        retcode = RET_FAILURE;
+    chal4_grid_t * p_grid  = &p_main_args->grid;
+    size_t         border  = GRID_BORDER;
+    bool           b_dense = false;
+    chal4_rule_t   rule;
 
-    if (NULL == p_main_args)
+    if (ENGINE_STREAM == p_main_args->engine)
     {
-        perror("ERROR: NULL pointer passed to process_input\n");
+        retcode = chal4_stream_part1(p_main_args->p_file_path,
+                                     &p_main_args->solution_1);
         goto EXIT;
     }
 
-    // Read each line of the pp_lines, convert to 0/1 and store in grid
-    // Store at grid[row+1] to leave padding at grid[0]
-    for (int row = 0; row < p_main_args->line_count; row++)
+    // Generates its own grids
+    if (ENGINE_LAYOUT_BENCH == p_main_args->engine)
     {
-        p_line = p_main_args->pp_lines[row];
+        retcode = chal4_layout_bench();
+        goto EXIT;
+    }
 
-        for (int col = 0; col < LINE_SIZE; col++)
+    // Wider neighborhoods need a wider border around the data
+    if (ENGINE_RULE == p_main_args->engine)
+    {
+        if (RET_SUCCESS != chal4_rule_parse(p_main_args->p_rule_text, &rule))
         {
-            if (0 == strncmp(&p_line[col], "@", 1))
-            {
-                p_main_args->grid[row + 1][col + 1] = 1;
-            }
-            else
-            {
-                p_main_args->grid[row + 1][col + 1] = 0;
-            }
+            goto EXIT;
         }
+
+        border = (size_t)rule.radius; // Parsed as 1 - RULE_RADIUS_MAX
+    }
+    else if (ENGINE_RULE_BENCH == p_main_args->engine)
+    {
+        border = RULE_RADIUS_MAX;
+    }
+
+    // Auto needs the input open to tell a snapshot (already dense) apart
+    if ((ENGINE_AUTO == p_main_args->engine)
+        && (NULL == p_main_args->input.p_data)
+        && (AOC_SUCCESS
+            != aoc_input_open(p_main_args->p_file_path, &p_main_args->input)))
+    {
+        perror("ERROR: Unable to load input file\n");
+        goto EXIT;
+    }
+
+    if ((ENGINE_AUTO == p_main_args->engine)
+        && (true == aoc_snap_detect(&p_main_args->input)))
+    {
+        fprintf(stderr, "Auto: snapshot input, dense grid\n");
     }
 
-    // Fill padding row and columns with 0s
-    // Row 0 (top padding)
-    for (int col = 0; col < GRID_SIZE; col++)
+    // Run-length engines load their own input, busy maps come back dense
+    if ((ENGINE_SPARSE == p_main_args->engine)
+        || ((ENGINE_AUTO == p_main_args->engine)
+            && (false == aoc_snap_detect(&p_main_args->input))))
+    {
+        retcode = chal4_solve_sparse(p_main_args, &b_dense);
+        if ((RET_SUCCESS != retcode) || (false == b_dense))
+        {
+            goto EXIT;
+        }
+
+        retcode = RET_FAILURE;
+    }
+    else if (ENGINE_PIPE == p_main_args->engine)
+    {
+        if (RET_SUCCESS
+            != chal4_pipe_load_input(
+                p_main_args->p_file_path, border, &p_main_args->arena, p_grid))
+        {
+            perror("ERROR: Unable to load input file\n");
+            goto EXIT;
+        }
+    }
+    // Input already opened (and hashed) by the cache lookup
+    else if (NULL != p_main_args->input.p_data)
     {
-        p_main_args->grid[0][col] = 0;
+        if (RET_SUCCESS
+            != chal4_parse_input(
+                &p_main_args->input, border, &p_main_args->arena, p_grid))
+        {
+            perror("ERROR: Unable to load input file\n");
+            goto EXIT;
+        }
     }
-    // Row 140 (bottom padding)
-    for (int col = 0; col < GRID_SIZE; col++)
+    // Load input file into the padded grid
+    else if (RET_SUCCESS
+             != chal4_load_input(
+                 p_main_args->p_file_path, border, &p_main_args->arena, p_grid))
     {
-        p_main_args->grid[GRID_SIZE - 1][col] = 0;
+        perror("ERROR: Unable to load input file\n");
+        goto EXIT;
     }
-    // Column 0 (left padding)
-    for (int row = 0; row < GRID_SIZE; row++)
+
+#ifdef DEBUG
+    aoc_arena_print(&p_main_args->arena,
+                    (true == b_dense) ? "expand" : "load");
+#endif
+
+    if (RET_SUCCESS
+        != chal4_grid_alloc(&p_main_args->scratch,
+                            p_grid->width,
+                            p_grid->height,
+                            p_grid->border))
     {
-        p_main_args->grid[row][0] = 0;
+        perror("ERROR: Unable to allocate part 2 scratch grid\n");
+        goto EXIT;
     }
-    // Column 140 (right padding)
-    for (int row = 0; row < GRID_SIZE; row++)
+
+    switch (p_main_args->engine)
     {
-        p_main_args->grid[row][GRID_SIZE - 1] = 0;
+        case ENGINE_BANDS:
+            retcode = chal4_solve_bands(p_main_args);
+            break;
+
+        case ENGINE_TILES:
+            retcode = chal4_solve_tiles(p_main_args);
+            break;
+
+        case ENGINE_RULE:
+            retcode = chal4_solve_rule(p_main_args, &rule);
+            break;
+
+        case ENGINE_RULE_BENCH:
+            retcode = chal4_rule_bench(p_grid);
+            break;
+
+        case ENGINE_EDIT:
+            retcode = chal4_solve_edit(p_main_args);
+            break;
+
+        case ENGINE_TILED:
+            retcode = chal4_solve_layout(p_main_args, LAYOUT_TILED);
+            break;
+
+        case ENGINE_MORTON:
+            retcode = chal4_solve_layout(p_main_args, LAYOUT_MORTON);
+            break;
+
+        case ENGINE_PEEL:
+            retcode = chal4_solve_peel(p_main_args);
+            break;
+
+        case ENGINE_POOL:
+            retcode = chal4_solve_pool(p_main_args);
+            break;
+
+        default:
+            // Process input file to get solutions
+            if (RET_FAILURE == chal4_process_line_part1(p_main_args))
+            {
+                perror("ERROR: Unable to process part 1\n");
+                goto EXIT;
+            }
+
+            if (RET_FAILURE == chal4_process_line_part2(p_main_args))
+            {
+                perror("ERROR: Unable to process part 2\n");
+                goto EXIT;
+            }
+
+            retcode = RET_SUCCESS;
+            break;
     }
 
 EXIT:
-    retcode = RET_SUCCESS;
     return retcode;
 }
 
+#ifndef AOC_RUNNER
 /**
- * @brief Checks the neighbors of each cell in the grid (reduces complexity)
+ * @brief Benchmark phase: opens (maps) the input file
  *
- * @param p_main_args Pointer to the main arguments structure containing input
+ * @param p_ctx Pointer to the main arguments structure
  *
  * @return RET_SUCCESS on success, RET_FAILURE on failure
  */
 static uint8_t
-chal4_check_neighbors (main_args_t * p_main_args, int * neighbor_count, int row, int col)
+chal4_bench_load (void * p_ctx)
 {
-    uint8_t retcode = RET_FAILURE;
-    *neighbor_count = 0;
+    main_args_t * p_main_args = p_ctx;
 
-    if (neighbor_count == NULL)
-    {
-        perror("ERROR: NULL pointer passed to check_neighbors\n");
-        goto EXIT;
-    }
+    return aoc_input_open(p_main_args->p_file_path, &p_main_args->input);
+}
 
-    if (NULL == p_main_args)
+/**
+ * @brief Benchmark phase: parses the grid and allocates the scratch grid
+ *
+ * @param p_ctx Pointer to the main arguments structure with an open input
+ *
+ * @return RET_SUCCESS on success, RET_FAILURE on failure
+ */
+static uint8_t
+chal4_bench_parse (void * p_ctx)
+{
+    main_args_t *  p_main_args = p_ctx;
+    chal4_grid_t * p_grid      = &p_main_args->grid;
+
+    if (RET_SUCCESS
+        != chal4_parse_input(
+            &p_main_args->input, GRID_BORDER, &p_main_args->arena, p_grid))
     {
-        perror("ERROR: NULL pointer passed to check_neighbors\n");
-        goto EXIT;
+        return RET_FAILURE;
     }
-    // Check 8 neighbors
-    p_main_args->grid[row - 1][col - 1] == 1 ? (*neighbor_count)++
-                                             : 0;                   // Top-Left
-    p_main_args->grid[row - 1][col] == 1 ? (*neighbor_count)++ : 0; // Top
-    p_main_args->grid[row - 1][col + 1] == 1 ? (*neighbor_count)++
-                                             : 0;                   // Top-Right
-    p_main_args->grid[row][col - 1] == 1 ? (*neighbor_count)++ : 0; // Left
-    p_main_args->grid[row][col + 1] == 1 ? (*neighbor_count)++ : 0; // Right
-    p_main_args->grid[row + 1][col - 1] == 1 ? (*neighbor_count)++
-                                             : 0; // Bottom-Left
-    p_main_args->grid[row + 1][col] == 1 ? (*neighbor_count)++ : 0; // Bottom
-    p_main_args->grid[row + 1][col + 1] == 1 ? (*neighbor_count)++
-                                             : 0; // Bottom-Right
 
-    retcode = RET_SUCCESS;
-EXIT:
-    return retcode;
+    return chal4_grid_alloc(
+        &p_main_args->scratch, p_grid->width, p_grid->height, p_grid->border);
 }
 
-
 /**
- * @brief Processes the grid for part 1 solution
+ * @brief Benchmark phase: serial part 1
  *
- * @param p_grid Pointer to the grid structure
+ * @param p_ctx Pointer to the main arguments structure with a parsed grid
  *
  * @return RET_SUCCESS on success, RET_FAILURE on failure
  */
 static uint8_t
-chal4_process_line_part1 (main_args_t * p_main_args)
+chal4_bench_part1 (void * p_ctx)
 {
-    uint8_t retcode        = RET_FAILURE;
-    int     neighbor_count = 0;
+    return chal4_process_line_part1(p_ctx);
+}
 
-    if (NULL == p_main_args)
-    {
-        perror("ERROR: NULL pointer passed to process_line_part1\n");
-        goto EXIT;
-    }
+/**
+ * @brief Benchmark phase: serial part 2
+ *
+ * @param p_ctx Pointer to the main arguments structure with a parsed grid
+ *
+ * @return RET_SUCCESS on success, RET_FAILURE on failure
+ */
+static uint8_t
+chal4_bench_part2 (void * p_ctx)
+{
+    return chal4_process_line_part2(p_ctx);
+}
 
-    // Read each element the grid and check its neighbors
-    // Check rows 1-140 and columns 1-140 (the actual data, not padding)
-    for (int row = 1; row < GRID_SIZE - 1; row++)
-    {
-        for (int col = 1; col < GRID_SIZE - 1; col++)
-        {
-            if (p_main_args->grid[row][col] == 1) // start check
-            {
-                if (RET_SUCCESS
-                    != chal4_check_neighbors(p_main_args, &neighbor_count, row, col))
-                {
-                    perror("ERROR: Unable to check neighbors in part 1\n");
-                    goto EXIT;
-                }
+/**
+ * @brief Releases the grids and the input so the phases can run again
+ *
+ * @param p_ctx Pointer to the main arguments structure
+ *
+ * @return RET_SUCCESS
+ */
+static uint8_t
+chal4_bench_reset (void * p_ctx)
+{
+    main_args_t * p_main_args = p_ctx;
 
-                if (neighbor_count < NEIGHBOR_COUNT)
-                {
-                    p_main_args->solution_1++;
-                }
-            }
-        }
-    }
+    chal4_grid_free(&p_main_args->grid);
+    chal4_grid_free(&p_main_args->scratch);
+    chal4_round_stats_free(&p_main_args->rounds);
+    aoc_arena_reset(&p_main_args->arena);
+    aoc_input_close(&p_main_args->input);
 
-    retcode = RET_SUCCESS;
-EXIT:
-    return retcode;
+    return RET_SUCCESS;
 }
 
 /**
- * @brief Processes the grid for part 2 solution
+ * @brief Times the load, parse, part 1 and part 2 phases of the serial
+ * engine (-b runs)
  *
- * @param p_grid Pointer to the grid structure
+ * @param p_main_args Pointer to the main arguments structure
  *
  * @return RET_SUCCESS on success, RET_FAILURE on failure
  */
 static uint8_t
-chal4_process_line_part2 (main_args_t * p_main_args)
+chal4_bench (main_args_t * p_main_args)
 {
-    uint8_t retcode                         = RET_FAILURE;
-    bool    b_stablized                     = false;
-    int     neighbor_count                  = 0;
-    int     test_count                      = 0;
-    int     copy_grid[GRID_SIZE][GRID_SIZE] = { 0 };
+    static const aoc_bench_phase_t phases[] = {
+        { "load", chal4_bench_load },
+        { "parse", chal4_bench_parse },
+        { "part1", chal4_bench_part1 },
+        { "part2", chal4_bench_part2 },
+    };
 
-    if (NULL == p_main_args)
+    aoc_bench_t bench = {
+        .p_name      = "chal4",
+        .p_file_path = p_main_args->p_file_path,
+        .p_phases    = phases,
+        .phase_count = sizeof(phases) / sizeof(phases[0]),
+        .p_reset     = chal4_bench_reset,
+        .p_ctx       = p_main_args,
+        .runs        = p_main_args->bench_runs,
+        .warmup      = AOC_BENCH_WARMUP,
+    };
+
+    return (AOC_SUCCESS == aoc_bench_run(&bench)) ? RET_SUCCESS : RET_FAILURE;
+}
+
+/**
+ * @brief Loads the input and writes its grid as a snapshot (-s)
+ *
+ * @param p_main_args Pointer to the main arguments structure
+ *
+ * @return RET_SUCCESS on success, RET_FAILURE on failure
+ */
+static uint8_t
+chal4_write_snapshot (main_args_t * p_main_args)
+{
+    if (RET_SUCCESS
+        != chal4_load_input(p_main_args->p_file_path,
+                            GRID_BORDER,
+                            &p_main_args->arena,
+                            &p_main_args->grid))
     {
-        perror("ERROR: NULL pointer passed to process_line_part2\n");
-        goto EXIT;
+        perror("ERROR: Unable to load input file\n");
+        return RET_FAILURE;
     }
 
-    // While loop that stops when the count is no longer updated
-    while (false == b_stablized)
+    return chal4_grid_write_snapshot(&p_main_args->grid,
+                                     p_main_args->p_snap_path);
+}
+#endif /* AOC_RUNNER */
+
+/**
+ * @brief Releases everything a solve or a benchmark left behind
+ *
+ * @param p_main_args Pointer to the main arguments structure, freed as well
+ */
+static void
+chal4_release (main_args_t * p_main_args)
+{
+    chal4_grid_free(&p_main_args->grid);
+    chal4_grid_free(&p_main_args->scratch);
+    chal4_round_stats_free(&p_main_args->rounds);
+    aoc_arena_free(&p_main_args->arena);
+    aoc_input_close(&p_main_args->input);
+    free(p_main_args);
+}
+
+/**
+ * @brief Solves both parts with the serial engine, through the result cache
+ *
+ * On a hit the grid is never parsed.
+ *
+ * @param p_main_args Pointer to the main arguments structure
+ * @param p_cache Result cache, NULL to bypass it
+ * @param p_result Receives the solutions
+ *
+ * @return RET_SUCCESS on success, RET_FAILURE on failure
+ */
+static uint8_t
+chal4_solve_cached (main_args_t *      p_main_args,
+                    aoc_cache_t *      p_cache,
+                    aoc_day_result_t * p_result)
+{
+    uint8_t         retcode = RET_FAILURE;
+    aoc_cache_key_t key     = { DAY_NUMBER, SOLVER_VERSION, "", 0, 0 };
+
+    p_result->b_cached = false;
+
+    // Hashing needs the input open first; chal4_solve then parses it in place
+    if (NULL != p_cache)
     {
-        test_count = 0;
-        // Copy grid
-        for (int row = 0; row < GRID_SIZE; row++)
+        if (AOC_SUCCESS
+            != aoc_input_open(p_main_args->p_file_path, &p_main_args->input))
         {
-            for (int col = 0; col < GRID_SIZE; col++)
-            {
-                copy_grid[row][col] = p_main_args->grid[row][col];
-            }
+            perror("ERROR: Unable to load input file\n");
+            goto EXIT;
         }
 
-        // remove cells that have less than 4 neighbors
-        for (int row = 1; row < GRID_SIZE - 1; row++)
+        if (true
+            == aoc_cache_lookup(p_cache, &key, &p_main_args->input, p_result))
         {
-            for (int col = 1; col < GRID_SIZE - 1; col++)
-            {
-                if (p_main_args->grid[row][col] == 1) // start check
-                {
-                    if (RET_SUCCESS
-                        != chal4_check_neighbors(p_main_args, &neighbor_count, row, col))
-                    {
-                        perror("ERROR: Unable to check neighbors in part 2\n");
-                        goto EXIT;
-                    }
-
-                    if (NEIGHBOR_COUNT > neighbor_count)
-                    {
-                        // set copy grid cell to 0 so future checks aren't
-                        // influenced
-                        p_main_args->solution_2++;
-                        copy_grid[row][col] = 0;
-                    }
-                }
-            }
+            p_main_args->solution_1 = p_result->part1;
+            p_main_args->solution_2 = p_result->part2;
+            retcode                 = RET_SUCCESS;
+            goto EXIT;
         }
+    }
 
-        // Copy back to main grid (selected are now removed)
-        for (int row = 0; row < GRID_SIZE; row++)
-        {
-            for (int col = 0; col < GRID_SIZE; col++)
-            {
-                p_main_args->grid[row][col] = copy_grid[row][col];
-            }
-        }
+    if (RET_SUCCESS != chal4_solve(p_main_args))
+    {
+        goto EXIT;
+    }
 
-        // Check if the grid has stabilized
-        for (int row = 1; row < GRID_SIZE - 1; row++)
-        {
-            for (int col = 1; col < GRID_SIZE - 1; col++)
-            {
-                if (p_main_args->grid[row][col] == 1) // start check
-                {
-                    if (RET_SUCCESS
-                        != chal4_check_neighbors(p_main_args, &neighbor_count, row, col))
-                    {
-                        perror("ERROR: Unable to check neighbors in part 2\n");
-                        goto EXIT;
-                    }
+    p_result->part1 = p_main_args->solution_1;
+    p_result->part2 = p_main_args->solution_2;
+    retcode         = RET_SUCCESS;
 
-                    if (neighbor_count < NEIGHBOR_COUNT)
-                    {
-                        test_count++;
-                    }
-                }
-            }
-        }
+    // An unwritable cache only warns, the answers stand
+    (void)aoc_cache_store(p_cache, &key, p_result);
 
-        if (0 == test_count)
-        {
-            b_stablized = true;
-        }
+EXIT:
+    return retcode;
+}
+
+/**
+ * @brief Solves both parts of an input with the serial engine (aoc_day_fn_t,
+ * used by the runner)
+ *
+ * @param p_file_path Input file, "-" for stdin
+ * @param p_cache Result cache, NULL to bypass it
+ * @param p_result Receives the solutions
+ *
+ * @return RET_SUCCESS on success, RET_FAILURE on failure
+ */
+uint8_t
+chal4_run (const char *       p_file_path,
+           aoc_cache_t *      p_cache,
+           aoc_day_result_t * p_result)
+{
+    uint8_t retcode = RET_FAILURE;
+
+    main_args_t * p_main_args = calloc(1, sizeof(main_args_t));
+    if (NULL == p_main_args)
+    {
+        perror("ERROR: Unable to allocate memory for main args\n");
+        goto EXIT;
     }
 
-    retcode = RET_SUCCESS;
+    p_main_args->p_file_path  = p_file_path;
+    p_main_args->engine       = ENGINE_SERIAL;
+    p_main_args->thread_count = 1;
+    p_main_args->p_rule_text  = DEFAULT_RULE;
+    aoc_arena_init(&p_main_args->arena, 0);
+
+    retcode = chal4_solve_cached(p_main_args, p_cache, p_result);
+    chal4_release(p_main_args);
 
 EXIT:
     return retcode;
 }
 
+// The runner (Runner/) links chal4_run and brings its own main
+#ifndef AOC_RUNNER
 /**
  * @brief Main function for Advent of Code 2025 Challenge 4
  *
- * @return int Exit code
+ * @param argc Argument count
+ * @param argv Argument vector
+ *
+ * @return 0 on success, 1 on failure
  */
 int
-main (void)
+main (int argc, char ** argv)
 {
-    int retcode = 0;
+    int              retcode = 1;
+    aoc_day_result_t result  = { 0 };
+    aoc_cache_t      cache;
+    aoc_cache_t *    p_cache = NULL;
 
-    main_args_t * p_main_args = malloc(sizeof(main_args_t));
+    main_args_t * p_main_args = calloc(1, sizeof(main_args_t));
     if (NULL == p_main_args)
     {
         perror("ERROR: Unable to allocate memory for main args\n");
         goto EXIT;
     }
 
-    p_main_args->solution_1 = 0;
-    p_main_args->solution_2 = 0;
-    p_main_args->pp_lines   = NULL;
-    p_main_args->line_count = 0;
-    memset(p_main_args->grid,
-           0,
-           sizeof(p_main_args->grid)); // Initialize grid to zero
+    aoc_arena_init(&p_main_args->arena, 0);
 
-    // Load input file
-    if (RET_FAILURE == chal4_load_input(FILE_PATH, p_main_args))
+    if (RET_SUCCESS != chal4_parse_args(argc, argv, p_main_args))
     {
-        perror("ERROR: Unable to load input file\n");
         goto CLEAN;
     }
 
-    // Convert input to grid
-    if (RET_FAILURE == chal4_process_input(p_main_args))
+    if (NULL != p_main_args->p_snap_path)
     {
-        perror("ERROR: Unable to process input file to grid\n");
+        retcode = (RET_SUCCESS == chal4_write_snapshot(p_main_args)) ? 0 : 1;
         goto CLEAN;
     }
 
-    // Process input file to get solutions
-    if (RET_FAILURE == chal4_process_line_part1(p_main_args))
+    if (0 < p_main_args->bench_runs)
     {
-        perror("ERROR: Unable to process part 1\n");
+        retcode = (RET_SUCCESS == chal4_bench(p_main_args)) ? 0 : 1;
         goto CLEAN;
     }
 
-    if (RET_FAILURE == chal4_process_line_part2(p_main_args))
+    // Serial and auto give the reference answers and are cached; the rest
+    // run to be measured
+    if (((ENGINE_SERIAL == p_main_args->engine)
+         || (ENGINE_AUTO == p_main_args->engine))
+        && (false == p_main_args->b_no_cache)
+        && (AOC_SUCCESS == aoc_cache_init(&cache, NULL)))
+    {
+        p_cache = &cache;
+    }
+
+    if (RET_SUCCESS != chal4_solve_cached(p_main_args, p_cache, &result))
     {
-        perror("ERROR: Unable to process part 2\n");
         goto CLEAN;
     }
 
-    printf("Solution 1: %ld\n", p_main_args->solution_1);
-    printf("Solution 2: %ld\n", p_main_args->solution_2);
+    chal4_print_solutions(p_main_args);
+    aoc_cache_report(p_cache);
 
-    retcode = 1;
+    retcode = 0;
 
 CLEAN:
     if (NULL != p_main_args)
     {
-        if (NULL != p_main_args->pp_lines)
-        {
-            for (int idx = 0; idx < p_main_args->line_count; idx++)
-            {
-                if (NULL != p_main_args->pp_lines[idx])
-                {
-                    free(p_main_args->pp_lines[idx]);
-                }
-            }
-            free(p_main_args->pp_lines);
-        }
-        free(p_main_args);
+        chal4_release(p_main_args);
     }
 
 EXIT:
     return retcode;
 }
+#endif /* AOC_RUNNER */
 
 /** END OF FILE **/
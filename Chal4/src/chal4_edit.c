@@ -0,0 +1,336 @@
+/**
+ * @file chal4_edit.c
+ *
+ * @brief Incremental cell-edit API for Advent of Code 2025 Challenge 4
+ *
+ * Every cell keeps the number of occupied cells around it. Setting or
+ * clearing a cell only changes the counts of its eight neighbors, so only
+ * the 3x3 block around the edit can change accessibility and the part 1
+ * count is kept up to date in O(1) per edit.
+ *
+ * @author Mexeck88
+ *
+ * @date 18OCT26
+ */
+
+#include "chal4_edit.h"
+
+/**
+ * @brief Counts accessible rolls in the 3x3 block centered on a cell
+ *
+ * @param p_state Edit state
+ * @param p_cell Center cell in the occupancy grid
+ * @param p_count Same cell in the count grid
+ *
+ * @return Number of accessible rolls in the block
+ */
+static long
+chal4_edit_block_accessible (const chal4_edit_state_t * p_state,
+                             const uint8_t *            p_cell,
+                             const uint8_t *            p_count)
+{
+    ptrdiff_t stride     = (ptrdiff_t)p_state->grid.stride;
+    ptrdiff_t offset     = 0;
+    long      accessible = 0;
+
+    for (ptrdiff_t d_row = -1; d_row <= 1; d_row++)
+    {
+        for (ptrdiff_t d_col = -1; d_col <= 1; d_col++)
+        {
+            offset = (d_row * stride) + d_col;
+
+            accessible += (1 == p_cell[offset])
+                          && (NEIGHBOR_COUNT > p_count[offset]);
+        }
+    }
+
+    return accessible;
+}
+
+/**
+ * @brief Flips one cell and updates the counts around it
+ *
+ * @param p_state Edit state
+ * @param row Data row of the cell
+ * @param col Data column of the cell
+ * @param value New value of the cell (0 or 1)
+ *
+ * @return RET_SUCCESS on success, RET_FAILURE if the cell is out of range
+ */
+static uint8_t
+chal4_edit_write (chal4_edit_state_t * p_state,
+                  size_t               row,
+                  size_t               col,
+                  uint8_t              value)
+{
+    uint8_t   retcode = RET_FAILURE;
+    ptrdiff_t stride  = 0;
+    uint8_t * p_cell  = NULL;
+    uint8_t * p_count = NULL;
+    long      before  = 0;
+
+    if (NULL == p_state)
+    {
+        perror("ERROR: NULL pointer passed to edit_write\n");
+        goto EXIT;
+    }
+
+    if ((row >= p_state->grid.height) || (col >= p_state->grid.width))
+    {
+        printf("ERROR: Cell (%zu, %zu) is outside the %zux%zu grid\n",
+               row,
+               col,
+               p_state->grid.width,
+               p_state->grid.height);
+        goto EXIT;
+    }
+
+    stride  = (ptrdiff_t)p_state->grid.stride;
+    p_cell  = CHAL4_ROW(&p_state->grid, row) + col;
+    p_count = CHAL4_ROW(&p_state->counts, row) + col;
+
+    if (value != *p_cell)
+    {
+        before = chal4_edit_block_accessible(p_state, p_cell, p_count);
+
+        *p_cell = value;
+        for (ptrdiff_t d_row = -1; d_row <= 1; d_row++)
+        {
+            for (ptrdiff_t d_col = -1; d_col <= 1; d_col++)
+            {
+                if ((0 != d_row) || (0 != d_col))
+                {
+                    p_count[(d_row * stride) + d_col] += (1 == value) ? 1 : -1;
+                }
+            }
+        }
+
+        p_state->accessible
+            += chal4_edit_block_accessible(p_state, p_cell, p_count) - before;
+    }
+
+    retcode = RET_SUCCESS;
+EXIT:
+    return retcode;
+}
+
+/**
+ * @brief Takes over a loaded grid and computes every neighbor count
+ *
+ * @param p_state Edit state to initialize
+ * @param p_grid Loaded grid; its block moves into the state and p_grid is
+ * left empty
+ *
+ * @return RET_SUCCESS on success, RET_FAILURE on failure
+ */
+uint8_t
+chal4_edit_init (chal4_edit_state_t * p_state, chal4_grid_t * p_grid)
+{
+    uint8_t         retcode = RET_FAILURE;
+    const uint8_t * p_row   = NULL;
+    uint8_t *       p_count = NULL;
+
+    if ((NULL == p_state) || (NULL == p_grid))
+    {
+        perror("ERROR: NULL pointer passed to edit_init\n");
+        goto EXIT;
+    }
+
+    memset(p_state, 0, sizeof(*p_state));
+
+    if (RET_SUCCESS
+        != chal4_grid_alloc(&p_state->counts,
+                            p_grid->width,
+                            p_grid->height,
+                            p_grid->border))
+    {
+        perror("ERROR: Unable to allocate neighbor counts\n");
+        goto EXIT;
+    }
+
+    p_state->grid = *p_grid;
+    memset(p_grid, 0, sizeof(*p_grid));
+
+    for (size_t row = 0; row < p_state->grid.height; row++)
+    {
+        p_row   = CHAL4_ROW(&p_state->grid, row);
+        p_count = CHAL4_ROW(&p_state->counts, row);
+
+        for (size_t col = 0; col < p_state->grid.width; col++)
+        {
+            p_count[col] = (uint8_t)chal4_check_neighbors( // 0 - 8
+                &p_row[col],
+                p_state->grid.stride);
+
+            p_state->accessible
+                += (1 == p_row[col]) && (NEIGHBOR_COUNT > p_count[col]);
+        }
+    }
+
+    retcode = RET_SUCCESS;
+EXIT:
+    return retcode;
+}
+
+/**
+ * @brief Releases the grids owned by an edit state
+ *
+ * @param p_state Edit state to release
+ */
+void
+chal4_edit_free (chal4_edit_state_t * p_state)
+{
+    if (NULL != p_state)
+    {
+        chal4_grid_free(&p_state->grid);
+        chal4_grid_free(&p_state->counts);
+        p_state->accessible = 0;
+    }
+}
+
+/**
+ * @brief Places a roll and updates the part 1 count
+ *
+ * @param p_state Edit state
+ * @param row Data row of the cell
+ * @param col Data column of the cell
+ *
+ * @return RET_SUCCESS on success, RET_FAILURE if the cell is out of range
+ */
+uint8_t
+chal4_edit_set_cell (chal4_edit_state_t * p_state, size_t row, size_t col)
+{
+    return chal4_edit_write(p_state, row, col, 1);
+}
+
+/**
+ * @brief Removes a roll and updates the part 1 count
+ *
+ * @param p_state Edit state
+ * @param row Data row of the cell
+ * @param col Data column of the cell
+ *
+ * @return RET_SUCCESS on success, RET_FAILURE if the cell is out of range
+ */
+uint8_t
+chal4_edit_clear_cell (chal4_edit_state_t * p_state, size_t row, size_t col)
+{
+    return chal4_edit_write(p_state, row, col, 0);
+}
+
+/**
+ * @brief Prints the count at the end of a batch that has any edits
+ *
+ * @param p_state Edit state
+ * @param p_batch Batch number, incremented when a batch is reported
+ * @param p_edit_count Edits in the batch, reset when a batch is reported
+ */
+static void
+chal4_edit_report_batch (const chal4_edit_state_t * p_state,
+                         size_t *                   p_batch,
+                         size_t *                   p_edit_count)
+{
+    if (0 < *p_edit_count)
+    {
+        (*p_batch)++;
+        printf("Batch %zu: %zu edits, accessible %ld\n",
+               *p_batch,
+               *p_edit_count,
+               p_state->accessible);
+        *p_edit_count = 0;
+    }
+}
+
+/**
+ * @brief Applies a file of edits, printing the count after every batch
+ *
+ * Each line is "+ row col" or "- row col" (0-based data coordinates). A blank
+ * line ends a batch, as does the end of the file.
+ *
+ * @param p_state Edit state
+ * @param p_file_path Path to the edit file ("-" reads stdin)
+ *
+ * @return RET_SUCCESS on success, RET_FAILURE on failure
+ */
+uint8_t
+chal4_edit_apply_file (chal4_edit_state_t * p_state, const char * p_file_path)
+{
+    uint8_t retcode    = RET_FAILURE;
+    FILE *  p_file     = NULL;
+    char *  p_line     = NULL;
+    size_t  line_cap   = 0;
+    size_t  line_num   = 0;
+    size_t  batch      = 0;
+    size_t  edit_count = 0;
+    size_t  row        = 0;
+    size_t  col        = 0;
+    char    op         = 0;
+
+    if ((NULL == p_state) || (NULL == p_file_path))
+    {
+        perror("ERROR: NULL pointer passed to edit_apply_file\n");
+        goto EXIT;
+    }
+
+    p_file = (0 == strcmp(p_file_path, "-")) ? stdin : fopen(p_file_path, "r");
+    if (NULL == p_file)
+    {
+        perror("ERROR: Unable to open edit file");
+        goto EXIT;
+    }
+
+    while (0 < getline(&p_line, &line_cap, p_file))
+    {
+        line_num++;
+
+        if (3 != sscanf(p_line, " %c %zu %zu", &op, &row, &col))
+        {
+            // Blank line: close the batch
+            if (strlen(p_line) == strspn(p_line, " \t\r\n"))
+            {
+                chal4_edit_report_batch(p_state, &batch, &edit_count);
+                continue;
+            }
+
+            printf("ERROR: Bad edit on line %zu: %s", line_num, p_line);
+            goto EXIT;
+        }
+
+        if (EDIT_SET == op)
+        {
+            retcode = chal4_edit_set_cell(p_state, row, col);
+        }
+        else if (EDIT_CLEAR == op)
+        {
+            retcode = chal4_edit_clear_cell(p_state, row, col);
+        }
+        else
+        {
+            printf("ERROR: Unknown edit '%c' on line %zu\n", op, line_num);
+            retcode = RET_FAILURE;
+        }
+
+        if (RET_SUCCESS != retcode)
+        {
+            retcode = RET_FAILURE;
+            goto EXIT;
+        }
+
+        edit_count++;
+    }
+
+    chal4_edit_report_batch(p_state, &batch, &edit_count);
+
+    retcode = RET_SUCCESS;
+EXIT:
+    free(p_line);
+
+    if ((NULL != p_file) && (stdin != p_file))
+    {
+        fclose(p_file);
+    }
+
+    return retcode;
+}
+
+/** END OF FILE **/
\ No newline at end of file
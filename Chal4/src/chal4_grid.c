@@ -0,0 +1,615 @@
+/**
+ * @file chal4_grid.c
+ *
+ * @brief Allocation and loading of the runtime-sized Challenge 4 grid
+ *
+ * @author Mexeck88
+ *
+ * @date 18OCT26
+ */
+
+#include "aoc_input.h"
+#include "aoc_snap.h"
+#include "chal4.h"
+
+/**
+ * @brief Rounds a row length up to a whole number of cache lines
+ *
+ * @param row_bytes Bytes needed by one row including the border
+ *
+ * @return Row stride in bytes
+ */
+static size_t
+chal4_grid_stride (size_t row_bytes)
+{
+    return ((row_bytes + CACHE_LINE_SIZE - 1) / CACHE_LINE_SIZE)
+           * CACHE_LINE_SIZE;
+}
+
+/**
+ * @brief Allocates the aligned block for a grid without initializing it
+ *
+ * The block comes from p_grid->p_arena when one is set, else from the heap.
+ *
+ * @param p_grid Grid to fill in (width, border and arena must already be set)
+ * @param row_capacity Number of data rows the block must hold
+ *
+ * @return RET_SUCCESS on success, RET_FAILURE on failure
+ */
+static uint8_t
+chal4_grid_reserve (chal4_grid_t * p_grid, size_t row_capacity)
+{
+    uint8_t retcode = RET_FAILURE;
+    size_t  rows    = row_capacity + (2 * p_grid->border);
+
+    if (rows > (SIZE_MAX / p_grid->stride))
+    {
+        printf("ERROR: Grid of %zu rows is too large\n", row_capacity);
+        goto EXIT;
+    }
+
+    p_grid->p_block
+        = (NULL != p_grid->p_arena)
+              ? aoc_arena_alloc_aligned(
+                  p_grid->p_arena, rows * p_grid->stride, CACHE_LINE_SIZE)
+              : aligned_alloc(CACHE_LINE_SIZE, rows * p_grid->stride);
+    if (NULL == p_grid->p_block)
+    {
+        perror("ERROR: Unable to allocate memory for grid");
+        goto EXIT;
+    }
+
+    p_grid->p_cells
+        = p_grid->p_block + (p_grid->border * p_grid->stride) + p_grid->border;
+
+    retcode = RET_SUCCESS;
+EXIT:
+    return retcode;
+}
+
+/**
+ * @brief Allocates a zeroed grid of the given size on the heap
+ *
+ * @param p_grid Grid to initialize
+ * @param width Number of data columns
+ * @param height Number of data rows
+ * @param border Empty cells to keep on every side of the data
+ *
+ * @return RET_SUCCESS on success, RET_FAILURE on failure
+ */
+uint8_t
+chal4_grid_alloc (chal4_grid_t * p_grid,
+                  size_t         width,
+                  size_t         height,
+                  size_t         border)
+{
+    return chal4_grid_alloc_arena(p_grid, width, height, border, NULL);
+}
+
+/**
+ * @brief Allocates a zeroed grid of the given size in an arena
+ *
+ * @param p_grid Grid to initialize
+ * @param width Number of data columns
+ * @param height Number of data rows
+ * @param border Empty cells to keep on every side of the data
+ * @param p_arena Arena to carve the block from (NULL for the heap)
+ *
+ * @return RET_SUCCESS on success, RET_FAILURE on failure
+ */
+uint8_t
+chal4_grid_alloc_arena (chal4_grid_t * p_grid,
+                        size_t         width,
+                        size_t         height,
+                        size_t         border,
+                        aoc_arena_t *  p_arena)
+{
+    uint8_t retcode = RET_FAILURE;
+
+    if (NULL == p_grid)
+    {
+        perror("ERROR: NULL pointer passed to grid_alloc\n");
+        goto EXIT;
+    }
+
+    p_grid->p_arena = p_arena;
+    p_grid->width   = width;
+    p_grid->height  = height;
+    p_grid->border  = border;
+    p_grid->stride  = chal4_grid_stride(width + (2 * border));
+
+    if (RET_SUCCESS != chal4_grid_reserve(p_grid, height))
+    {
+        goto EXIT;
+    }
+
+    memset(p_grid->p_block, 0, (height + (2 * border)) * p_grid->stride);
+
+    retcode = RET_SUCCESS;
+EXIT:
+    return retcode;
+}
+
+/**
+ * @brief Releases the block owned by a grid
+ *
+ * Arena blocks are only dropped; the arena releases them.
+ *
+ * @param p_grid Grid to release (safe to call on a zeroed grid)
+ */
+void
+chal4_grid_free (chal4_grid_t * p_grid)
+{
+    if (NULL != p_grid)
+    {
+        if (NULL == p_grid->p_arena)
+        {
+            free(p_grid->p_block);
+        }
+
+        p_grid->p_block = NULL;
+        p_grid->p_cells = NULL;
+        p_grid->width   = 0;
+        p_grid->height  = 0;
+    }
+}
+
+/**
+ * @brief Doubles the row capacity of a grid that is being loaded
+ *
+ * @param p_grid Grid holding p_grid->height loaded rows
+ * @param p_row_capacity Current capacity, updated on success
+ *
+ * @return RET_SUCCESS on success, RET_FAILURE on failure
+ */
+static uint8_t
+chal4_grid_grow (chal4_grid_t * p_grid, size_t * p_row_capacity)
+{
+    uint8_t      retcode = RET_FAILURE;
+    chal4_grid_t old     = *p_grid;
+
+    if (RET_SUCCESS
+        != chal4_grid_reserve(p_grid, *p_row_capacity * REALLOC_SCALE))
+    {
+        *p_grid = old;
+        goto EXIT;
+    }
+
+    // Top border and loaded rows keep their layout, so one copy moves them
+    memcpy(p_grid->p_block,
+           old.p_block,
+           (old.border + old.height) * old.stride);
+
+    // An outgrown arena block stays behind until the arena is released
+    if (NULL == old.p_arena)
+    {
+        free(old.p_block);
+    }
+
+    *p_row_capacity *= REALLOC_SCALE;
+    retcode = RET_SUCCESS;
+EXIT:
+    return retcode;
+}
+
+/**
+ * @brief Appends one row of cells to a grid that is built row by row
+ *
+ * The first row fixes the width and reserves *p_row_capacity rows; the
+ * capacity doubles as rows keep coming. Finish with chal4_grid_seal.
+ *
+ * @param p_grid Grid to append to (border and arena set, no block before the
+ * first row)
+ * @param p_row_capacity Row capacity, updated when the grid grows
+ * @param p_cells Row of width cells (0 or 1)
+ * @param width Number of cells in the row
+ *
+ * @return RET_SUCCESS on success, RET_FAILURE on failure
+ */
+uint8_t
+chal4_grid_append_row (chal4_grid_t *  p_grid,
+                       size_t *        p_row_capacity,
+                       const uint8_t * p_cells,
+                       size_t          width)
+{
+    uint8_t   retcode = RET_FAILURE;
+    uint8_t * p_row   = NULL;
+
+    if ((NULL == p_grid) || (NULL == p_row_capacity) || (NULL == p_cells))
+    {
+        perror("ERROR: NULL pointer passed to grid_append_row\n");
+        goto EXIT;
+    }
+
+    if (NULL == p_grid->p_block)
+    {
+        p_grid->width  = width;
+        p_grid->height = 0;
+        p_grid->stride = chal4_grid_stride(width + (2 * p_grid->border));
+
+        if (RET_SUCCESS != chal4_grid_reserve(p_grid, *p_row_capacity))
+        {
+            goto EXIT;
+        }
+
+        memset(p_grid->p_block, 0, p_grid->border * p_grid->stride);
+    }
+    else if (width != p_grid->width)
+    {
+        printf("ERROR: Line %zu has width %zu, expected %zu\n",
+               p_grid->height + 1,
+               width,
+               p_grid->width);
+        goto EXIT;
+    }
+
+    if ((p_grid->height == *p_row_capacity)
+        && (RET_SUCCESS != chal4_grid_grow(p_grid, p_row_capacity)))
+    {
+        goto EXIT;
+    }
+
+    p_row = CHAL4_ROW(p_grid, p_grid->height) - p_grid->border;
+    memset(p_row, 0, p_grid->stride);
+    memcpy(p_row + p_grid->border, p_cells, width);
+    p_grid->height++;
+
+    retcode = RET_SUCCESS;
+EXIT:
+    return retcode;
+}
+
+/**
+ * @brief Writes the bottom border of a grid built with chal4_grid_append_row
+ *
+ * @param p_grid Grid holding its last row
+ */
+void
+chal4_grid_seal (chal4_grid_t * p_grid)
+{
+    memset(CHAL4_ROW(p_grid, p_grid->height) - p_grid->border,
+           0,
+           p_grid->border * p_grid->stride);
+}
+
+/**
+ * @brief Writes one input line into a data row, clearing its border bytes
+ *
+ * @param p_grid Grid to write into
+ * @param row Data row index
+ * @param p_line Line of width characters
+ */
+static void
+chal4_grid_fill_row (chal4_grid_t * p_grid, size_t row, const char * p_line)
+{
+    uint8_t * p_row = CHAL4_ROW(p_grid, row) - p_grid->border;
+
+    memset(p_row, 0, p_grid->stride);
+
+    for (size_t col = 0; col < p_grid->width; col++)
+    {
+        p_row[p_grid->border + col] = (ROLL_CHAR == p_line[col]);
+    }
+}
+
+/**
+ * @brief Strips the trailing newline (and carriage return) from a line
+ *
+ * @param p_line Line read by getline
+ * @param length Length reported by getline
+ *
+ * @return Length of the line without its terminator
+ */
+size_t
+chal4_trim_line (char * p_line, size_t length)
+{
+    while ((0 < length)
+           && (('\n' == p_line[length - 1]) || ('\r' == p_line[length - 1])))
+    {
+        length--;
+    }
+
+    p_line[length] = '\0';
+    return length;
+}
+
+/**
+ * @brief Returns the uint64 words one snapshot row takes
+ *
+ * @param width Data columns
+ *
+ * @return Words per row
+ */
+static size_t
+chal4_grid_snap_words (size_t width)
+{
+    return (width / SNAP_WORD_BITS) + (0 != (width % SNAP_WORD_BITS));
+}
+
+/**
+ * @brief Expands the bit-packed rows of a snapshot into a padded grid
+ *
+ * Row r is words [r * words, (r + 1) * words) of the payload and bit
+ * (col % 64) of its word col / 64 is cell (r, col). The grid keeps one byte
+ * per cell for the kernels, so this is the only per-cell work of a load.
+ *
+ * @param p_input Open snapshot input
+ * @param border Empty cells to keep on every side of the data
+ * @param p_arena Arena to carve the grid from (NULL for the heap)
+ * @param p_grid Grid to fill in (must not own a block)
+ *
+ * @return RET_SUCCESS on success, RET_FAILURE on failure
+ */
+static uint8_t
+chal4_grid_load_snapshot (aoc_input_t *  p_input,
+                          size_t         border,
+                          aoc_arena_t *  p_arena,
+                          chal4_grid_t * p_grid)
+{
+    uint8_t          retcode = RET_FAILURE;
+    aoc_snap_t       snap    = { 0 };
+    size_t           words   = 0;
+    size_t           cells   = 0;
+    const uint64_t * p_bits  = NULL;
+    uint8_t *        p_row   = NULL;
+
+    if (AOC_SUCCESS != aoc_snap_open(p_input, DAY_NUMBER, &snap))
+    {
+        goto EXIT;
+    }
+
+    words = chal4_grid_snap_words((size_t)snap.width);
+    if ((0 == snap.width) || (0 == snap.count)
+        || (0 != (snap.size % (words * sizeof(uint64_t))))
+        || (snap.count != snap.size / (words * sizeof(uint64_t))))
+    {
+        printf("ERROR: Snapshot does not hold a %llu x %llu grid\n",
+               (unsigned long long)snap.width,
+               (unsigned long long)snap.count);
+        goto EXIT;
+    }
+
+    // Zeroed, so only the occupied cells are written
+    if (RET_SUCCESS
+        != chal4_grid_alloc_arena(
+            p_grid, (size_t)snap.width, (size_t)snap.count, border, p_arena))
+    {
+        goto EXIT;
+    }
+
+    // The header keeps the payload 8-byte aligned, so the words are read as is
+    p_bits = (const uint64_t *)snap.p_payload;
+    for (size_t row = 0; row < p_grid->height; row++)
+    {
+        p_row = CHAL4_ROW(p_grid, row);
+        for (size_t word = 0; word < words; word++)
+        {
+            // Whole words while they fit, so the bit loop vectorizes
+            cells = p_grid->width - (word * SNAP_WORD_BITS);
+            cells = (SNAP_WORD_BITS < cells) ? SNAP_WORD_BITS : cells;
+            for (size_t bit = 0; bit < cells; bit++)
+            {
+                p_row[bit] = (uint8_t)((p_bits[word] >> bit) & 1);
+            }
+            p_row += SNAP_WORD_BITS;
+        }
+        p_bits += words;
+    }
+
+    retcode = RET_SUCCESS;
+EXIT:
+    return retcode;
+}
+
+/**
+ * @brief Writes a grid as a snapshot (-s): its rows bit-packed into uint64
+ * words, with the width and height in the header
+ *
+ * @param p_grid Parsed grid
+ * @param p_snap_path Snapshot file to write
+ *
+ * @return RET_SUCCESS on success, RET_FAILURE on failure
+ */
+uint8_t
+chal4_grid_write_snapshot (const chal4_grid_t * p_grid,
+                           const char *         p_snap_path)
+{
+    uint8_t         retcode = RET_FAILURE;
+    size_t          words   = 0;
+    uint64_t *      p_bits  = NULL;
+    uint64_t *      p_word  = NULL;
+    const uint8_t * p_row   = NULL;
+
+    if ((NULL == p_grid) || (NULL == p_snap_path))
+    {
+        perror("ERROR: NULL pointer passed to grid_write_snapshot\n");
+        retcode = RET_NULL_POINTER;
+        goto EXIT;
+    }
+
+    words  = chal4_grid_snap_words(p_grid->width);
+    p_bits = calloc(p_grid->height * words, sizeof(uint64_t));
+    if (NULL == p_bits)
+    {
+        perror("ERROR: Unable to allocate memory for snapshot");
+        goto EXIT;
+    }
+
+    for (size_t row = 0; row < p_grid->height; row++)
+    {
+        p_row  = CHAL4_ROW(p_grid, row);
+        p_word = &p_bits[row * words];
+        for (size_t col = 0; col < p_grid->width; col++)
+        {
+            p_word[col / SNAP_WORD_BITS] |= (uint64_t)(0 != p_row[col])
+                                            << (col % SNAP_WORD_BITS);
+        }
+    }
+
+    if (AOC_SUCCESS
+        != aoc_snap_write(p_snap_path,
+                          DAY_NUMBER,
+                          p_grid->height,
+                          p_grid->width,
+                          p_bits,
+                          p_grid->height * words * sizeof(uint64_t)))
+    {
+        goto EXIT;
+    }
+
+    printf("Wrote %zu x %zu grid to %s\n",
+           p_grid->width,
+           p_grid->height,
+           p_snap_path);
+    retcode = RET_SUCCESS;
+EXIT:
+    free(p_bits);
+    return retcode;
+}
+
+/**
+ * @brief Parses the lines of an open input into a padded grid, detecting
+ * width and height, or expands the grid of a snapshot given as the input
+ *
+ * @param p_input Open input, read from its cursor
+ * @param border Empty cells to keep on every side of the data
+ * @param p_arena Arena to carve the grid from (NULL for the heap)
+ * @param p_grid Grid to fill in (must not own a block)
+ *
+ * @return RET_SUCCESS on success, RET_FAILURE on failure
+ */
+uint8_t
+chal4_parse_input (aoc_input_t *  p_input,
+                   size_t         border,
+                   aoc_arena_t *  p_arena,
+                   chal4_grid_t * p_grid)
+{
+    uint8_t    retcode      = RET_FAILURE;
+    size_t     row_capacity = INIT_ROWS;
+    size_t     remaining    = 0;
+    aoc_view_t line         = { 0 };
+
+    AOC_TRACE_SCOPE("parse");
+
+    if ((NULL == p_input) || (NULL == p_grid))
+    {
+        perror("ERROR: NULL pointer passed to parse_input\n");
+        retcode = RET_NULL_POINTER;
+        goto EXIT;
+    }
+
+    memset(p_grid, 0, sizeof(*p_grid));
+
+    // A snapshot already holds the cells, one bit each
+    if (true == aoc_snap_detect(p_input))
+    {
+        retcode = chal4_grid_load_snapshot(p_input, border, p_arena, p_grid);
+        goto EXIT;
+    }
+
+    p_grid->p_arena = p_arena;
+    remaining       = p_input->size - p_input->pos;
+
+    // The first line fixes the width of the grid
+    if (false == aoc_input_next_line(p_input, &line))
+    {
+        printf("ERROR: Input file is empty\n");
+        goto EXIT;
+    }
+
+    if (0 == line.length)
+    {
+        printf("ERROR: First line of input is empty\n");
+        goto EXIT;
+    }
+
+    // The whole input is in memory, so the height estimate is exact
+    row_capacity = (remaining / (line.length + 1)) + 1; // > 0
+
+    p_grid->width  = line.length;
+    p_grid->border = border;
+    p_grid->stride = chal4_grid_stride(line.length + (2 * border));
+
+    if (RET_SUCCESS != chal4_grid_reserve(p_grid, row_capacity))
+    {
+        goto EXIT;
+    }
+
+    memset(p_grid->p_block, 0, border * p_grid->stride);
+
+    // A blank line or the end of the input ends the grid
+    do
+    {
+        if (line.length != p_grid->width)
+        {
+            printf("ERROR: Line %zu has width %zu, expected %zu\n",
+                   p_grid->height + 1,
+                   line.length,
+                   p_grid->width);
+            goto CLEAN;
+        }
+
+        if ((p_grid->height == row_capacity)
+            && (RET_SUCCESS != chal4_grid_grow(p_grid, &row_capacity)))
+        {
+            goto CLEAN;
+        }
+
+        chal4_grid_fill_row(p_grid, p_grid->height, line.p_data);
+        p_grid->height++;
+    } while ((true == aoc_input_next_line(p_input, &line)) && (0 < line.length));
+
+    // Bottom border
+    memset(CHAL4_ROW(p_grid, p_grid->height) - border,
+           0,
+           border * p_grid->stride);
+
+    retcode = RET_SUCCESS;
+    goto EXIT;
+
+CLEAN:
+    chal4_grid_free(p_grid);
+EXIT:
+    return retcode;
+}
+
+/**
+ * @brief Loads the input file into a padded grid, detecting width and height
+ *
+ * @param p_file_path Path to the input file ("-" reads stdin)
+ * @param border Empty cells to keep on every side of the data
+ * @param p_arena Arena to carve the grid from (NULL for the heap)
+ * @param p_grid Grid to fill in (must not own a block)
+ *
+ * @return RET_SUCCESS on success, RET_FAILURE on failure
+ */
+uint8_t
+chal4_load_input (const char *   p_file_path,
+                  size_t         border,
+                  aoc_arena_t *  p_arena,
+                  chal4_grid_t * p_grid)
+{
+    uint8_t     retcode = RET_FAILURE;
+    aoc_input_t input   = { 0 };
+
+    AOC_TRACE_SCOPE("load");
+
+    if ((NULL == p_file_path) || (NULL == p_grid))
+    {
+        perror("ERROR: NULL pointer passed to load_input\n");
+        retcode = RET_NULL_POINTER;
+        goto EXIT;
+    }
+
+    if (AOC_SUCCESS != aoc_input_open(p_file_path, &input))
+    {
+        goto EXIT;
+    }
+
+    retcode = chal4_parse_input(&input, border, p_arena, p_grid);
+    aoc_input_close(&input);
+EXIT:
+    return retcode;
+}
+
+/** END OF FILE **/
\ No newline at end of file
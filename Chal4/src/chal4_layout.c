@@ -0,0 +1,857 @@
+/**
+ * @file chal4_layout.c
+ *
+ * @brief Tiled and Morton (Z-order) grid layouts for Advent of Code 2025
+ * Challenge 4
+ *
+ * On very wide grids the row-major stencil touches three rows that are a
+ * full stride apart, i.e. three cache lines and often three TLB pages per
+ * cell. Here the grid is cut into 64 x 64 tiles of 4 KiB, each tile stored
+ * contiguously, so a whole neighborhood almost always sits in one page.
+ * Inside a tile the cells are either row-major or in Z-order.
+ *
+ * Work goes a tile at a time. In-tile offsets of every row and column are
+ * precomputed, so the tile interior needs no per-cell index arithmetic or
+ * edge test; the ring of edge cells is handled in a separate pass through
+ * the general chal4_layout_index accessor. Part 2 only revisits tiles whose
+ * neighborhood changed in the previous round.
+ *
+ * These layouts are kept for comparison, not as the fast path. The layout
+ * bench runs the row-major grid through the serial solver, the same
+ * chal4_row_step kernel the tiled interiors use, so only the layout differs;
+ * row-major is faster at every size it tries, the wide grids included.
+ *
+ * @author Mexeck88
+ *
+ * @date 18OCT26
+ */
+
+#include "aoc_perf.h"
+#include "chal4_layout.h"
+#include "chal4_simd.h"
+
+/**
+ * @brief Layout names used in benchmark output, indexed by kind
+ */
+static const char * const gp_layout_names[LAYOUT_COUNT] = {
+    "row-major",
+    "tiled",
+    "morton",
+};
+
+/**
+ * @brief Grid sizes (width, height) used by the layout benchmark: squares,
+ * then wide grids whose rows are pages or more apart
+ */
+static const size_t g_bench_sizes[][2] = {
+    { 256, 256 },   { 1024, 1024 }, { 2048, 2048 },
+    { 8192, 512 },  { 32768, 128 }, { 65536, 64 },
+};
+
+/**
+ * @brief Spreads the low 6 bits of a coordinate onto the even bits
+ *
+ * @param value In-tile coordinate (0 - 63)
+ *
+ * @return Value with bit i moved to bit 2i
+ */
+static size_t
+chal4_layout_spread (size_t value)
+{
+    value = (value | (value << 4)) & 0x0F0F;
+    value = (value | (value << 2)) & 0x3333;
+    value = (value | (value << 1)) & 0x5555;
+    return value;
+}
+
+/**
+ * @brief Fills the in-tile offset tables of a layout for its kind
+ *
+ * @param p_layout Layout with kind set
+ */
+static void
+chal4_layout_codes (chal4_layout_t * p_layout)
+{
+    bool b_morton = (LAYOUT_MORTON == p_layout->kind);
+
+    for (size_t idx = 0; idx < LAYOUT_TILE_EDGE; idx++)
+    {
+        p_layout->row_code[idx]
+            = (uint16_t)(b_morton ? (chal4_layout_spread(idx) << 1)
+                                  : (idx << LAYOUT_TILE_SHIFT));
+        p_layout->col_code[idx]
+            = (uint16_t)(b_morton ? chal4_layout_spread(idx) : idx);
+    }
+}
+
+/**
+ * @brief Returns the storage index of layout cell (y, x)
+ *
+ * @param p_layout Layout
+ * @param y Layout row (data row + 1)
+ * @param x Layout column (data column + 1)
+ *
+ * @return Index into p_layout->p_cells
+ */
+size_t
+chal4_layout_index (const chal4_layout_t * p_layout, size_t y, size_t x)
+{
+    size_t tile = ((y >> LAYOUT_TILE_SHIFT) * p_layout->tiles_x)
+                  + (x >> LAYOUT_TILE_SHIFT);
+
+    return (tile * LAYOUT_TILE_CELLS) | p_layout->row_code[y & LAYOUT_TILE_MASK]
+           | p_layout->col_code[x & LAYOUT_TILE_MASK];
+}
+
+/**
+ * @brief Counts the occupied neighbors of layout cell (y, x)
+ *
+ * Works for any cell with a full neighborhood inside the layout, i.e. every
+ * data cell.
+ *
+ * @param p_layout Layout
+ * @param y Layout row
+ * @param x Layout column
+ *
+ * @return Number of occupied neighbors (0 - 8)
+ */
+int
+chal4_layout_neighbors (const chal4_layout_t * p_layout, size_t y, size_t x)
+{
+    const uint8_t * p_cells = p_layout->p_cells;
+
+    return p_cells[chal4_layout_index(p_layout, y - 1, x - 1)]
+           + p_cells[chal4_layout_index(p_layout, y - 1, x)]
+           + p_cells[chal4_layout_index(p_layout, y - 1, x + 1)]
+           + p_cells[chal4_layout_index(p_layout, y, x - 1)]
+           + p_cells[chal4_layout_index(p_layout, y, x + 1)]
+           + p_cells[chal4_layout_index(p_layout, y + 1, x - 1)]
+           + p_cells[chal4_layout_index(p_layout, y + 1, x)]
+           + p_cells[chal4_layout_index(p_layout, y + 1, x + 1)];
+}
+
+/**
+ * @brief Allocates zeroed tiles for a width x height data grid plus border
+ *
+ * @param p_layout Layout with kind, width and height set
+ *
+ * @return RET_SUCCESS on success, RET_FAILURE on failure
+ */
+static uint8_t
+chal4_layout_alloc (chal4_layout_t * p_layout)
+{
+    uint8_t retcode = RET_FAILURE;
+    size_t  bytes   = 0;
+
+    p_layout->tiles_x = (p_layout->width + (2 * GRID_BORDER) + LAYOUT_TILE_MASK)
+                        >> LAYOUT_TILE_SHIFT;
+    p_layout->tiles_y
+        = (p_layout->height + (2 * GRID_BORDER) + LAYOUT_TILE_MASK)
+          >> LAYOUT_TILE_SHIFT;
+    bytes = p_layout->tiles_x * p_layout->tiles_y * LAYOUT_TILE_CELLS;
+    chal4_layout_codes(p_layout);
+
+    p_layout->p_cells = aligned_alloc(LAYOUT_TILE_CELLS, bytes);
+    if (NULL == p_layout->p_cells)
+    {
+        perror("ERROR: Unable to allocate memory for layout");
+        goto EXIT;
+    }
+
+    memset(p_layout->p_cells, 0, bytes);
+
+    retcode = RET_SUCCESS;
+EXIT:
+    return retcode;
+}
+
+/**
+ * @brief Allocates an empty layout of the same kind and size as another
+ *
+ * @param p_model Layout to copy the geometry from
+ * @param p_layout Layout to allocate
+ *
+ * @return RET_SUCCESS on success, RET_FAILURE on failure
+ */
+uint8_t
+chal4_layout_alloc_like (const chal4_layout_t * p_model,
+                         chal4_layout_t *       p_layout)
+{
+    uint8_t retcode = RET_FAILURE;
+
+    if ((NULL == p_model) || (NULL == p_layout))
+    {
+        perror("ERROR: NULL pointer passed to layout_alloc_like\n");
+        goto EXIT;
+    }
+
+    memset(p_layout, 0, sizeof(*p_layout));
+    p_layout->kind   = p_model->kind;
+    p_layout->width  = p_model->width;
+    p_layout->height = p_model->height;
+
+    retcode = chal4_layout_alloc(p_layout);
+EXIT:
+    return retcode;
+}
+
+/**
+ * @brief Copies a row-major grid into a tiled or Morton layout
+ *
+ * @param p_grid Loaded row-major grid
+ * @param kind LAYOUT_TILED or LAYOUT_MORTON
+ * @param p_layout Layout to allocate and fill
+ *
+ * @return RET_SUCCESS on success, RET_FAILURE on failure
+ */
+uint8_t
+chal4_layout_from_grid (const chal4_grid_t * p_grid,
+                        chal4_layout_kind_t  kind,
+                        chal4_layout_t *     p_layout)
+{
+    uint8_t         retcode = RET_FAILURE;
+    const uint8_t * p_row   = NULL;
+
+    if ((NULL == p_grid) || (NULL == p_layout)
+        || ((LAYOUT_TILED != kind) && (LAYOUT_MORTON != kind)))
+    {
+        perror("ERROR: Invalid arguments passed to layout_from_grid\n");
+        goto EXIT;
+    }
+
+    memset(p_layout, 0, sizeof(*p_layout));
+    p_layout->kind   = kind;
+    p_layout->width  = p_grid->width;
+    p_layout->height = p_grid->height;
+
+    if (RET_SUCCESS != chal4_layout_alloc(p_layout))
+    {
+        goto EXIT;
+    }
+
+    for (size_t row = 0; row < p_grid->height; row++)
+    {
+        p_row = CHAL4_ROW(p_grid, row);
+
+        for (size_t col = 0; col < p_grid->width; col++)
+        {
+            p_layout->p_cells[chal4_layout_index(p_layout, row + 1, col + 1)]
+                = p_row[col];
+        }
+    }
+
+    retcode = RET_SUCCESS;
+EXIT:
+    return retcode;
+}
+
+/**
+ * @brief Releases the tiles of a layout
+ *
+ * @param p_layout Layout to release
+ */
+void
+chal4_layout_free (chal4_layout_t * p_layout)
+{
+    if (NULL != p_layout)
+    {
+        free(p_layout->p_cells);
+        p_layout->p_cells = NULL;
+    }
+}
+
+/**
+ * @brief Applies the default rule to the tile-interior cells of a tiled
+ * layout tile, one row run at a time on the dispatched row kernel
+ *
+ * @param p_tile First cell of the tile
+ * @param p_dest Same tile of the next layout, or NULL to only count
+ *
+ * @return Number of accessible (removed) rolls
+ */
+static long
+chal4_layout_tiled_interior (const uint8_t * p_tile, uint8_t * p_dest)
+{
+    long   removed = 0;
+    size_t offset  = 0;
+
+    for (size_t in_y = 1; in_y < LAYOUT_TILE_MASK; in_y++)
+    {
+        offset = (in_y << LAYOUT_TILE_SHIFT) + 1;
+        removed += chal4_row_step(&p_tile[offset],
+                                  LAYOUT_TILE_EDGE,
+                                  (NULL != p_dest) ? &p_dest[offset] : NULL,
+                                  LAYOUT_TILE_EDGE - 2);
+    }
+
+    return removed;
+}
+
+/**
+ * @brief Applies the default rule to the tile-interior cells of a Morton
+ * layout tile through the offset tables
+ *
+ * @param p_layout Layout, for its offset tables
+ * @param p_tile First cell of the tile
+ * @param p_dest Same tile of the next layout, or NULL to only count
+ *
+ * @return Number of accessible (removed) rolls
+ */
+static long
+chal4_layout_morton_interior (const chal4_layout_t * p_layout,
+                              const uint8_t *        p_tile,
+                              uint8_t *              p_dest)
+{
+    long     removed   = 0;
+    int      neighbors = 0;
+    uint8_t  cell      = 0;
+    uint8_t  alive     = 0;
+    size_t   up        = 0;
+    size_t   mid       = 0;
+    size_t   down      = 0;
+    const uint16_t * p_rows = p_layout->row_code;
+    const uint16_t * p_cols = p_layout->col_code;
+
+    for (size_t in_y = 1; in_y < LAYOUT_TILE_MASK; in_y++)
+    {
+        up   = p_rows[in_y - 1];
+        mid  = p_rows[in_y];
+        down = p_rows[in_y + 1];
+
+        for (size_t in_x = 1; in_x < LAYOUT_TILE_MASK; in_x++)
+        {
+            // Most cells are empty in late rounds; the older layout may not be
+            cell = p_tile[mid | p_cols[in_x]];
+            if (0 == cell)
+            {
+                if (NULL != p_dest)
+                {
+                    p_dest[mid | p_cols[in_x]] = 0;
+                }
+                continue;
+            }
+
+            neighbors = p_tile[up | p_cols[in_x - 1]] + p_tile[up | p_cols[in_x]]
+                        + p_tile[up | p_cols[in_x + 1]]
+                        + p_tile[mid | p_cols[in_x - 1]]
+                        + p_tile[mid | p_cols[in_x + 1]]
+                        + p_tile[down | p_cols[in_x - 1]]
+                        + p_tile[down | p_cols[in_x]]
+                        + p_tile[down | p_cols[in_x + 1]];
+            alive = cell & (uint8_t)(NEIGHBOR_COUNT <= neighbors);
+            removed += cell - alive;
+
+            if (NULL != p_dest)
+            {
+                p_dest[mid | p_cols[in_x]] = alive;
+            }
+        }
+    }
+
+    return removed;
+}
+
+/**
+ * @brief Applies the default rule to the data cells on the edges of a tile,
+ * whose neighborhoods reach into the tiles around it
+ *
+ * @param p_layout Current layout (read only)
+ * @param p_next Next layout, or NULL to only count
+ * @param tile_y Tile row
+ * @param tile_x Tile column
+ *
+ * @return Number of accessible (removed) rolls
+ */
+static long
+chal4_layout_tile_edges (const chal4_layout_t * p_layout,
+                         chal4_layout_t *       p_next,
+                         size_t                 tile_y,
+                         size_t                 tile_x)
+{
+    long   removed = 0;
+    size_t step    = 0;
+    size_t index   = 0;
+    size_t y       = 0;
+    size_t x       = 0;
+    bool   b_alive = false;
+
+    for (size_t in_y = 0; in_y < LAYOUT_TILE_EDGE; in_y++)
+    {
+        y = (tile_y << LAYOUT_TILE_SHIFT) + in_y;
+        if ((GRID_BORDER > y) || (p_layout->height < y))
+        {
+            continue;
+        }
+
+        // The whole first and last row, else only the first and last cell
+        step = ((0 == in_y) || (LAYOUT_TILE_MASK == in_y)) ? 1
+                                                           : LAYOUT_TILE_MASK;
+
+        for (size_t in_x = 0; in_x < LAYOUT_TILE_EDGE; in_x += step)
+        {
+            x = (tile_x << LAYOUT_TILE_SHIFT) + in_x;
+            if ((GRID_BORDER > x) || (p_layout->width < x))
+            {
+                continue;
+            }
+
+            index   = chal4_layout_index(p_layout, y, x);
+            b_alive = (1 == p_layout->p_cells[index])
+                      && (NEIGHBOR_COUNT
+                          <= chal4_layout_neighbors(p_layout, y, x));
+            removed += p_layout->p_cells[index] - (long)b_alive;
+
+            if (NULL != p_next)
+            {
+                p_next->p_cells[index] = (uint8_t)b_alive;
+            }
+        }
+    }
+
+    return removed;
+}
+
+/**
+ * @brief Runs the default rule over one tile
+ *
+ * Every data cell of the tile is written into p_next, so the next layout
+ * never has to be cleared. Padding cells are 0 and stay 0.
+ *
+ * @param p_layout Current layout (read only)
+ * @param p_next Next layout, or NULL to only count
+ * @param tile_y Tile row
+ * @param tile_x Tile column
+ *
+ * @return Number of accessible (removed) rolls in the tile
+ */
+static long
+chal4_layout_tile (const chal4_layout_t * p_layout,
+                   chal4_layout_t *       p_next,
+                   size_t                 tile_y,
+                   size_t                 tile_x)
+{
+    size_t          base   = ((tile_y * p_layout->tiles_x) + tile_x)
+                    * LAYOUT_TILE_CELLS;
+    const uint8_t * p_tile = &p_layout->p_cells[base];
+    uint8_t *       p_dest = (NULL != p_next) ? &p_next->p_cells[base] : NULL;
+    long            removed = 0;
+
+    removed = (LAYOUT_TILED == p_layout->kind)
+                  ? chal4_layout_tiled_interior(p_tile, p_dest)
+                  : chal4_layout_morton_interior(p_layout, p_tile, p_dest);
+
+    return removed + chal4_layout_tile_edges(p_layout, p_next, tile_y, tile_x);
+}
+
+/**
+ * @brief Runs one pass of the default rule over a layout, tile by tile
+ *
+ * With p_next NULL only the accessible rolls are counted (part 1); otherwise
+ * every data cell of p_next is written with its survivor (one part 2 round).
+ *
+ * @param p_layout Current layout (read only)
+ * @param p_next Next layout of the same geometry, or NULL
+ *
+ * @return Number of accessible (removed) rolls
+ */
+long
+chal4_layout_pass (const chal4_layout_t * p_layout, chal4_layout_t * p_next)
+{
+    long removed = 0;
+
+    for (size_t tile_y = 0; tile_y < p_layout->tiles_y; tile_y++)
+    {
+        for (size_t tile_x = 0; tile_x < p_layout->tiles_x; tile_x++)
+        {
+            removed += chal4_layout_tile(p_layout, p_next, tile_y, tile_x);
+        }
+    }
+
+    return removed;
+}
+
+/**
+ * @brief Flags a tile and its eight neighbor tiles
+ *
+ * @param p_layout Layout, for its tile counts
+ * @param p_flags One byte per tile
+ * @param tile_y Tile row
+ * @param tile_x Tile column
+ */
+static void
+chal4_layout_mark (const chal4_layout_t * p_layout,
+                   uint8_t *              p_flags,
+                   size_t                 tile_y,
+                   size_t                 tile_x)
+{
+    size_t y_first = (0 < tile_y) ? tile_y - 1 : 0;
+    size_t x_first = (0 < tile_x) ? tile_x - 1 : 0;
+    size_t y_last  = (tile_y + 1 < p_layout->tiles_y) ? tile_y + 1 : tile_y;
+    size_t x_last  = (tile_x + 1 < p_layout->tiles_x) ? tile_x + 1 : tile_x;
+
+    for (size_t y = y_first; y <= y_last; y++)
+    {
+        memset(&p_flags[(y * p_layout->tiles_x) + x_first],
+               1,
+               x_last - x_first + 1);
+    }
+}
+
+/**
+ * @brief Runs synchronous part 2 rounds on a layout until nothing moves
+ *
+ * A round only visits the tiles next to a removal of the round before. A
+ * skipped tile is the same in both layouts: it did not change last round, so
+ * the older layout still holds its current cells.
+ *
+ * @param p_layout Current layout, holds the stable layout on return
+ * @param p_next Layout of the same geometry used as the next-round buffer
+ * @param p_removed Incremented by the number of rolls removed
+ * @param p_stats Receives the removals and wall time of every round
+ *
+ * @return RET_SUCCESS on success, RET_FAILURE on failure
+ */
+uint8_t
+chal4_layout_part2 (chal4_layout_t *      p_layout,
+                    chal4_layout_t *      p_next,
+                    long *                p_removed,
+                    chal4_round_stats_t * p_stats)
+{
+    uint8_t         retcode       = RET_FAILURE;
+    long            round_removed = 0;
+    long            tile_removed  = 0;
+    size_t          tiles         = 0;
+    uint8_t *       p_active      = NULL;
+    uint8_t *       p_marked      = NULL;
+    uint8_t *       p_flags       = NULL;
+    chal4_layout_t  swap;
+    struct timespec round_start;
+
+    if ((NULL == p_layout) || (NULL == p_next) || (NULL == p_removed)
+        || (NULL == p_stats))
+    {
+        perror("ERROR: NULL pointer passed to layout_part2\n");
+        goto EXIT;
+    }
+
+    // The first round checks every tile
+    tiles    = p_layout->tiles_x * p_layout->tiles_y;
+    p_active = malloc(tiles);
+    p_marked = calloc(tiles, 1);
+    if ((NULL == p_active) || (NULL == p_marked))
+    {
+        perror("ERROR: Unable to allocate memory for tile flags");
+        goto EXIT;
+    }
+
+    memset(p_active, 1, tiles);
+
+    do
+    {
+        clock_gettime(CLOCK_MONOTONIC, &round_start);
+        round_removed = 0;
+
+        for (size_t tile_y = 0; tile_y < p_layout->tiles_y; tile_y++)
+        {
+            for (size_t tile_x = 0; tile_x < p_layout->tiles_x; tile_x++)
+            {
+                if (0 == p_active[(tile_y * p_layout->tiles_x) + tile_x])
+                {
+                    continue;
+                }
+
+                tile_removed
+                    = chal4_layout_tile(p_layout, p_next, tile_y, tile_x);
+                if (0 < tile_removed)
+                {
+                    chal4_layout_mark(p_layout, p_marked, tile_y, tile_x);
+                    round_removed += tile_removed;
+                }
+            }
+        }
+
+        // Only tiles next to a removal can change next round
+        p_flags  = p_active;
+        p_active = p_marked;
+        p_marked = p_flags;
+        memset(p_marked, 0, tiles);
+
+        swap      = *p_layout;
+        *p_layout = *p_next;
+        *p_next   = swap;
+
+        *p_removed += round_removed;
+
+        if (RET_SUCCESS
+            != chal4_round_stats_add(
+                p_stats, round_removed, chal4_elapsed_ms(&round_start)))
+        {
+            goto EXIT;
+        }
+    } while (0 < round_removed);
+
+    retcode = RET_SUCCESS;
+EXIT:
+    free(p_active);
+    free(p_marked);
+    return retcode;
+}
+
+/**
+ * @brief Fills a row-major grid with a fixed pseudo-random pattern
+ *
+ * @param p_grid Allocated grid
+ * @param seed Generator seed
+ */
+static void
+chal4_layout_bench_fill (chal4_grid_t * p_grid, uint64_t seed)
+{
+    uint8_t * p_row = NULL;
+
+    for (size_t row = 0; row < p_grid->height; row++)
+    {
+        p_row = CHAL4_ROW(p_grid, row);
+
+        for (size_t col = 0; col < p_grid->width; col++)
+        {
+            // 64-bit LCG, top bits give a ~60% dense grid like the input
+            seed       = (seed * 6364136223846793005ULL) + 1442695040888963407ULL;
+            p_row[col] = (uint8_t)((seed >> 33) % 5 < 3); // 0 or 1
+        }
+    }
+}
+
+/**
+ * @brief Prints one benchmark line
+ *
+ * @param p_grid Grid benchmarked, for its size
+ * @param kind Layout
+ * @param p1_ms Total part 1 time over all passes
+ * @param p1_misses Cache misses over all part 1 passes
+ * @param p2_ms Part 2 time
+ * @param p2_misses Cache misses during part 2
+ * @param b_counters True if cache-miss counts are real
+ * @param answer Part 2 answer, for checking the layouts agree
+ */
+static void
+chal4_layout_bench_print (const chal4_grid_t * p_grid,
+                          chal4_layout_kind_t  kind,
+                          double              p1_ms,
+                          uint64_t            p1_misses,
+                          double              p2_ms,
+                          uint64_t            p2_misses,
+                          bool                b_counters,
+                          long                answer)
+{
+    double cells = (double)p_grid->width * (double)p_grid->height;
+
+    printf("%5zux%-5zu %-10s part1 %9.1f Mcells/s ",
+           p_grid->width,
+           p_grid->height,
+           gp_layout_names[kind],
+           (cells * LAYOUT_BENCH_PASSES) / (p1_ms * MS_PER_SEC));
+
+    if (true == b_counters)
+    {
+        printf("%6.3f miss/cell ",
+               (double)p1_misses / (cells * LAYOUT_BENCH_PASSES));
+    }
+    else
+    {
+        printf("   n/a miss/cell ");
+    }
+
+    printf("| part2 %9.2f ms ", p2_ms);
+
+    if (true == b_counters)
+    {
+        printf("%6.3f miss/cell ", (double)p2_misses / cells);
+    }
+    else
+    {
+        printf("   n/a miss/cell ");
+    }
+
+    printf("| answer %ld\n", answer);
+}
+
+/**
+ * @brief Times one layout at one size: repeated part 1 passes, then part 2
+ *
+ * The row-major case runs the serial solver (chal4_process_line_part1 and
+ * chal4_process_line_part2), so every layout uses the chal4_row_step kernel.
+ *
+ * @param p_grid Row-major source grid (consumed by the row-major run)
+ * @param p_scratch Zeroed row-major scratch grid of the same size; the
+ * row-major run may swap it with p_grid
+ * @param kind Layout to time
+ * @param p_perf Open counters; only cache misses are reported
+ * @param p_answer Part 2 answer
+ *
+ * @return RET_SUCCESS on success, RET_FAILURE on failure
+ */
+static uint8_t
+chal4_layout_bench_one (chal4_grid_t *      p_grid,
+                        chal4_grid_t *      p_scratch,
+                        chal4_layout_kind_t kind,
+                        const aoc_perf_t *  p_perf,
+                        long *              p_answer)
+{
+    uint8_t             retcode   = RET_FAILURE;
+    double              p1_ms     = 0.0;
+    double              p2_ms     = 0.0;
+    chal4_layout_t      layout;
+    chal4_layout_t      next;
+    main_args_t         serial;
+    chal4_round_stats_t stats;
+    aoc_perf_sample_t   p1_counts;
+    aoc_perf_sample_t   p2_counts;
+    struct timespec     start;
+
+    memset(&layout, 0, sizeof(layout));
+    memset(&p1_counts, 0, sizeof(p1_counts));
+    memset(&p2_counts, 0, sizeof(p2_counts));
+    memset(&next, 0, sizeof(next));
+    memset(&stats, 0, sizeof(stats));
+    memset(&serial, 0, sizeof(serial));
+    *p_answer = 0;
+
+    // The serial solver works on grids it owns; they are handed back below
+    serial.grid    = *p_grid;
+    serial.scratch = *p_scratch;
+
+    if ((LAYOUT_ROW_MAJOR != kind)
+        && ((RET_SUCCESS != chal4_layout_from_grid(p_grid, kind, &layout))
+            || (RET_SUCCESS != chal4_layout_alloc_like(&layout, &next))))
+    {
+        goto EXIT;
+    }
+
+    aoc_perf_start(p_perf);
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (int pass = 0; pass < LAYOUT_BENCH_PASSES; pass++)
+    {
+        if (LAYOUT_ROW_MAJOR == kind)
+        {
+            chal4_process_line_part1(&serial);
+        }
+        else
+        {
+            chal4_layout_pass(&layout, NULL);
+        }
+    }
+    p1_ms = chal4_elapsed_ms(&start);
+    aoc_perf_stop(p_perf, &p1_counts);
+
+    aoc_perf_start(p_perf);
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    if (LAYOUT_ROW_MAJOR == kind)
+    {
+        retcode   = chal4_process_line_part2(&serial);
+        *p_answer = serial.solution_2;
+    }
+    else
+    {
+        retcode = chal4_layout_part2(&layout, &next, p_answer, &stats);
+    }
+    p2_ms = chal4_elapsed_ms(&start);
+    aoc_perf_stop(p_perf, &p2_counts);
+
+    // Part 2 swaps the two grids; both stay owned by the caller
+    *p_grid    = serial.grid;
+    *p_scratch = serial.scratch;
+
+    if (RET_SUCCESS == retcode)
+    {
+        chal4_layout_bench_print(p_grid,
+                                 kind,
+                                 p1_ms,
+                                 p1_counts.value[AOC_PERF_CACHE_MISSES],
+                                 p2_ms,
+                                 p2_counts.value[AOC_PERF_CACHE_MISSES],
+                                 (0 <= p_perf->fd[AOC_PERF_CACHE_MISSES]),
+                                 *p_answer);
+    }
+
+EXIT:
+    chal4_round_stats_free(&stats);
+    chal4_layout_free(&layout);
+    chal4_layout_free(&next);
+    return retcode;
+}
+
+/**
+ * @brief Compares part 1 throughput, part 2 time and cache misses of the
+ * row-major, tiled and Morton layouts at several grid sizes
+ *
+ * Cache misses come from aoc_perf and print as n/a where the counter is not
+ * available.
+ *
+ * @return RET_SUCCESS if every layout agreed, RET_FAILURE otherwise
+ */
+uint8_t
+chal4_layout_bench (void)
+{
+    uint8_t      retcode    = RET_FAILURE;
+    aoc_perf_t   perf;
+    size_t       width      = 0;
+    size_t       height     = 0;
+    long         answers[LAYOUT_COUNT];
+    chal4_grid_t grid;
+    chal4_grid_t scratch;
+
+    memset(&grid, 0, sizeof(grid));
+    memset(&scratch, 0, sizeof(scratch));
+
+    // A missing counter is listed on stderr; its column prints as n/a
+    (void)aoc_perf_open(&perf);
+
+    for (size_t idx = 0; idx < (sizeof(g_bench_sizes) / sizeof(g_bench_sizes[0]));
+         idx++)
+    {
+        width  = g_bench_sizes[idx][0];
+        height = g_bench_sizes[idx][1];
+
+        if ((RET_SUCCESS != chal4_grid_alloc(&grid, width, height, GRID_BORDER))
+            || (RET_SUCCESS
+                != chal4_grid_alloc(&scratch, width, height, GRID_BORDER)))
+        {
+            goto EXIT;
+        }
+
+        // Row-major runs last since its part 2 consumes the grid
+        for (int kind = LAYOUT_COUNT - 1; kind >= 0; kind--)
+        {
+            chal4_layout_bench_fill(&grid, width);
+
+            if (RET_SUCCESS
+                != chal4_layout_bench_one(&grid,
+                                          &scratch,
+                                          (chal4_layout_kind_t)kind, // < COUNT
+                                          &perf,
+                                          &answers[kind]))
+            {
+                goto EXIT;
+            }
+        }
+
+        if ((answers[LAYOUT_ROW_MAJOR] != answers[LAYOUT_TILED])
+            || (answers[LAYOUT_ROW_MAJOR] != answers[LAYOUT_MORTON]))
+        {
+            printf("ERROR: Layouts disagree at %zux%zu\n", width, height);
+            goto EXIT;
+        }
+
+        chal4_grid_free(&grid);
+        chal4_grid_free(&scratch);
+    }
+
+    retcode = RET_SUCCESS;
+EXIT:
+    chal4_grid_free(&grid);
+    chal4_grid_free(&scratch);
+    aoc_perf_close(&perf);
+    return retcode;
+}
+
+/** END OF FILE **/
\ No newline at end of file
@@ -0,0 +1,662 @@
+/**
+ * @file chal4_peel.c
+ *
+ * @brief Lock-free parallel peeling for Advent of Code 2025 Challenge 4
+ *
+ * Removing a roll with fewer than NEIGHBOR_COUNT neighbors can only lower
+ * the counts of other rolls, so the rolls left at the end do not depend on
+ * the removal order and part 2 does not need synchronous rounds.
+ *
+ * Every roll keeps its neighbor count in an atomic byte. A thread removes a
+ * roll by decrementing the counts around it; the one decrement that takes a
+ * count from NEIGHBOR_COUNT to NEIGHBOR_COUNT - 1 makes that neighbor
+ * removable, and the thread that did it owns the neighbor and pushes it on
+ * its own work queue. Each roll is therefore removed exactly once.
+ *
+ * The work queues are Chase-Lev deques: the owner pushes and takes at the
+ * bottom, idle threads steal from the top. Each deque starts small and
+ * doubles its ring when full, so queue memory follows the rolls actually
+ * queued, not the grid size times the thread count. A shared pending counter holds
+ * the rolls that are queued or being removed; when it reaches zero nothing
+ * else can become removable and the threads stop.
+ *
+ * @author Mexeck88
+ *
+ * @date 18OCT26
+ */
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+
+#include "chal4_peel.h"
+
+/**
+ * @enum peel_start_t
+ * @brief Start gate states, so no thread reaches the barrier unless all of
+ * them were created
+ */
+typedef enum peel_start_t
+{
+    PEEL_WAIT = 0,
+    PEEL_GO,
+    PEEL_ABORT,
+} peel_start_t;
+
+/**
+ * @enum peel_info_t
+ * @brief Work queue constants
+ */
+typedef enum peel_info_t
+{
+    PEEL_RING_MIN = 1024, // First ring of every deque, a power of two
+} peel_info_t;
+
+/**
+ * @struct chal4_peel_ring_t
+ * @brief Circular buffer of a deque; slot i holds index i & mask
+ *
+ * A full ring is copied into one twice its size. The old one is kept until
+ * the run ends, because a thief may still be reading a slot of it.
+ */
+typedef struct chal4_peel_ring_t
+{
+    size_t                     mask;    // Capacity - 1
+    struct chal4_peel_ring_t * p_older; // Ring this one replaced
+    size_t                     cells[];
+} chal4_peel_ring_t;
+
+/**
+ * @struct chal4_peel_deque_t
+ * @brief Work-stealing deque of cell offsets from the grid origin
+ */
+typedef struct chal4_peel_deque_t
+{
+    _Alignas(CACHE_LINE_SIZE) atomic_long top; // Next slot to steal
+    _Alignas(CACHE_LINE_SIZE) atomic_long bottom; // Next free slot (owner)
+    _Atomic(chal4_peel_ring_t *) p_ring;
+} chal4_peel_deque_t;
+
+/**
+ * @struct chal4_peel_shared_t
+ * @brief State shared by all peeling threads
+ */
+typedef struct chal4_peel_shared_t
+{
+    chal4_grid_t *           p_grid;    // Input rolls (read only while peeling)
+    atomic_uchar *           p_counts;  // Neighbor counts, indexed like p_cells
+    struct chal4_peel_worker_t * p_workers;
+    int                      thread_count;
+    atomic_long              pending;   // Rolls queued or being removed
+    atomic_bool              b_failed;  // A queue could not grow
+    atomic_int               start;     // PEEL_WAIT, PEEL_GO or PEEL_ABORT
+    pthread_barrier_t        barrier;   // Seeding done / peeling done
+} chal4_peel_shared_t;
+
+/**
+ * @struct chal4_peel_worker_t
+ * @brief One thread's rows, queue and counters
+ */
+typedef struct chal4_peel_worker_t
+{
+    chal4_peel_deque_t    deque;
+    size_t                row_start; // First data row seeded by this thread
+    size_t                row_end;   // One past the last data row
+    long                  seeded;    // Rolls accessible in the input
+    long                  removed;   // Rolls removed by this thread
+    long                  stolen;    // Rolls taken from other queues
+    int                   index;
+    chal4_peel_shared_t * p_shared;
+    pthread_t             thread;
+} chal4_peel_worker_t;
+
+/**
+ * @brief Allocates an empty ring
+ *
+ * @param capacity Slots, a power of two
+ * @param p_older Ring it replaces, NULL for the first one
+ *
+ * @return The ring, NULL on failure
+ */
+static chal4_peel_ring_t *
+chal4_peel_ring_alloc (size_t capacity, chal4_peel_ring_t * p_older)
+{
+    chal4_peel_ring_t * p_ring
+        = malloc(sizeof(chal4_peel_ring_t) + (capacity * sizeof(size_t)));
+
+    if (NULL != p_ring)
+    {
+        p_ring->mask    = capacity - 1;
+        p_ring->p_older = p_older;
+    }
+
+    return p_ring;
+}
+
+/**
+ * @brief Pushes a cell on the owner's end of a deque, doubling its ring when
+ * it is full
+ *
+ * @param p_deque Deque owned by the calling thread
+ * @param cell Cell offset from the grid origin
+ *
+ * @return true on success, false if the ring could not grow
+ */
+static bool
+chal4_peel_push (chal4_peel_deque_t * p_deque, size_t cell)
+{
+    long bottom = atomic_load_explicit(&p_deque->bottom, memory_order_relaxed);
+    long top    = atomic_load_explicit(&p_deque->top, memory_order_acquire);
+    chal4_peel_ring_t * p_ring
+        = atomic_load_explicit(&p_deque->p_ring, memory_order_relaxed);
+    chal4_peel_ring_t * p_grown = NULL;
+
+    if ((size_t)(bottom - top) > p_ring->mask)
+    {
+        p_grown = chal4_peel_ring_alloc(2 * (p_ring->mask + 1), p_ring);
+        if (NULL == p_grown)
+        {
+            perror("ERROR: Unable to grow work queue");
+            return false;
+        }
+
+        for (long idx = top; idx < bottom; idx++)
+        {
+            p_grown->cells[(size_t)idx & p_grown->mask]
+                = p_ring->cells[(size_t)idx & p_ring->mask];
+        }
+
+        // Thieves see the copied slots before the new ring
+        atomic_store_explicit(&p_deque->p_ring, p_grown, memory_order_release);
+        p_ring = p_grown;
+    }
+
+    p_ring->cells[(size_t)bottom & p_ring->mask] = cell;
+
+    // Publish the slot before the new bottom
+    atomic_thread_fence(memory_order_release);
+    atomic_store_explicit(&p_deque->bottom, bottom + 1, memory_order_relaxed);
+    return true;
+}
+
+/**
+ * @brief Takes a cell from the owner's end of a deque
+ *
+ * @param p_deque Deque owned by the calling thread
+ * @param p_cell Receives the cell offset
+ *
+ * @return true if a cell was taken, false if the deque was empty
+ */
+static bool
+chal4_peel_take (chal4_peel_deque_t * p_deque, size_t * p_cell)
+{
+    bool                b_found = true;
+    long                top     = 0;
+    chal4_peel_ring_t * p_ring  = NULL;
+    long                bottom
+        = atomic_load_explicit(&p_deque->bottom, memory_order_relaxed) - 1;
+
+    atomic_store_explicit(&p_deque->bottom, bottom, memory_order_relaxed);
+    atomic_thread_fence(memory_order_seq_cst);
+    top = atomic_load_explicit(&p_deque->top, memory_order_relaxed);
+
+    if (top > bottom)
+    {
+        atomic_store_explicit(
+            &p_deque->bottom, bottom + 1, memory_order_relaxed);
+        return false;
+    }
+
+    p_ring  = atomic_load_explicit(&p_deque->p_ring, memory_order_relaxed);
+    *p_cell = p_ring->cells[(size_t)bottom & p_ring->mask];
+
+    // Last cell: race the stealers for it
+    if (top == bottom)
+    {
+        b_found = atomic_compare_exchange_strong_explicit(&p_deque->top,
+                                                          &top,
+                                                          top + 1,
+                                                          memory_order_seq_cst,
+                                                          memory_order_relaxed);
+        atomic_store_explicit(
+            &p_deque->bottom, bottom + 1, memory_order_relaxed);
+    }
+
+    return b_found;
+}
+
+/**
+ * @brief Steals a cell from the far end of another thread's deque
+ *
+ * @param p_deque Victim deque
+ * @param p_cell Receives the cell offset
+ *
+ * @return true if a cell was stolen, false if empty or lost a race
+ */
+static bool
+chal4_peel_steal (chal4_peel_deque_t * p_deque, size_t * p_cell)
+{
+    long top = atomic_load_explicit(&p_deque->top, memory_order_acquire);
+    long bottom = 0;
+    chal4_peel_ring_t * p_ring = NULL;
+
+    atomic_thread_fence(memory_order_seq_cst);
+    bottom = atomic_load_explicit(&p_deque->bottom, memory_order_acquire);
+
+    if (top >= bottom)
+    {
+        return false;
+    }
+
+    // An outgrown ring still holds this slot, the CAS below validates it
+    p_ring  = atomic_load_explicit(&p_deque->p_ring, memory_order_acquire);
+    *p_cell = p_ring->cells[(size_t)top & p_ring->mask];
+
+    return atomic_compare_exchange_strong_explicit(&p_deque->top,
+                                                   &top,
+                                                   top + 1,
+                                                   memory_order_seq_cst,
+                                                   memory_order_relaxed);
+}
+
+/**
+ * @brief Computes the neighbor counts of a band and queues its accessible
+ * rolls
+ *
+ * @param p_worker Worker owning the band
+ */
+static void
+chal4_peel_seed (chal4_peel_worker_t * p_worker)
+{
+    chal4_peel_shared_t * p_shared = p_worker->p_shared;
+    const chal4_grid_t *  p_grid   = p_shared->p_grid;
+    const uint8_t *       p_row    = NULL;
+    size_t                cell     = 0;
+    int                   count    = 0;
+
+    for (size_t row = p_worker->row_start; row < p_worker->row_end; row++)
+    {
+        p_row = CHAL4_ROW(p_grid, row);
+
+        for (size_t col = 0; col < p_grid->width; col++)
+        {
+            if (1 != p_row[col])
+            {
+                continue;
+            }
+
+            cell  = (row * p_grid->stride) + col;
+            count = chal4_check_neighbors(&p_row[col], p_grid->stride);
+            atomic_store_explicit(
+                &p_shared->p_counts[cell], (unsigned char)count, // 0 - 8
+                memory_order_relaxed);
+
+            if (NEIGHBOR_COUNT > count)
+            {
+                p_worker->seeded++;
+                if (false == chal4_peel_push(&p_worker->deque, cell))
+                {
+                    atomic_store(&p_shared->b_failed, true);
+                    p_worker->seeded--; // Never pending
+                }
+            }
+        }
+    }
+
+    atomic_fetch_add(&p_shared->pending, p_worker->seeded);
+}
+
+/**
+ * @brief Removes one roll and queues the neighbors it made removable
+ *
+ * @param p_worker Worker that owns the roll
+ * @param cell Cell offset of the roll
+ */
+static void
+chal4_peel_remove (chal4_peel_worker_t * p_worker, size_t cell)
+{
+    chal4_peel_shared_t * p_shared = p_worker->p_shared;
+    const uint8_t *       p_rolls  = p_shared->p_grid->p_cells;
+    ptrdiff_t             stride   = (ptrdiff_t)p_shared->p_grid->stride;
+    ptrdiff_t             neighbor = 0;
+    long                  pushed   = 0;
+
+    for (ptrdiff_t d_row = -1; d_row <= 1; d_row++)
+    {
+        for (ptrdiff_t d_col = -1; d_col <= 1; d_col++)
+        {
+            neighbor = (ptrdiff_t)cell + (d_row * stride) + d_col;
+
+            if (((0 == d_row) && (0 == d_col)) || (1 != p_rolls[neighbor]))
+            {
+                continue;
+            }
+
+            // Only the decrement that crosses the threshold takes ownership
+            if (NEIGHBOR_COUNT
+                == atomic_fetch_sub_explicit(&p_shared->p_counts[neighbor],
+                                             1,
+                                             memory_order_relaxed))
+            {
+                if (true == chal4_peel_push(&p_worker->deque, (size_t)neighbor))
+                {
+                    pushed++;
+                }
+                else
+                {
+                    // Dropped, so the run still ends; its answers are discarded
+                    atomic_store(&p_shared->b_failed, true);
+                }
+            }
+        }
+    }
+
+    p_worker->removed++;
+
+    // This roll is done, its pushes are now pending
+    if (1 != pushed)
+    {
+        atomic_fetch_add(&p_shared->pending, pushed - 1);
+    }
+}
+
+/**
+ * @brief Steals one cell from any other worker, starting after this one
+ *
+ * @param p_worker Thief
+ * @param p_cell Receives the cell offset
+ *
+ * @return true if a cell was stolen
+ */
+static bool
+chal4_peel_steal_any (chal4_peel_worker_t * p_worker, size_t * p_cell)
+{
+    chal4_peel_shared_t * p_shared = p_worker->p_shared;
+    int                   victim   = 0;
+
+    for (int step = 1; step < p_shared->thread_count; step++)
+    {
+        victim = (p_worker->index + step) % p_shared->thread_count;
+
+        if (true
+            == chal4_peel_steal(&p_shared->p_workers[victim].deque, p_cell))
+        {
+            p_worker->stolen++;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * @brief Clears the removed rolls of a band so the grid holds the stable rolls
+ *
+ * @param p_worker Worker owning the band
+ */
+static void
+chal4_peel_clear (chal4_peel_worker_t * p_worker)
+{
+    chal4_peel_shared_t * p_shared = p_worker->p_shared;
+    chal4_grid_t *        p_grid   = p_shared->p_grid;
+    uint8_t *             p_row    = NULL;
+    size_t                cell     = 0;
+
+    for (size_t row = p_worker->row_start; row < p_worker->row_end; row++)
+    {
+        p_row = CHAL4_ROW(p_grid, row);
+
+        for (size_t col = 0; col < p_grid->width; col++)
+        {
+            cell = (row * p_grid->stride) + col;
+
+            if ((1 == p_row[col])
+                && (NEIGHBOR_COUNT > atomic_load_explicit(
+                        &p_shared->p_counts[cell], memory_order_relaxed)))
+            {
+                p_row[col] = 0;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Thread entry: seeds a band, peels until nothing is pending, then
+ * clears the band
+ *
+ * @param p_arg Pointer to the chal4_peel_worker_t of this thread
+ *
+ * @return NULL
+ */
+static void *
+chal4_peel_worker (void * p_arg)
+{
+    chal4_peel_worker_t * p_worker = p_arg; // void * from pthread_create
+    chal4_peel_shared_t * p_shared = p_worker->p_shared;
+    size_t                cell     = 0;
+    int                   start    = PEEL_WAIT;
+
+    while (PEEL_WAIT == (start = atomic_load(&p_shared->start)))
+    {
+        sched_yield();
+    }
+
+    if (PEEL_ABORT == start)
+    {
+        return NULL;
+    }
+
+    chal4_peel_seed(p_worker);
+
+    // Every count is set before any thread starts decrementing
+    pthread_barrier_wait(&p_shared->barrier);
+
+    for (;;)
+    {
+        if ((true == chal4_peel_take(&p_worker->deque, &cell))
+            || (true == chal4_peel_steal_any(p_worker, &cell)))
+        {
+            chal4_peel_remove(p_worker, cell);
+        }
+        else if (0 == atomic_load(&p_shared->pending))
+        {
+            break;
+        }
+        else
+        {
+            sched_yield(); // Others still hold work
+        }
+    }
+
+    // Counts are final once every thread has stopped reading the grid
+    pthread_barrier_wait(&p_shared->barrier);
+    chal4_peel_clear(p_worker);
+
+    return NULL;
+}
+
+/**
+ * @brief Allocates the workers, their deques and the atomic counts
+ *
+ * @param p_shared Shared state with p_grid and thread_count set;
+ * thread_count is clamped to the number of rows
+ *
+ * @return RET_SUCCESS on success, RET_FAILURE on failure
+ */
+static uint8_t
+chal4_peel_create (chal4_peel_shared_t * p_shared)
+{
+    uint8_t              retcode = RET_FAILURE;
+    const chal4_grid_t * p_grid  = p_shared->p_grid;
+    size_t count      = (size_t)p_shared->thread_count; // Checked > 0
+    size_t cell_count = p_grid->height * p_grid->stride;
+
+    if (count > p_grid->height)
+    {
+        count = (0 < p_grid->height) ? p_grid->height : 1;
+    }
+
+    p_shared->thread_count = (int)count; // count <= requested thread count
+
+    // Counts share the grid's offsets, border rows are never touched
+    p_shared->p_counts = calloc(cell_count, sizeof(atomic_uchar));
+    p_shared->p_workers
+        = aligned_alloc(CACHE_LINE_SIZE, count * sizeof(chal4_peel_worker_t));
+    if ((NULL == p_shared->p_counts) || (NULL == p_shared->p_workers))
+    {
+        perror("ERROR: Unable to allocate memory for peeling");
+        goto EXIT;
+    }
+
+    memset(p_shared->p_workers, 0, count * sizeof(chal4_peel_worker_t));
+
+    for (size_t idx = 0; idx < count; idx++)
+    {
+        chal4_peel_worker_t * p_worker = &p_shared->p_workers[idx];
+
+        p_worker->row_start = (p_grid->height * idx) / count;
+        p_worker->row_end   = (p_grid->height * (idx + 1)) / count;
+        p_worker->index     = (int)idx;
+        p_worker->p_shared  = p_shared;
+
+        atomic_init(&p_worker->deque.top, 0);
+        atomic_init(&p_worker->deque.bottom, 0);
+        atomic_init(&p_worker->deque.p_ring,
+                    chal4_peel_ring_alloc(PEEL_RING_MIN, NULL));
+        if (NULL == atomic_load(&p_worker->deque.p_ring))
+        {
+            perror("ERROR: Unable to allocate memory for work queue");
+            goto EXIT;
+        }
+    }
+
+    retcode = RET_SUCCESS;
+EXIT:
+    return retcode;
+}
+
+/**
+ * @brief Releases the workers and counts of a peeling run
+ *
+ * @param p_shared Shared state
+ */
+static void
+chal4_peel_destroy (chal4_peel_shared_t * p_shared)
+{
+    chal4_peel_ring_t * p_ring  = NULL;
+    chal4_peel_ring_t * p_older = NULL;
+
+    if (NULL != p_shared->p_workers)
+    {
+        for (int idx = 0; idx < p_shared->thread_count; idx++)
+        {
+            p_ring = atomic_load(&p_shared->p_workers[idx].deque.p_ring);
+            while (NULL != p_ring)
+            {
+                p_older = p_ring->p_older;
+                free(p_ring);
+                p_ring = p_older;
+            }
+        }
+    }
+
+    free(p_shared->p_workers);
+    free(p_shared->p_counts);
+    p_shared->p_workers = NULL;
+    p_shared->p_counts  = NULL;
+}
+
+/**
+ * @brief Removes every roll that part 2 would remove, with no rounds
+ *
+ * The rolls accessible in the input are exactly the queue seeds, so the
+ * part 1 answer falls out of the same run.
+ *
+ * @param p_grid Loaded grid, holds the stable grid on return
+ * @param thread_count Number of threads to use
+ * @param p_accessible Incremented by the part 1 answer
+ * @param p_removed Incremented by the part 2 answer
+ * @param p_stolen Incremented by the number of cells stolen between queues
+ *
+ * @return RET_SUCCESS on success, RET_FAILURE on failure
+ */
+uint8_t
+chal4_peel_run (chal4_grid_t * p_grid,
+                int            thread_count,
+                long *         p_accessible,
+                long *         p_removed,
+                long *         p_stolen)
+{
+    uint8_t             retcode = RET_FAILURE;
+    int                 started = 0;
+    chal4_peel_shared_t shared;
+
+    memset(&shared, 0, sizeof(shared));
+
+    if ((NULL == p_grid) || (NULL == p_accessible) || (NULL == p_removed)
+        || (NULL == p_stolen) || (0 >= thread_count))
+    {
+        perror("ERROR: Invalid arguments passed to peel_run\n");
+        goto EXIT;
+    }
+
+    shared.p_grid       = p_grid;
+    shared.thread_count = thread_count;
+    atomic_init(&shared.pending, 0);
+    atomic_init(&shared.start, PEEL_WAIT);
+    atomic_init(&shared.b_failed, false);
+
+    if (RET_SUCCESS != chal4_peel_create(&shared))
+    {
+        goto EXIT;
+    }
+
+    if (0 != pthread_barrier_init(&shared.barrier, NULL, shared.thread_count))
+    {
+        perror("ERROR: Unable to create peeling barrier");
+        goto EXIT;
+    }
+
+    for (started = 0; started < shared.thread_count; started++)
+    {
+        if (0
+            != pthread_create(&shared.p_workers[started].thread,
+                              NULL,
+                              chal4_peel_worker,
+                              &shared.p_workers[started]))
+        {
+            perror("ERROR: Unable to create peeling thread");
+            break;
+        }
+    }
+
+    // A missing thread would leave the others stuck at the barrier
+    atomic_store(&shared.start,
+                 (started < shared.thread_count) ? PEEL_ABORT : PEEL_GO);
+
+    for (int idx = 0; idx < started; idx++)
+    {
+        pthread_join(shared.p_workers[idx].thread, NULL);
+    }
+
+    pthread_barrier_destroy(&shared.barrier);
+
+    if ((started < shared.thread_count) || (true == atomic_load(&shared.b_failed)))
+    {
+        goto EXIT;
+    }
+
+    for (int idx = 0; idx < shared.thread_count; idx++)
+    {
+        *p_accessible += shared.p_workers[idx].seeded;
+        *p_removed += shared.p_workers[idx].removed;
+        *p_stolen += shared.p_workers[idx].stolen;
+    }
+
+    retcode = RET_SUCCESS;
+EXIT:
+    chal4_peel_destroy(&shared);
+    return retcode;
+}
+
+/** END OF FILE **/
\ No newline at end of file
@@ -0,0 +1,149 @@
+/**
+ * @file chal4_pipe.c
+ *
+ * @brief Pipelined grid loader for Advent of Code 2025 Challenge 4
+ *
+ * The reader and parser stages of aoc_pipe run on their own threads and
+ * turn each line into a packed row of cells; this thread appends the rows
+ * to the padded grid as they arrive. The text of the input is never held
+ * whole, which matters for large grids piped in on stdin.
+ *
+ * @author Mexeck88
+ *
+ * @date 18OCT26
+ */
+
+#include "chal4_pipe.h"
+
+/**
+ * @brief Packs one line into a row record: its width, then one 0 or 1 cell
+ * per column (pipeline parser)
+ *
+ * @param p_ctx Unused
+ * @param line Line of the input
+ * @param p_out Where the row is emitted
+ *
+ * @return AOC_SUCCESS on success, AOC_FAILURE on failure
+ */
+static uint8_t
+chal4_pipe_parse (void * p_ctx, aoc_view_t line, aoc_pipe_out_t * p_out)
+{
+    uint8_t * p_record = aoc_pipe_emit(p_out, sizeof(size_t) + line.length);
+    uint8_t * p_cells  = NULL;
+
+    (void)p_ctx;
+
+    if (NULL == p_record)
+    {
+        return AOC_FAILURE;
+    }
+
+    // Records are packed, so the width may be unaligned
+    memcpy(p_record, &line.length, sizeof(size_t));
+    p_cells = p_record + sizeof(size_t);
+
+    for (size_t col = 0; col < line.length; col++)
+    {
+        p_cells[col] = (ROLL_CHAR == line.p_data[col]);
+    }
+
+    return AOC_SUCCESS;
+}
+
+/**
+ * @brief Appends a batch of rows to the grid (pipeline solver)
+ *
+ * @param p_ctx Pointer to the pipelined load state
+ * @param p_batch Width-prefixed rows
+ *
+ * @return AOC_SUCCESS on success, AOC_FAILURE on failure
+ */
+static uint8_t
+chal4_pipe_solve (void * p_ctx, const aoc_pipe_batch_t * p_batch)
+{
+    chal4_pipe_t *  p_pipe   = p_ctx;
+    const uint8_t * p_record = p_batch->p_data;
+    size_t          width    = 0;
+
+    for (size_t idx = 0; idx < p_batch->count; idx++)
+    {
+        memcpy(&width, p_record, sizeof(size_t));
+
+        if (RET_SUCCESS
+            != chal4_grid_append_row(p_pipe->p_grid,
+                                     &p_pipe->row_capacity,
+                                     p_record + sizeof(size_t),
+                                     width))
+        {
+            return AOC_FAILURE;
+        }
+
+        p_record += sizeof(size_t) + width;
+    }
+
+    return AOC_SUCCESS;
+}
+
+/**
+ * @brief Loads the input into a padded grid while it is still being read
+ *
+ * Blank lines are skipped rather than ending the grid.
+ *
+ * @param p_file_path Path to the input file ("-" reads stdin)
+ * @param border Empty cells to keep on every side of the data
+ * @param p_arena Arena to carve the grid from (NULL for the heap)
+ * @param p_grid Grid to fill in (must not own a block)
+ *
+ * @return RET_SUCCESS on success, RET_FAILURE on failure
+ */
+uint8_t
+chal4_pipe_load_input (const char *   p_file_path,
+                       size_t         border,
+                       aoc_arena_t *  p_arena,
+                       chal4_grid_t * p_grid)
+{
+    uint8_t      retcode = RET_FAILURE;
+    chal4_pipe_t state   = { p_grid, INIT_ROWS };
+
+    aoc_pipe_t pipe = {
+        .p_file_path = p_file_path,
+        .p_delims    = LINE_DELIMS,
+        .p_parse     = chal4_pipe_parse,
+        .p_solve     = chal4_pipe_solve,
+        .p_ctx       = &state,
+    };
+
+    if ((NULL == p_file_path) || (NULL == p_grid))
+    {
+        perror("ERROR: NULL pointer passed to pipe_load_input\n");
+        retcode = RET_NULL_POINTER;
+        goto EXIT;
+    }
+
+    memset(p_grid, 0, sizeof(*p_grid));
+    p_grid->p_arena = p_arena;
+    p_grid->border  = border;
+
+    if (AOC_SUCCESS != aoc_pipe_run(&pipe))
+    {
+        goto CLEAN;
+    }
+
+    if (NULL == p_grid->p_block)
+    {
+        printf("ERROR: Input file is empty\n");
+        goto EXIT;
+    }
+
+    chal4_grid_seal(p_grid);
+
+    retcode = RET_SUCCESS;
+    goto EXIT;
+
+CLEAN:
+    chal4_grid_free(p_grid);
+EXIT:
+    return retcode;
+}
+
+/** END OF FILE **/
\ No newline at end of file
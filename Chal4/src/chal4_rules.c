@@ -0,0 +1,523 @@
+/**
+ * @file chal4_rules.c
+ *
+ * @brief Configurable neighborhood rules for Advent of Code 2025 Challenge 4
+ *
+ * Every (shape, radius, threshold) in CHAL4_RULE_LIST gets its own fully
+ * unrolled kernel generated by CHAL4_RULE_KERNEL. Any other rule runs on the
+ * generic kernel, which walks a table of row/column offsets built at runtime.
+ *
+ * Radius 2 rules read two cells past the data, so their grid must be loaded
+ * with a border of at least the rule radius.
+ *
+ * @author Mexeck88
+ *
+ * @date 18OCT26
+ */
+
+#include "chal4_rules.h"
+
+/**
+ * @brief Shape names accepted on the command line, indexed by chal4_shape_t
+ */
+static const char * const gp_shape_names[SHAPE_COUNT] = {
+    "moore",
+    "vonneumann",
+};
+
+// Sum of a horizontal run of 3 or 5 cells centered on p[o]
+#define CHAL4_RUN3(p, o) ((p)[(o) - 1] + (p)[(o)] + (p)[(o) + 1])
+#define CHAL4_RUN5(p, o) \
+    ((p)[(o) - 2] + CHAL4_RUN3((p), (o)) + (p)[(o) + 2])
+
+// Unrolled neighbor sums for each shape and radius (s is the row stride)
+#define CHAL4_SUM_MOORE_1(p, s) \
+    (CHAL4_RUN3((p), -(s)) + (p)[-1] + (p)[1] + CHAL4_RUN3((p), (s)))
+#define CHAL4_SUM_MOORE_2(p, s)                                       \
+    (CHAL4_RUN5((p), -2 * (s)) + CHAL4_RUN5((p), -(s)) + (p)[-2]      \
+     + (p)[-1] + (p)[1] + (p)[2] + CHAL4_RUN5((p), (s))               \
+     + CHAL4_RUN5((p), 2 * (s)))
+#define CHAL4_SUM_VON_NEUMANN_1(p, s) \
+    ((p)[-(s)] + (p)[-1] + (p)[1] + (p)[(s)])
+#define CHAL4_SUM_VON_NEUMANN_2(p, s)                                 \
+    ((p)[-2 * (s)] + CHAL4_RUN3((p), -(s)) + (p)[-2] + (p)[-1]        \
+     + (p)[1] + (p)[2] + CHAL4_RUN3((p), (s)) + (p)[2 * (s)])
+
+/**
+ * @brief Rules that get a specialized kernel: X(shape, radius, threshold)
+ */
+#define CHAL4_RULE_LIST(X)   \
+    X(MOORE, 1, 4)           \
+    X(MOORE, 1, 3)           \
+    X(MOORE, 1, 5)           \
+    X(MOORE, 2, 12)          \
+    X(VON_NEUMANN, 1, 2)     \
+    X(VON_NEUMANN, 1, 3)     \
+    X(VON_NEUMANN, 2, 6)
+
+/**
+ * @brief Generates chal4_rule_<shape>_<radius>_<threshold>, a
+ * chal4_rule_kernel_t with the neighbor sum and threshold baked in
+ */
+#define CHAL4_RULE_KERNEL(shape, radius, threshold)                         \
+    static long chal4_rule_##shape##_##radius##_##threshold(                \
+        const chal4_grid_t * p_grid, chal4_grid_t * p_next)                 \
+    {                                                                       \
+        long            removed = 0;                                        \
+        ptrdiff_t       stride  = (ptrdiff_t)p_grid->stride;                \
+        const uint8_t * p_row   = NULL;                                     \
+        uint8_t *       p_dest  = NULL;                                     \
+                                                                            \
+        for (size_t row = 0; row < p_grid->height; row++)                   \
+        {                                                                   \
+            p_row = CHAL4_ROW(p_grid, row);                                 \
+                                                                            \
+            if (NULL == p_next)                                             \
+            {                                                               \
+                for (size_t col = 0; col < p_grid->width; col++)            \
+                {                                                           \
+                    removed += (1 == p_row[col])                            \
+                               && ((threshold) > CHAL4_SUM_##shape##_##radius( \
+                                       &p_row[col], stride));               \
+                }                                                           \
+                continue;                                                   \
+            }                                                               \
+                                                                            \
+            p_dest = CHAL4_ROW(p_next, row);                                \
+            for (size_t col = 0; col < p_grid->width; col++)                \
+            {                                                               \
+                p_dest[col] = p_row[col];                                   \
+                if ((1 == p_row[col])                                       \
+                    && ((threshold) > CHAL4_SUM_##shape##_##radius(         \
+                            &p_row[col], stride)))                          \
+                {                                                           \
+                    p_dest[col] = 0;                                        \
+                    removed++;                                              \
+                }                                                           \
+            }                                                               \
+        }                                                                   \
+                                                                            \
+        return removed;                                                     \
+    }
+
+CHAL4_RULE_LIST(CHAL4_RULE_KERNEL)
+
+/**
+ * @struct chal4_rule_kernel_entry_t
+ * @brief A rule and its specialized kernel
+ */
+typedef struct chal4_rule_kernel_entry_t
+{
+    chal4_rule_t        rule;
+    chal4_rule_kernel_t p_kernel;
+} chal4_rule_kernel_entry_t;
+
+#define CHAL4_RULE_ENTRY(shape, radius, threshold)     \
+    { { SHAPE_##shape, (radius), (threshold) },        \
+      chal4_rule_##shape##_##radius##_##threshold },
+
+/**
+ * @brief Every specialized kernel, in CHAL4_RULE_LIST order
+ */
+static const chal4_rule_kernel_entry_t g_rule_kernels[] = {
+    CHAL4_RULE_LIST(CHAL4_RULE_ENTRY)
+};
+
+#define RULE_KERNEL_COUNT (sizeof(g_rule_kernels) / sizeof(g_rule_kernels[0]))
+
+/**
+ * @brief Runs one pass of a rule through its runtime offset table
+ *
+ * @param p_engine Bound rule with its offsets
+ * @param p_grid Current grid (read only)
+ * @param p_next Next grid, or NULL to only count
+ *
+ * @return Number of accessible (removed) rolls
+ */
+static long
+chal4_rule_generic (const chal4_rule_engine_t * p_engine,
+                    const chal4_grid_t *        p_grid,
+                    chal4_grid_t *              p_next)
+{
+    long            removed   = 0;
+    int             neighbors = 0;
+    bool            b_removed = false;
+    const uint8_t * p_cell    = NULL;
+    uint8_t *       p_dest    = NULL;
+
+    for (size_t row = 0; row < p_grid->height; row++)
+    {
+        p_cell = CHAL4_ROW(p_grid, row);
+        p_dest = (NULL == p_next) ? NULL : CHAL4_ROW(p_next, row);
+
+        for (size_t col = 0; col < p_grid->width; col++, p_cell++)
+        {
+            b_removed = false;
+
+            if (1 == *p_cell)
+            {
+                neighbors = 0;
+                for (int idx = 0; idx < p_engine->offset_count; idx++)
+                {
+                    neighbors += p_cell[p_engine->offsets[idx]];
+                }
+
+                b_removed = (p_engine->rule.threshold > neighbors);
+                removed += b_removed;
+            }
+
+            if (NULL != p_dest)
+            {
+                p_dest[col] = (true == b_removed) ? 0 : *p_cell;
+            }
+        }
+    }
+
+    return removed;
+}
+
+/**
+ * @brief Parses a rule written as shape:radius:threshold
+ *
+ * @param p_text Rule text, e.g. "moore:1:4" or "vonneumann:2:6"
+ * @param p_rule Parsed rule
+ *
+ * @return RET_SUCCESS on success, RET_FAILURE on failure
+ */
+uint8_t
+chal4_rule_parse (const char * p_text, chal4_rule_t * p_rule)
+{
+    uint8_t retcode                    = RET_FAILURE;
+    char    shape_name[RULE_NAME_SIZE] = { 0 };
+    int     shape                      = 0;
+
+    if ((NULL == p_text) || (NULL == p_rule))
+    {
+        perror("ERROR: NULL pointer passed to rule_parse\n");
+        goto EXIT;
+    }
+
+    if (3
+        != sscanf(p_text,
+                  "%15[a-z]:%d:%d",
+                  shape_name,
+                  &p_rule->radius,
+                  &p_rule->threshold))
+    {
+        printf("ERROR: Rule must be shape:radius:threshold: %s\n", p_text);
+        goto EXIT;
+    }
+
+    for (shape = 0; shape < SHAPE_COUNT; shape++)
+    {
+        if (0 == strcmp(shape_name, gp_shape_names[shape]))
+        {
+            break;
+        }
+    }
+
+    if (SHAPE_COUNT == shape)
+    {
+        printf("ERROR: Unknown neighborhood shape: %s\n", shape_name);
+        goto EXIT;
+    }
+
+    if ((1 > p_rule->radius) || (RULE_RADIUS_MAX < p_rule->radius)
+        || (0 > p_rule->threshold))
+    {
+        printf("ERROR: Rule radius must be 1-%d and threshold >= 0: %s\n",
+               RULE_RADIUS_MAX,
+               p_text);
+        goto EXIT;
+    }
+
+    p_rule->shape = (chal4_shape_t)shape; // Checked < SHAPE_COUNT
+    retcode       = RET_SUCCESS;
+EXIT:
+    return retcode;
+}
+
+/**
+ * @brief Formats a rule as shape:radius:threshold
+ *
+ * @param p_rule Rule to format
+ * @param p_buffer Output buffer
+ * @param size Size of the output buffer
+ */
+void
+chal4_rule_name (const chal4_rule_t * p_rule, char * p_buffer, size_t size)
+{
+    snprintf(p_buffer,
+             size,
+             "%s:%d:%d",
+             gp_shape_names[p_rule->shape],
+             p_rule->radius,
+             p_rule->threshold);
+}
+
+/**
+ * @brief Binds a rule to its specialized kernel and builds its offset table
+ *
+ * @param p_rule Rule to bind
+ * @param stride Row stride of the grids the rule will run on
+ * @param b_generic Force the generic kernel even if a specialized one exists
+ * @param p_engine Bound rule
+ *
+ * @return RET_SUCCESS on success, RET_FAILURE on failure
+ */
+uint8_t
+chal4_rule_bind (const chal4_rule_t *  p_rule,
+                 size_t                stride,
+                 bool                  b_generic,
+                 chal4_rule_engine_t * p_engine)
+{
+    uint8_t retcode  = RET_FAILURE;
+    int     distance = 0;
+
+    if ((NULL == p_rule) || (NULL == p_engine))
+    {
+        perror("ERROR: NULL pointer passed to rule_bind\n");
+        goto EXIT;
+    }
+
+    memset(p_engine, 0, sizeof(*p_engine));
+    p_engine->rule = *p_rule;
+
+    for (int d_row = -p_rule->radius; d_row <= p_rule->radius; d_row++)
+    {
+        for (int d_col = -p_rule->radius; d_col <= p_rule->radius; d_col++)
+        {
+            distance = (SHAPE_MOORE == p_rule->shape)
+                           ? ((abs(d_row) > abs(d_col)) ? abs(d_row)
+                                                        : abs(d_col))
+                           : (abs(d_row) + abs(d_col));
+
+            if ((0 < distance) && (distance <= p_rule->radius))
+            {
+                p_engine->offsets[p_engine->offset_count++]
+                    = ((ptrdiff_t)d_row * (ptrdiff_t)stride) + d_col;
+            }
+        }
+    }
+
+    for (size_t idx = 0; (false == b_generic) && (idx < RULE_KERNEL_COUNT);
+         idx++)
+    {
+        if ((g_rule_kernels[idx].rule.shape == p_rule->shape)
+            && (g_rule_kernels[idx].rule.radius == p_rule->radius)
+            && (g_rule_kernels[idx].rule.threshold == p_rule->threshold))
+        {
+            p_engine->p_kernel = g_rule_kernels[idx].p_kernel;
+        }
+    }
+
+    retcode = RET_SUCCESS;
+EXIT:
+    return retcode;
+}
+
+/**
+ * @brief Runs one pass of a bound rule (specialized kernel if there is one)
+ *
+ * @param p_engine Bound rule
+ * @param p_grid Current grid (read only)
+ * @param p_next Next grid, or NULL to only count
+ *
+ * @return Number of accessible (removed) rolls
+ */
+long
+chal4_rule_pass (const chal4_rule_engine_t * p_engine,
+                 const chal4_grid_t *        p_grid,
+                 chal4_grid_t *              p_next)
+{
+    if (NULL != p_engine->p_kernel)
+    {
+        return p_engine->p_kernel(p_grid, p_next);
+    }
+
+    return chal4_rule_generic(p_engine, p_grid, p_next);
+}
+
+/**
+ * @brief Runs synchronous part 2 rounds of a bound rule until nothing moves
+ *
+ * @param p_engine Bound rule
+ * @param p_grid Current grid, holds the stable grid on return
+ * @param p_next Grid of the same size used as the next-round buffer
+ * @param p_removed Incremented by the number of rolls removed
+ * @param p_stats Receives the removals and wall time of every round
+ *
+ * @return RET_SUCCESS on success, RET_FAILURE on failure
+ */
+uint8_t
+chal4_rule_part2 (const chal4_rule_engine_t * p_engine,
+                  chal4_grid_t *              p_grid,
+                  chal4_grid_t *              p_next,
+                  long *                      p_removed,
+                  chal4_round_stats_t *       p_stats)
+{
+    uint8_t         retcode       = RET_FAILURE;
+    long            round_removed = 0;
+    chal4_grid_t    swap;
+    struct timespec round_start;
+
+    if ((NULL == p_engine) || (NULL == p_grid) || (NULL == p_next)
+        || (NULL == p_removed) || (NULL == p_stats))
+    {
+        perror("ERROR: NULL pointer passed to rule_part2\n");
+        goto EXIT;
+    }
+
+    do
+    {
+        clock_gettime(CLOCK_MONOTONIC, &round_start);
+
+        round_removed = chal4_rule_pass(p_engine, p_grid, p_next);
+
+        swap    = *p_grid;
+        *p_grid = *p_next;
+        *p_next = swap;
+
+        *p_removed += round_removed;
+
+        if (RET_SUCCESS
+            != chal4_round_stats_add(
+                p_stats, round_removed, chal4_elapsed_ms(&round_start)))
+        {
+            goto EXIT;
+        }
+    } while (0 < round_removed);
+
+    retcode = RET_SUCCESS;
+EXIT:
+    return retcode;
+}
+
+/**
+ * @brief Hand-written part 1 pass used as the benchmark baseline
+ *
+ * @param p_grid Grid to scan
+ *
+ * @return Number of accessible rolls under the default rule
+ */
+static long
+chal4_rule_hand_written (const chal4_grid_t * p_grid)
+{
+    long            count = 0;
+    const uint8_t * p_row = NULL;
+
+    for (size_t row = 0; row < p_grid->height; row++)
+    {
+        p_row = CHAL4_ROW(p_grid, row);
+
+        for (size_t col = 0; col < p_grid->width; col++)
+        {
+            if ((1 == p_row[col])
+                && (NEIGHBOR_COUNT
+                    > chal4_check_neighbors(&p_row[col], p_grid->stride)))
+            {
+                count++;
+            }
+        }
+    }
+
+    return count;
+}
+
+/**
+ * @brief Prints one benchmark line
+ *
+ * @param p_name Rule name
+ * @param p_kernel Kernel description
+ * @param millis Total time of all passes
+ * @param cells Cells visited per pass
+ * @param count Part 1 count of the kernel
+ */
+static void
+chal4_rule_bench_print (const char * p_name,
+                        const char * p_kernel,
+                        double       millis,
+                        size_t       cells,
+                        long         count)
+{
+    double per_pass = millis / RULE_BENCH_PASSES;
+
+    printf("%-16s %-12s %10.3f ms/pass %10.1f Mcells/s  count %ld\n",
+           p_name,
+           p_kernel,
+           per_pass,
+           ((double)cells / MS_PER_SEC) / per_pass,
+           count);
+}
+
+/**
+ * @brief Times every specialized kernel against the generic kernel (and the
+ * default rule against the hand-written loop) over repeated part 1 passes
+ *
+ * @param p_grid Grid loaded with a border of at least RULE_RADIUS_MAX
+ *
+ * @return RET_SUCCESS if every kernel pair agreed, RET_FAILURE otherwise
+ */
+uint8_t
+chal4_rule_bench (const chal4_grid_t * p_grid)
+{
+    uint8_t             retcode = RET_FAILURE;
+    size_t              cells   = 0;
+    long                count   = 0;
+    long                counts[2];
+    char                name[RULE_NAME_SIZE * 2];
+    chal4_rule_engine_t engine;
+    struct timespec     start;
+
+    if ((NULL == p_grid) || (RULE_RADIUS_MAX > p_grid->border))
+    {
+        perror("ERROR: Rule benchmark needs a grid with a wide border\n");
+        goto EXIT;
+    }
+
+    cells = p_grid->width * p_grid->height;
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (int pass = 0; pass < RULE_BENCH_PASSES; pass++)
+    {
+        count = chal4_rule_hand_written(p_grid);
+    }
+    chal4_rule_bench_print(
+        "moore:1:4", "hand-written", chal4_elapsed_ms(&start), cells, count);
+
+    for (size_t idx = 0; idx < RULE_KERNEL_COUNT; idx++)
+    {
+        chal4_rule_name(&g_rule_kernels[idx].rule, name, sizeof(name));
+
+        for (int generic = 0; generic < 2; generic++)
+        {
+            chal4_rule_bind(&g_rule_kernels[idx].rule,
+                            p_grid->stride,
+                            (1 == generic),
+                            &engine);
+
+            clock_gettime(CLOCK_MONOTONIC, &start);
+            for (int pass = 0; pass < RULE_BENCH_PASSES; pass++)
+            {
+                counts[generic] = chal4_rule_pass(&engine, p_grid, NULL);
+            }
+            chal4_rule_bench_print(name,
+                                   (1 == generic) ? "generic" : "specialized",
+                                   chal4_elapsed_ms(&start),
+                                   cells,
+                                   counts[generic]);
+        }
+
+        if (counts[0] != counts[1])
+        {
+            printf("ERROR: Kernels disagree on %s\n", name);
+            goto EXIT;
+        }
+    }
+
+    retcode = RET_SUCCESS;
+EXIT:
+    return retcode;
+}
+
+/** END OF FILE **/
\ No newline at end of file
@@ -0,0 +1,292 @@
+/**
+ * @file chal4_simd.c
+ *
+ * @brief Neighbor-count row kernels for Advent of Code 2025 Challenge 4, one
+ * per CPU level
+ *
+ * Cells are 0 or 1 bytes, so the neighbor count of 16, 32 or 64 cells at
+ * once is the byte sum of the eight shifted loads around them, never above
+ * 8. A roll is removable where that sum is below NEIGHBOR_COUNT, and the
+ * count is a popcount of the compare mask. The grid's border makes the loads
+ * one cell left and right of a run safe; the SSE4.2 and AVX2 variants leave
+ * the last partial vector to the scalar loop, AVX-512 masks it. The variant
+ * is bound once at startup from aoc_cpu_level.
+ *
+ * @author Mexeck88
+ *
+ * @date 18OCT26
+ */
+
+#include "chal4_simd.h"
+
+#if AOC_CPU_X86
+#include <immintrin.h>
+#endif
+
+/**
+ * @brief Plain C kernel, also the tail of the SSE4.2 and AVX2 ones
+ */
+static long
+chal4_row_scalar (const uint8_t * p_row,
+                  ptrdiff_t       stride,
+                  uint8_t *       p_dest,
+                  size_t          width)
+{
+    long count = 0;
+
+    // Two loops keep the NULL test out of the per-cell work
+    if (NULL == p_dest)
+    {
+        for (size_t col = 0; col < width; col++)
+        {
+            if ((1 == p_row[col])
+                && (NEIGHBOR_COUNT > chal4_check_neighbors(&p_row[col], stride)))
+            {
+                count++;
+            }
+        }
+
+        return count;
+    }
+
+    for (size_t col = 0; col < width; col++)
+    {
+        p_dest[col] = p_row[col];
+
+        if ((1 == p_row[col])
+            && (NEIGHBOR_COUNT > chal4_check_neighbors(&p_row[col], stride)))
+        {
+            p_dest[col] = 0;
+            count++;
+        }
+    }
+
+    return count;
+}
+
+#if AOC_CPU_X86
+/**
+ * @brief SSE4.2 kernel: 16 cells per step
+ */
+AOC_CPU_TARGET_SSE42 static long
+chal4_row_sse42 (const uint8_t * p_row,
+                 ptrdiff_t       stride,
+                 uint8_t *       p_dest,
+                 size_t          width)
+{
+    const __m128i one   = _mm_set1_epi8(1);
+    const __m128i limit = _mm_set1_epi8(NEIGHBOR_COUNT);
+    size_t        col   = 0;
+    long          count = 0;
+
+    for (col = 0; col + 16 <= width; col += 16)
+    {
+        const uint8_t * p_cell = &p_row[col];
+        __m128i         cells  = _mm_loadu_si128((const __m128i *)p_cell);
+        __m128i         sum    = _mm_setzero_si128();
+        __m128i         removed;
+
+        // Each row contributes left, middle and right; the middle row's own
+        // cell is left out
+        for (ptrdiff_t offset = -stride; offset <= stride; offset += stride)
+        {
+            sum = _mm_add_epi8(
+                sum, _mm_loadu_si128((const __m128i *)(p_cell + offset - 1)));
+            sum = _mm_add_epi8(
+                sum, _mm_loadu_si128((const __m128i *)(p_cell + offset + 1)));
+
+            if (0 != offset)
+            {
+                sum = _mm_add_epi8(
+                    sum, _mm_loadu_si128((const __m128i *)(p_cell + offset)));
+            }
+        }
+
+        removed = _mm_and_si128(_mm_cmpeq_epi8(cells, one),
+                                _mm_cmpgt_epi8(limit, sum));
+        count += __builtin_popcount((unsigned)_mm_movemask_epi8(removed));
+
+        if (NULL != p_dest)
+        {
+            _mm_storeu_si128((__m128i *)&p_dest[col],
+                             _mm_andnot_si128(removed, cells));
+        }
+    }
+
+    return count
+           + chal4_row_scalar(&p_row[col],
+                              stride,
+                              (NULL != p_dest) ? &p_dest[col] : NULL,
+                              width - col);
+}
+
+/**
+ * @brief AVX2 kernel: 32 cells per step
+ */
+AOC_CPU_TARGET_AVX2 static long
+chal4_row_avx2 (const uint8_t * p_row,
+                ptrdiff_t       stride,
+                uint8_t *       p_dest,
+                size_t          width)
+{
+    const __m256i one   = _mm256_set1_epi8(1);
+    const __m256i limit = _mm256_set1_epi8(NEIGHBOR_COUNT);
+    size_t        col   = 0;
+    long          count = 0;
+
+    for (col = 0; col + 32 <= width; col += 32)
+    {
+        const uint8_t * p_cell = &p_row[col];
+        __m256i         cells  = _mm256_loadu_si256((const __m256i *)p_cell);
+        __m256i         sum    = _mm256_setzero_si256();
+        __m256i         removed;
+
+        for (ptrdiff_t offset = -stride; offset <= stride; offset += stride)
+        {
+            sum = _mm256_add_epi8(
+                sum,
+                _mm256_loadu_si256((const __m256i *)(p_cell + offset - 1)));
+            sum = _mm256_add_epi8(
+                sum,
+                _mm256_loadu_si256((const __m256i *)(p_cell + offset + 1)));
+
+            if (0 != offset)
+            {
+                sum = _mm256_add_epi8(
+                    sum, _mm256_loadu_si256((const __m256i *)(p_cell + offset)));
+            }
+        }
+
+        removed = _mm256_and_si256(_mm256_cmpeq_epi8(cells, one),
+                                   _mm256_cmpgt_epi8(limit, sum));
+        count += __builtin_popcount((unsigned)_mm256_movemask_epi8(removed));
+
+        if (NULL != p_dest)
+        {
+            _mm256_storeu_si256((__m256i *)&p_dest[col],
+                                _mm256_andnot_si256(removed, cells));
+        }
+    }
+
+    return count
+           + chal4_row_scalar(&p_row[col],
+                              stride,
+                              (NULL != p_dest) ? &p_dest[col] : NULL,
+                              width - col);
+}
+
+/**
+ * @brief AVX-512 kernel: 64 cells per step, the last partial step masked
+ */
+AOC_CPU_TARGET_AVX512 static long
+chal4_row_avx512 (const uint8_t * p_row,
+                  ptrdiff_t       stride,
+                  uint8_t *       p_dest,
+                  size_t          width)
+{
+    const __m512i one   = _mm512_set1_epi8(1);
+    const __m512i limit = _mm512_set1_epi8(NEIGHBOR_COUNT);
+    long          count = 0;
+
+    for (size_t col = 0; col < width; col += 64)
+    {
+        // Masked-off bytes are neither read nor written
+        __mmask64       valid  = (64 <= width - col)
+                                     ? ~(__mmask64)0
+                                     : (((__mmask64)1 << (width - col)) - 1);
+        const uint8_t * p_cell = &p_row[col];
+        __m512i         cells  = _mm512_maskz_loadu_epi8(valid, p_cell);
+        __m512i         sum    = _mm512_setzero_si512();
+        __mmask64       removed;
+
+        for (ptrdiff_t offset = -stride; offset <= stride; offset += stride)
+        {
+            sum = _mm512_add_epi8(
+                sum, _mm512_maskz_loadu_epi8(valid, p_cell + offset - 1));
+            sum = _mm512_add_epi8(
+                sum, _mm512_maskz_loadu_epi8(valid, p_cell + offset + 1));
+
+            if (0 != offset)
+            {
+                sum = _mm512_add_epi8(
+                    sum, _mm512_maskz_loadu_epi8(valid, p_cell + offset));
+            }
+        }
+
+        removed = _mm512_mask_cmpeq_epi8_mask(
+            _mm512_cmplt_epu8_mask(sum, limit), cells, one);
+        count += __builtin_popcountll(removed);
+
+        if (NULL != p_dest)
+        {
+            _mm512_mask_storeu_epi8(&p_dest[col],
+                                    valid,
+                                    _mm512_maskz_mov_epi8(~removed, cells));
+        }
+    }
+
+    return count;
+}
+#endif /* AOC_CPU_X86 */
+
+#if AOC_CPU_X86
+static const chal4_row_fn_t g_row_variants[AOC_CPU_LEVELS] = {
+    chal4_row_scalar,
+    chal4_row_sse42,
+    chal4_row_avx2,
+    chal4_row_avx512,
+};
+#else
+static const chal4_row_fn_t g_row_variants[AOC_CPU_LEVELS] = {
+    chal4_row_scalar,
+    chal4_row_scalar,
+    chal4_row_scalar,
+    chal4_row_scalar,
+};
+#endif
+
+static chal4_row_fn_t gp_row = chal4_row_scalar;
+
+/**
+ * @brief Binds the kernel to the variant for this CPU, before main runs
+ */
+__attribute__((constructor)) static void
+chal4_simd_init (void)
+{
+    gp_row = g_row_variants[aoc_cpu_level()];
+}
+
+/**
+ * @brief Applies the default rule to a run of cells with the bound kernel
+ *
+ * @param p_row First cell of the run in a padded grid
+ * @param stride Bytes between rows of the grid
+ * @param p_dest Where the run's cells after removal go, NULL to only count
+ * @param width Cells in the run
+ *
+ * @return Number of rolls with fewer than NEIGHBOR_COUNT neighbors
+ */
+long
+chal4_row_step (const uint8_t * p_row,
+                ptrdiff_t       stride,
+                uint8_t *       p_dest,
+                size_t          width)
+{
+    return gp_row(p_row, stride, p_dest, width);
+}
+
+/**
+ * @brief Kernel of a given level, whatever the CPU, for checking the
+ * variants against each other
+ *
+ * @param level Level of the variant, which the CPU must support to run it
+ *
+ * @return The variant, NULL for a level out of range
+ */
+chal4_row_fn_t
+chal4_row_variant (aoc_cpu_level_t level)
+{
+    return ((unsigned)level < AOC_CPU_LEVELS) ? g_row_variants[level] : NULL;
+}
+
+/** END OF FILE **/
\ No newline at end of file
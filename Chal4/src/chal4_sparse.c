@@ -0,0 +1,614 @@
+/**
+ * @file chal4_sparse.c
+ *
+ * @brief Sparse run-length grid for Advent of Code 2025 Challenge 4
+ *
+ * Each row keeps only its runs of rolls, so memory and scan time follow the
+ * number of rolls rather than the area of the map. A roll's neighbor count
+ * comes from its own run (left and right) plus the overlap of the three
+ * cells above and below it with the runs of the adjacent rows. The columns
+ * only grow along a row, so each adjacent row is walked once with a cursor
+ * and the three rows are merged in a single left-to-right sweep.
+ *
+ * @author Mexeck88
+ *
+ * @date 18OCT26
+ */
+
+#include "aoc_input.h"
+#include "chal4_sparse.h"
+
+/**
+ * @brief Grows one of the buffers of a sparse grid
+ *
+ * @param p_sparse Sparse grid owning the buffer
+ * @param p_old Buffer to grow (NULL to allocate)
+ * @param old_bytes Current size of the buffer
+ * @param new_bytes Size needed
+ *
+ * @return The grown buffer, or NULL on failure (p_old is untouched)
+ */
+static void *
+chal4_sparse_resize (chal4_sparse_t * p_sparse,
+                     void *           p_old,
+                     size_t           old_bytes,
+                     size_t           new_bytes)
+{
+    if (NULL == p_sparse->p_arena)
+    {
+        return realloc(p_old, new_bytes);
+    }
+
+    return aoc_arena_grow(
+        p_sparse->p_arena, p_old, old_bytes, new_bytes, AOC_ARENA_ALIGN);
+}
+
+/**
+ * @brief Makes room for one more run
+ *
+ * @param p_sparse Sparse grid
+ *
+ * @return RET_SUCCESS on success, RET_FAILURE on failure
+ */
+static uint8_t
+chal4_sparse_reserve_run (chal4_sparse_t * p_sparse)
+{
+    uint8_t       retcode  = RET_FAILURE;
+    size_t        capacity = 0;
+    chal4_run_t * p_runs   = NULL;
+
+    if (p_sparse->run_count < p_sparse->run_capacity)
+    {
+        retcode = RET_SUCCESS;
+        goto EXIT;
+    }
+
+    capacity = (0 == p_sparse->run_capacity)
+                   ? SPARSE_INIT_RUNS
+                   : p_sparse->run_capacity * REALLOC_SCALE;
+
+    p_runs = chal4_sparse_resize(p_sparse,
+                                 p_sparse->p_runs,
+                                 p_sparse->run_capacity * sizeof(chal4_run_t),
+                                 capacity * sizeof(chal4_run_t));
+    if (NULL == p_runs)
+    {
+        perror("ERROR: Unable to allocate memory for runs");
+        goto EXIT;
+    }
+
+    p_sparse->p_runs       = p_runs;
+    p_sparse->run_capacity = capacity;
+
+    retcode = RET_SUCCESS;
+EXIT:
+    return retcode;
+}
+
+/**
+ * @brief Closes the current row, recording where the next one starts
+ *
+ * @param p_sparse Sparse grid
+ *
+ * @return RET_SUCCESS on success, RET_FAILURE on failure
+ */
+static uint8_t
+chal4_sparse_end_row (chal4_sparse_t * p_sparse)
+{
+    uint8_t  retcode  = RET_FAILURE;
+    size_t   capacity = 0;
+    size_t * p_rows   = NULL;
+
+    // p_rows needs height + 2 entries once this row is closed
+    if (p_sparse->height + 2 > p_sparse->row_capacity)
+    {
+        capacity = (0 == p_sparse->row_capacity)
+                       ? SPARSE_INIT_ROWS
+                       : p_sparse->row_capacity * REALLOC_SCALE;
+
+        p_rows = chal4_sparse_resize(p_sparse,
+                                     p_sparse->p_rows,
+                                     p_sparse->row_capacity * sizeof(size_t),
+                                     capacity * sizeof(size_t));
+        if (NULL == p_rows)
+        {
+            perror("ERROR: Unable to allocate memory for rows");
+            goto EXIT;
+        }
+
+        p_sparse->p_rows       = p_rows;
+        p_sparse->row_capacity = capacity;
+    }
+
+    p_sparse->height++;
+    p_sparse->p_rows[p_sparse->height] = p_sparse->run_count;
+
+    retcode = RET_SUCCESS;
+EXIT:
+    return retcode;
+}
+
+/**
+ * @brief Appends one occupied column to the current row
+ *
+ * Extends the last run when the column touches it, otherwise opens a new
+ * run.
+ *
+ * @param p_sparse Sparse grid whose current row is row p_sparse->height
+ * @param col Column, greater than any column added to this row so far
+ *
+ * @return RET_SUCCESS on success, RET_FAILURE on failure
+ */
+static uint8_t
+chal4_sparse_add_cell (chal4_sparse_t * p_sparse, uint32_t col)
+{
+    uint8_t       retcode = RET_FAILURE;
+    chal4_run_t * p_last  = NULL;
+
+    p_sparse->occupied++;
+
+    if (p_sparse->run_count > p_sparse->p_rows[p_sparse->height])
+    {
+        p_last = &p_sparse->p_runs[p_sparse->run_count - 1];
+
+        if (p_last->end == col)
+        {
+            p_last->end++;
+            retcode = RET_SUCCESS;
+            goto EXIT;
+        }
+    }
+
+    if (RET_SUCCESS != chal4_sparse_reserve_run(p_sparse))
+    {
+        goto EXIT;
+    }
+
+    p_sparse->p_runs[p_sparse->run_count].start = col;
+    p_sparse->p_runs[p_sparse->run_count].end   = col + 1;
+    p_sparse->run_count++;
+
+    retcode = RET_SUCCESS;
+EXIT:
+    return retcode;
+}
+
+/**
+ * @brief Empties a sparse grid, keeping its buffers, and opens row 0
+ *
+ * @param p_sparse Sparse grid
+ * @param width Number of columns
+ *
+ * @return RET_SUCCESS on success, RET_FAILURE on failure
+ */
+static uint8_t
+chal4_sparse_reset (chal4_sparse_t * p_sparse, size_t width)
+{
+    uint8_t retcode = RET_FAILURE;
+
+    p_sparse->run_count = 0;
+    p_sparse->width     = width;
+    p_sparse->height    = 0;
+    p_sparse->occupied  = 0;
+
+    if ((NULL == p_sparse->p_rows)
+        && (RET_SUCCESS != chal4_sparse_end_row(p_sparse)))
+    {
+        goto EXIT;
+    }
+
+    // chal4_sparse_end_row counted a row to size the buffer, undo it
+    p_sparse->height    = 0;
+    p_sparse->p_rows[0] = 0;
+
+    retcode = RET_SUCCESS;
+EXIT:
+    return retcode;
+}
+
+/**
+ * @brief Parses an open input as runs, detecting width and height
+ *
+ * Follows chal4_parse_input: the first line fixes the width, and a blank line
+ * or the end of the input ends the grid. Snapshots are not understood here.
+ *
+ * @param p_input Open input, read from its current position
+ * @param p_arena Arena to carve the runs from (NULL for the heap)
+ * @param p_sparse Sparse grid to fill in (must not own buffers)
+ *
+ * @return RET_SUCCESS on success, RET_FAILURE on failure
+ */
+uint8_t
+chal4_sparse_parse (aoc_input_t *    p_input,
+                    aoc_arena_t *    p_arena,
+                    chal4_sparse_t * p_sparse)
+{
+    uint8_t      retcode = RET_FAILURE;
+    const char * p_roll  = NULL;
+    const char * p_end   = NULL;
+    aoc_view_t   line    = { 0 };
+
+    if ((NULL == p_input) || (NULL == p_sparse))
+    {
+        perror("ERROR: NULL pointer passed to sparse_parse\n");
+        goto EXIT;
+    }
+
+    memset(p_sparse, 0, sizeof(*p_sparse));
+    p_sparse->p_arena = p_arena;
+
+    if ((false == aoc_input_next_line(p_input, &line)) || (0 == line.length)
+        || (SPARSE_MAX_WIDTH < line.length))
+    {
+        printf("ERROR: First line of input is empty or too wide\n");
+        goto EXIT;
+    }
+
+    if (RET_SUCCESS != chal4_sparse_reset(p_sparse, line.length))
+    {
+        goto CLEAN;
+    }
+
+    do
+    {
+        if (line.length != p_sparse->width)
+        {
+            printf("ERROR: Line %zu has width %zu, expected %zu\n",
+                   p_sparse->height + 1,
+                   line.length,
+                   p_sparse->width);
+            goto CLEAN;
+        }
+
+        // Jump from roll to roll, empty stretches cost one memchr
+        p_end  = line.p_data + line.length;
+        p_roll = memchr(line.p_data, ROLL_CHAR, line.length);
+        while (NULL != p_roll)
+        {
+            if (RET_SUCCESS
+                != chal4_sparse_add_cell(
+                    p_sparse, (uint32_t)(p_roll - line.p_data))) // < width
+            {
+                goto CLEAN;
+            }
+
+            p_roll++;
+            p_roll = memchr(p_roll, ROLL_CHAR, (size_t)(p_end - p_roll));
+        }
+
+        if (RET_SUCCESS != chal4_sparse_end_row(p_sparse))
+        {
+            goto CLEAN;
+        }
+    } while ((true == aoc_input_next_line(p_input, &line))
+             && (0 < line.length));
+
+    retcode = RET_SUCCESS;
+    goto EXIT;
+
+CLEAN:
+    chal4_sparse_free(p_sparse);
+EXIT:
+    return retcode;
+}
+
+/**
+ * @brief Loads the input file as runs
+ *
+ * @param p_file_path Path to the input file ("-" reads stdin)
+ * @param p_arena Arena to carve the runs from (NULL for the heap)
+ * @param p_sparse Sparse grid to fill in (must not own buffers)
+ *
+ * @return RET_SUCCESS on success, RET_FAILURE on failure
+ */
+uint8_t
+chal4_sparse_load (const char *     p_file_path,
+                   aoc_arena_t *    p_arena,
+                   chal4_sparse_t * p_sparse)
+{
+    uint8_t     retcode = RET_FAILURE;
+    aoc_input_t input   = { 0 };
+
+    if ((NULL == p_file_path) || (NULL == p_sparse))
+    {
+        perror("ERROR: NULL pointer passed to sparse_load\n");
+        goto EXIT;
+    }
+
+    if (AOC_SUCCESS != aoc_input_open(p_file_path, &input))
+    {
+        goto EXIT;
+    }
+
+    retcode = chal4_sparse_parse(&input, p_arena, p_sparse);
+    aoc_input_close(&input);
+EXIT:
+    return retcode;
+}
+
+/**
+ * @brief Releases the buffers of a sparse grid
+ *
+ * Arena buffers are only dropped; the arena releases them.
+ *
+ * @param p_sparse Sparse grid (safe to call on a zeroed one)
+ */
+void
+chal4_sparse_free (chal4_sparse_t * p_sparse)
+{
+    if (NULL != p_sparse)
+    {
+        if (NULL == p_sparse->p_arena)
+        {
+            free(p_sparse->p_runs);
+            free(p_sparse->p_rows);
+        }
+
+        memset(p_sparse, 0, sizeof(*p_sparse));
+    }
+}
+
+/**
+ * @brief Expands runs into a padded dense grid
+ *
+ * The grid shares the arena of the runs, if they have one.
+ *
+ * @param p_sparse Sparse grid
+ * @param p_grid Grid to allocate and fill (must not own a block)
+ *
+ * @return RET_SUCCESS on success, RET_FAILURE on failure
+ */
+uint8_t
+chal4_sparse_to_grid (const chal4_sparse_t * p_sparse, chal4_grid_t * p_grid)
+{
+    uint8_t             retcode = RET_FAILURE;
+    const chal4_run_t * p_run   = NULL;
+
+    if ((NULL == p_sparse) || (NULL == p_grid))
+    {
+        perror("ERROR: NULL pointer passed to sparse_to_grid\n");
+        goto EXIT;
+    }
+
+    if (RET_SUCCESS
+        != chal4_grid_alloc_arena(p_grid,
+                                  p_sparse->width,
+                                  p_sparse->height,
+                                  GRID_BORDER,
+                                  p_sparse->p_arena))
+    {
+        goto EXIT;
+    }
+
+    for (size_t row = 0; row < p_sparse->height; row++)
+    {
+        for (size_t idx = p_sparse->p_rows[row]; idx < p_sparse->p_rows[row + 1];
+             idx++)
+        {
+            p_run = &p_sparse->p_runs[idx];
+            memset(CHAL4_ROW(p_grid, row) + p_run->start,
+                   1,
+                   p_run->end - p_run->start);
+        }
+    }
+
+    retcode = RET_SUCCESS;
+EXIT:
+    return retcode;
+}
+
+/**
+ * @brief Decides from the measured occupancy whether to solve on runs
+ *
+ * Dense passes touch every cell, run passes touch every roll with a little
+ * more work each, so runs win while few cells are occupied.
+ *
+ * @param p_sparse Loaded sparse grid
+ *
+ * @return true to stay sparse, false to expand into a dense grid
+ */
+bool
+chal4_sparse_prefer (const chal4_sparse_t * p_sparse)
+{
+    return (p_sparse->occupied * 100)
+           <= (p_sparse->width * p_sparse->height * SPARSE_MAX_OCCUPANCY);
+}
+
+/**
+ * @brief Counts the rolls of an adjacent row in columns x - 1 to x + 1
+ *
+ * @param p_runs Runs of the adjacent row
+ * @param run_count Number of runs in the row
+ * @param p_cursor First run that may still overlap, advanced as x grows
+ * @param col Column x
+ *
+ * @return Number of rolls (0 - 3)
+ */
+static int
+chal4_sparse_window (const chal4_run_t * p_runs,
+                     size_t              run_count,
+                     size_t *            p_cursor,
+                     uint32_t            col)
+{
+    uint32_t low   = (0 < col) ? col - 1 : 0;
+    uint32_t high  = col + 2; // Exclusive, width <= SPARSE_MAX_WIDTH
+    uint32_t start = 0;
+    uint32_t end   = 0;
+    int      count = 0;
+
+    while ((*p_cursor < run_count) && (p_runs[*p_cursor].end <= low))
+    {
+        (*p_cursor)++;
+    }
+
+    // Runs are at least one cell apart, so at most two reach the window
+    for (size_t idx = *p_cursor;
+         (idx < run_count) && (p_runs[idx].start < high);
+         idx++)
+    {
+        start = (p_runs[idx].start > low) ? p_runs[idx].start : low;
+        end   = (p_runs[idx].end < high) ? p_runs[idx].end : high;
+        count += (int)(end - start);
+    }
+
+    return count;
+}
+
+/**
+ * @brief Runs the part 1 rule over one row, merging it with its neighbors
+ *
+ * @param p_sparse Current grid
+ * @param row Row to process
+ * @param p_next Grid receiving the survivors as row p_next->height, or NULL
+ * @param p_removed Incremented by the number of accessible rolls
+ *
+ * @return RET_SUCCESS on success, RET_FAILURE on failure
+ */
+static uint8_t
+chal4_sparse_row (const chal4_sparse_t * p_sparse,
+                  size_t                 row,
+                  chal4_sparse_t *       p_next,
+                  long *                 p_removed)
+{
+    uint8_t             retcode   = RET_FAILURE;
+    const chal4_run_t * p_runs    = p_sparse->p_runs;
+    const chal4_run_t * p_above   = NULL;
+    const chal4_run_t * p_below   = NULL;
+    size_t              above_len = 0;
+    size_t              below_len = 0;
+    size_t              above_pos = 0;
+    size_t              below_pos = 0;
+    int                 neighbors = 0;
+
+    // Rows outside the grid have no runs
+    if (0 < row)
+    {
+        p_above   = &p_runs[p_sparse->p_rows[row - 1]];
+        above_len = p_sparse->p_rows[row] - p_sparse->p_rows[row - 1];
+    }
+
+    if (row + 1 < p_sparse->height)
+    {
+        p_below   = &p_runs[p_sparse->p_rows[row + 1]];
+        below_len = p_sparse->p_rows[row + 2] - p_sparse->p_rows[row + 1];
+    }
+
+    for (size_t idx = p_sparse->p_rows[row]; idx < p_sparse->p_rows[row + 1];
+         idx++)
+    {
+        for (uint32_t col = p_runs[idx].start; col < p_runs[idx].end; col++)
+        {
+            neighbors = (col > p_runs[idx].start) + (col + 1 < p_runs[idx].end)
+                        + chal4_sparse_window(p_above, above_len, &above_pos, col)
+                        + chal4_sparse_window(p_below, below_len, &below_pos, col);
+
+            if (NEIGHBOR_COUNT > neighbors)
+            {
+                (*p_removed)++;
+            }
+            else if ((NULL != p_next)
+                     && (RET_SUCCESS != chal4_sparse_add_cell(p_next, col)))
+            {
+                goto EXIT;
+            }
+        }
+    }
+
+    retcode = RET_SUCCESS;
+EXIT:
+    return retcode;
+}
+
+/**
+ * @brief Runs one pass of the part 1 rule directly on runs
+ *
+ * With p_next NULL only the accessible rolls are counted (part 1); otherwise
+ * p_next is rebuilt from the survivors (one part 2 round).
+ *
+ * @param p_sparse Current grid (read only)
+ * @param p_next Grid to rebuild, or NULL
+ *
+ * @return Number of accessible (removed) rolls, -1 if p_next could not grow
+ */
+long
+chal4_sparse_pass (const chal4_sparse_t * p_sparse, chal4_sparse_t * p_next)
+{
+    long removed = 0;
+
+    if ((NULL != p_next)
+        && (RET_SUCCESS != chal4_sparse_reset(p_next, p_sparse->width)))
+    {
+        return -1;
+    }
+
+    for (size_t row = 0; row < p_sparse->height; row++)
+    {
+        if ((RET_SUCCESS != chal4_sparse_row(p_sparse, row, p_next, &removed))
+            || ((NULL != p_next)
+                && (RET_SUCCESS != chal4_sparse_end_row(p_next))))
+        {
+            return -1;
+        }
+    }
+
+    return removed;
+}
+
+/**
+ * @brief Runs synchronous part 2 rounds on runs until nothing moves
+ *
+ * @param p_sparse Current grid, holds the stable grid on return
+ * @param p_next Zeroed or spare sparse grid used as the next-round buffer
+ * @param p_removed Incremented by the number of rolls removed
+ * @param p_stats Receives the removals and wall time of every round
+ *
+ * @return RET_SUCCESS on success, RET_FAILURE on failure
+ */
+uint8_t
+chal4_sparse_part2 (chal4_sparse_t *      p_sparse,
+                    chal4_sparse_t *      p_next,
+                    long *                p_removed,
+                    chal4_round_stats_t * p_stats)
+{
+    uint8_t         retcode       = RET_FAILURE;
+    long            round_removed = 0;
+    chal4_sparse_t  swap;
+    struct timespec round_start;
+
+    if ((NULL == p_sparse) || (NULL == p_next) || (NULL == p_removed)
+        || (NULL == p_stats))
+    {
+        perror("ERROR: NULL pointer passed to sparse_part2\n");
+        goto EXIT;
+    }
+
+    do
+    {
+        clock_gettime(CLOCK_MONOTONIC, &round_start);
+
+        round_removed = chal4_sparse_pass(p_sparse, p_next);
+        if (0 > round_removed)
+        {
+            goto EXIT;
+        }
+
+        swap      = *p_sparse;
+        *p_sparse = *p_next;
+        *p_next   = swap;
+
+        *p_removed += round_removed;
+
+        if (RET_SUCCESS
+            != chal4_round_stats_add(
+                p_stats, round_removed, chal4_elapsed_ms(&round_start)))
+        {
+            goto EXIT;
+        }
+    } while (0 < round_removed);
+
+    retcode = RET_SUCCESS;
+EXIT:
+    return retcode;
+}
+
+/** END OF FILE **/
\ No newline at end of file
@@ -0,0 +1,170 @@
+/**
+ * @file chal4_stream.c
+ *
+ * @brief Streaming part 1 solver for Advent of Code 2025 Challenge 4
+ *
+ * Rows are read one at a time into a three-row ring buffer. A row is
+ * classified as soon as the row below it arrives, so memory use is O(width)
+ * no matter how many rows the input has.
+ *
+ * @author Mexeck88
+ *
+ * @date 18OCT26
+ */
+
+#include "chal4_stream.h"
+
+/**
+ * @brief Counts accessible rolls in one row from its two neighbor rows
+ *
+ * @param p_up Row above (first data cell, zero padded on both sides)
+ * @param p_mid Row to classify
+ * @param p_down Row below
+ * @param width Number of data columns
+ *
+ * @return Number of rolls in p_mid with fewer than NEIGHBOR_COUNT neighbors
+ */
+static long
+chal4_stream_row (const uint8_t * p_up,
+                  const uint8_t * p_mid,
+                  const uint8_t * p_down,
+                  size_t          width)
+{
+    long count     = 0;
+    int  neighbors = 0;
+
+    for (size_t col = 0; col < width; col++, p_up++, p_mid++, p_down++)
+    {
+        if (1 == *p_mid)
+        {
+            neighbors = p_up[-1] + p_up[0] + p_up[1]         // Top
+                        + p_mid[-1] + p_mid[1]               // Sides
+                        + p_down[-1] + p_down[0] + p_down[1]; // Bottom
+
+            if (NEIGHBOR_COUNT > neighbors)
+            {
+                count++;
+            }
+        }
+    }
+
+    return count;
+}
+
+/**
+ * @brief Computes the part 1 count of a file or stdin in O(width) memory
+ *
+ * @param p_file_path Path to the input file ("-" reads stdin)
+ * @param p_count Incremented by the number of accessible rolls
+ *
+ * @return RET_SUCCESS on success, RET_FAILURE on failure
+ */
+uint8_t
+chal4_stream_part1 (const char * p_file_path, long * p_count)
+{
+    uint8_t   retcode   = RET_FAILURE;
+    FILE *    p_file    = NULL;
+    char *    p_line    = NULL;
+    size_t    line_cap  = 0;
+    ssize_t   read_len  = 0;
+    size_t    length    = 0;
+    size_t    width     = 0;
+    size_t    row_bytes = 0;
+    size_t    row       = 0;
+    uint8_t * p_ring    = NULL;
+    uint8_t * p_dest    = NULL;
+    uint8_t * p_slots[RING_ROWS];
+
+    if ((NULL == p_file_path) || (NULL == p_count))
+    {
+        perror("ERROR: NULL pointer passed to stream_part1\n");
+        goto EXIT;
+    }
+
+    p_file = (0 == strcmp(p_file_path, "-")) ? stdin : fopen(p_file_path, "r");
+    if (NULL == p_file)
+    {
+        perror("ERROR: Unable to open file");
+        goto EXIT;
+    }
+
+    read_len = getline(&p_line, &line_cap, p_file);
+    length   = (0 < read_len) ? chal4_trim_line(p_line, (size_t)read_len)
+                              : 0; // read_len > 0
+    if (0 == length)
+    {
+        printf("ERROR: First line of input is empty\n");
+        goto EXIT;
+    }
+
+    // One zero cell of padding on each side of every ring row
+    width     = length;
+    row_bytes = width + (2 * GRID_BORDER);
+
+    p_ring = calloc(RING_ROWS, row_bytes);
+    if (NULL == p_ring)
+    {
+        perror("ERROR: Unable to allocate memory for ring buffer");
+        goto EXIT;
+    }
+
+    for (size_t idx = 0; idx < RING_ROWS; idx++)
+    {
+        p_slots[idx] = p_ring + (idx * row_bytes) + GRID_BORDER;
+    }
+
+    // Row r lives in slot r % RING_ROWS; the slot of row -1 starts zeroed
+    do
+    {
+        if (length != width)
+        {
+            printf("ERROR: Line %zu has width %zu, expected %zu\n",
+                   row + 1,
+                   length,
+                   width);
+            goto EXIT;
+        }
+
+        p_dest = p_slots[row % RING_ROWS];
+        for (size_t col = 0; col < width; col++)
+        {
+            p_dest[col] = (ROLL_CHAR == p_line[col]);
+        }
+
+        // The new row completes the neighborhood of the row above it
+        if (0 < row)
+        {
+            *p_count += chal4_stream_row(p_slots[(row + 1) % RING_ROWS],
+                                         p_slots[(row - 1) % RING_ROWS],
+                                         p_dest,
+                                         width);
+        }
+
+        row++;
+
+        read_len = getline(&p_line, &line_cap, p_file);
+        length   = (0 < read_len) ? chal4_trim_line(p_line, (size_t)read_len)
+                                  : 0; // read_len > 0
+    } while (0 < length);
+
+    // The last row has the bottom border below it
+    memset(p_slots[row % RING_ROWS], 0, width);
+    *p_count += chal4_stream_row(p_slots[(row + 1) % RING_ROWS],
+                                 p_slots[(row - 1) % RING_ROWS],
+                                 p_slots[row % RING_ROWS],
+                                 width);
+
+    retcode = RET_SUCCESS;
+EXIT:
+    free(p_ring);
+    free(p_line);
+
+    if ((NULL != p_file) && (stdin != p_file))
+    {
+        fclose(p_file);
+    }
+
+    return retcode;
+}
+
+/** END OF FILE **/
\ No newline at end of file
@@ -0,0 +1,593 @@
+/**
+ * @file chal4_threads.c
+ *
+ * @brief Multi-threaded row-band stencil for Advent of Code 2025 Challenge 4
+ *
+ * The grid is split into horizontal bands, one per thread. Each band reads
+ * one halo row from the band above and the band below straight out of the
+ * shared grid; bands only ever write their own rows, so no copies or locks
+ * are needed inside a round.
+ *
+ * The pool variants run the same band kernels as chunks of rows on a
+ * work-stealing pool, so uneven rows are balanced by stealing instead of
+ * being fixed per thread.
+ *
+ * @author Mexeck88
+ *
+ * @date 18OCT26
+ */
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+
+#include "chal4_simd.h"
+#include "chal4_threads.h"
+
+/**
+ * @enum band_start_t
+ * @brief Start gate states, so no thread reaches the round barrier unless all
+ * of them were created
+ */
+typedef enum band_start_t
+{
+    BAND_WAIT = 0,
+    BAND_GO,
+    BAND_ABORT,
+} band_start_t;
+
+/**
+ * @struct chal4_band_shared_t
+ * @brief State shared by all band threads of a part 2 run
+ */
+typedef struct chal4_band_shared_t
+{
+    chal4_grid_t *        p_grid;  // Current round (read)
+    chal4_grid_t *        p_next;  // Next round (written)
+    chal4_round_stats_t * p_stats; // Per-round removals and times
+    struct chal4_band_t * p_bands; // All bands, for the round reduction
+    int                   thread_count;
+    long                  removed;      // Total over all rounds
+    bool                  b_stablized;  // Set when a round removes nothing
+    bool                  b_failed;     // Set if bookkeeping fails
+    struct timespec       round_start;  // Start of the current round
+    pthread_barrier_t     barrier;      // Separates rounds
+} chal4_band_shared_t;
+
+/**
+ * @struct chal4_band_t
+ * @brief One thread's rows and its private counter
+ *
+ * Aligned to a cache line so the counters of neighboring threads never share
+ * a line.
+ */
+typedef struct chal4_band_t
+{
+    _Alignas(CACHE_LINE_SIZE) size_t row_start; // First data row
+    size_t                           row_end;   // One past the last data row
+    long                             count;     // Per-thread counter
+    const chal4_grid_t *             p_grid;    // Part 1 grid
+    chal4_band_shared_t *            p_shared;  // Part 2 shared state
+    atomic_int *                     p_start;   // Gate set by bands_run
+    pthread_t                        thread;
+} chal4_band_t;
+
+/**
+ * @brief Counts accessible rolls in a band of rows (part 1 rule)
+ *
+ * @param p_grid Grid to scan
+ * @param row_start First row of the band
+ * @param row_end One past the last row of the band
+ *
+ * @return Number of rolls with fewer than NEIGHBOR_COUNT neighbors
+ */
+static long
+chal4_band_count (const chal4_grid_t * p_grid, size_t row_start, size_t row_end)
+{
+    long count = 0;
+
+    AOC_TRACE_SCOPE_ARG("rows", row_start);
+
+    for (size_t row = row_start; row < row_end; row++)
+    {
+        count += chal4_row_step(CHAL4_ROW(p_grid, row),
+                                p_grid->stride,
+                                NULL,
+                                p_grid->width);
+    }
+
+    return count;
+}
+
+/**
+ * @brief Writes one round of a band into the next grid
+ *
+ * @param p_grid Current grid (read only)
+ * @param p_next Next grid (only the band's rows are written)
+ * @param row_start First row of the band
+ * @param row_end One past the last row of the band
+ *
+ * @return Number of rolls removed from the band this round
+ */
+static long
+chal4_band_round (const chal4_grid_t * p_grid,
+                  chal4_grid_t *       p_next,
+                  size_t               row_start,
+                  size_t               row_end)
+{
+    long removed = 0;
+
+    AOC_TRACE_SCOPE_ARG("rows", row_start);
+
+    for (size_t row = row_start; row < row_end; row++)
+    {
+        removed += chal4_row_step(CHAL4_ROW(p_grid, row),
+                                  p_grid->stride,
+                                  CHAL4_ROW(p_next, row),
+                                  p_grid->width);
+    }
+
+    return removed;
+}
+
+/**
+ * @brief Waits until every band thread has been created
+ *
+ * @param p_band Band of the calling thread
+ *
+ * @return true to run, false if a thread could not be created
+ */
+static bool
+chal4_band_wait_start (const chal4_band_t * p_band)
+{
+    int start = BAND_WAIT;
+
+    while (BAND_WAIT == (start = atomic_load(p_band->p_start)))
+    {
+        sched_yield();
+    }
+
+    return (BAND_GO == start);
+}
+
+/**
+ * @brief Thread entry for part 1: counts one band
+ *
+ * @param p_arg Pointer to the chal4_band_t of this thread
+ *
+ * @return NULL
+ */
+static void *
+chal4_band_part1_worker (void * p_arg)
+{
+    chal4_band_t * p_band = p_arg; // void * from pthread_create
+
+    if (false == chal4_band_wait_start(p_band))
+    {
+        return NULL;
+    }
+
+    p_band->count
+        = chal4_band_count(p_band->p_grid, p_band->row_start, p_band->row_end);
+
+    return NULL;
+}
+
+/**
+ * @brief Sums the band counters of a round, records it and swaps the grids
+ *
+ * Runs on exactly one thread while the others wait at the barrier.
+ *
+ * @param p_shared Shared part 2 state
+ */
+static void
+chal4_band_finish_round (chal4_band_shared_t * p_shared)
+{
+    long         round_removed = 0;
+    chal4_grid_t swap;
+
+    for (int idx = 0; idx < p_shared->thread_count; idx++)
+    {
+        round_removed += p_shared->p_bands[idx].count;
+    }
+
+    if (RET_SUCCESS
+        != chal4_round_stats_add(p_shared->p_stats,
+                                 round_removed,
+                                 chal4_elapsed_ms(&p_shared->round_start)))
+    {
+        p_shared->b_failed = true;
+    }
+
+    swap              = *p_shared->p_grid;
+    *p_shared->p_grid = *p_shared->p_next;
+    *p_shared->p_next = swap;
+
+    p_shared->removed += round_removed;
+    p_shared->b_stablized = (0 == round_removed) || p_shared->b_failed;
+
+    clock_gettime(CLOCK_MONOTONIC, &p_shared->round_start);
+}
+
+/**
+ * @brief Thread entry for part 2: runs synchronous rounds on one band
+ *
+ * @param p_arg Pointer to the chal4_band_t of this thread
+ *
+ * @return NULL
+ */
+static void *
+chal4_band_part2_worker (void * p_arg)
+{
+    chal4_band_t *        p_band   = p_arg; // void * from pthread_create
+    chal4_band_shared_t * p_shared = p_band->p_shared;
+
+    if (false == chal4_band_wait_start(p_band))
+    {
+        return NULL;
+    }
+
+    while (false == p_shared->b_stablized)
+    {
+        p_band->count = chal4_band_round(p_shared->p_grid,
+                                         p_shared->p_next,
+                                         p_band->row_start,
+                                         p_band->row_end);
+
+        // Every band has written its rows before the reduction reads them
+        if (PTHREAD_BARRIER_SERIAL_THREAD
+            == pthread_barrier_wait(&p_shared->barrier))
+        {
+            chal4_band_finish_round(p_shared);
+        }
+
+        // Nobody starts the next round until the grids are swapped
+        pthread_barrier_wait(&p_shared->barrier);
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Allocates bands and splits the grid rows evenly between them
+ *
+ * @param p_grid Grid to split
+ * @param p_thread_count Requested threads, clamped to the number of rows
+ *
+ * @return Array of bands (free with free()), NULL on failure
+ */
+static chal4_band_t *
+chal4_bands_create (const chal4_grid_t * p_grid, int * p_thread_count)
+{
+    chal4_band_t * p_bands = NULL;
+    size_t         count   = (size_t)*p_thread_count; // Checked > 0
+
+    if (count > p_grid->height)
+    {
+        count = (0 < p_grid->height) ? p_grid->height : 1;
+    }
+
+    p_bands = aligned_alloc(CACHE_LINE_SIZE, count * sizeof(chal4_band_t));
+    if (NULL == p_bands)
+    {
+        perror("ERROR: Unable to allocate memory for bands");
+        goto EXIT;
+    }
+
+    memset(p_bands, 0, count * sizeof(chal4_band_t));
+
+    for (size_t idx = 0; idx < count; idx++)
+    {
+        p_bands[idx].row_start = (p_grid->height * idx) / count;
+        p_bands[idx].row_end   = (p_grid->height * (idx + 1)) / count;
+        p_bands[idx].p_grid    = p_grid;
+    }
+
+    *p_thread_count = (int)count; // count <= requested thread count
+
+EXIT:
+    return p_bands;
+}
+
+/**
+ * @brief Starts one thread per band and waits for all of them
+ *
+ * The threads wait at a start gate until every one of them exists. If a
+ * create fails, the gate tells the started ones to return, since a part 2
+ * barrier sized for all bands would otherwise never open.
+ *
+ * @param p_bands Bands to run
+ * @param thread_count Number of bands
+ * @param p_worker Thread entry point
+ *
+ * @return RET_SUCCESS on success, RET_FAILURE on failure
+ */
+static uint8_t
+chal4_bands_run (chal4_band_t * p_bands,
+                 int            thread_count,
+                 void *(*p_worker)(void *))
+{
+    uint8_t    retcode = RET_FAILURE;
+    int        started = 0;
+    atomic_int start;
+
+    atomic_init(&start, BAND_WAIT);
+
+    for (started = 0; started < thread_count; started++)
+    {
+        p_bands[started].p_start = &start;
+        if (0
+            != pthread_create(
+                &p_bands[started].thread, NULL, p_worker, &p_bands[started]))
+        {
+            perror("ERROR: Unable to create band thread");
+            break;
+        }
+    }
+
+    atomic_store(&start, (started < thread_count) ? BAND_ABORT : BAND_GO);
+    if (started == thread_count)
+    {
+        retcode = RET_SUCCESS;
+    }
+
+    for (int idx = 0; idx < started; idx++)
+    {
+        pthread_join(p_bands[idx].thread, NULL);
+    }
+
+    return retcode;
+}
+
+/**
+ * @brief Counts part 1 accessible rolls with one thread per row band
+ *
+ * @param p_grid Grid to scan
+ * @param thread_count Number of threads to use
+ * @param p_count Incremented by the number of accessible rolls
+ *
+ * @return RET_SUCCESS on success, RET_FAILURE on failure
+ */
+uint8_t
+chal4_threads_part1 (const chal4_grid_t * p_grid,
+                     int                  thread_count,
+                     long *               p_count)
+{
+    uint8_t        retcode = RET_FAILURE;
+    chal4_band_t * p_bands = NULL;
+
+    if ((NULL == p_grid) || (NULL == p_count) || (0 >= thread_count))
+    {
+        perror("ERROR: Invalid arguments passed to threads_part1\n");
+        goto EXIT;
+    }
+
+    p_bands = chal4_bands_create(p_grid, &thread_count);
+    if (NULL == p_bands)
+    {
+        goto EXIT;
+    }
+
+    if (RET_SUCCESS
+        != chal4_bands_run(p_bands, thread_count, chal4_band_part1_worker))
+    {
+        goto EXIT;
+    }
+
+    for (int idx = 0; idx < thread_count; idx++)
+    {
+        *p_count += p_bands[idx].count;
+    }
+
+    retcode = RET_SUCCESS;
+EXIT:
+    free(p_bands);
+    return retcode;
+}
+
+/**
+ * @brief Runs part 2 rounds with one thread per row band
+ *
+ * A barrier separates the rounds; between them one thread sums the band
+ * counters, records the round and swaps the two grids.
+ *
+ * @param p_grid Current grid, holds the stable grid on return
+ * @param p_next Zeroed grid of the same size used as the next-round buffer
+ * @param thread_count Number of threads to use
+ * @param p_removed Incremented by the number of rolls removed
+ * @param p_stats Receives the removals and wall time of every round
+ *
+ * @return RET_SUCCESS on success, RET_FAILURE on failure
+ */
+uint8_t
+chal4_threads_part2 (chal4_grid_t *        p_grid,
+                     chal4_grid_t *        p_next,
+                     int                   thread_count,
+                     long *                p_removed,
+                     chal4_round_stats_t * p_stats)
+{
+    uint8_t             retcode = RET_FAILURE;
+    chal4_band_t *      p_bands = NULL;
+    chal4_band_shared_t shared;
+
+    if ((NULL == p_grid) || (NULL == p_next) || (NULL == p_removed)
+        || (NULL == p_stats) || (0 >= thread_count))
+    {
+        perror("ERROR: Invalid arguments passed to threads_part2\n");
+        goto EXIT;
+    }
+
+    p_bands = chal4_bands_create(p_grid, &thread_count);
+    if (NULL == p_bands)
+    {
+        goto EXIT;
+    }
+
+    memset(&shared, 0, sizeof(shared));
+    shared.p_grid       = p_grid;
+    shared.p_next       = p_next;
+    shared.p_stats      = p_stats;
+    shared.p_bands      = p_bands;
+    shared.thread_count = thread_count;
+
+    for (int idx = 0; idx < thread_count; idx++)
+    {
+        p_bands[idx].p_shared = &shared;
+    }
+
+    if (0 != pthread_barrier_init(&shared.barrier, NULL, thread_count))
+    {
+        perror("ERROR: Unable to create round barrier");
+        goto EXIT;
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &shared.round_start);
+
+    retcode = chal4_bands_run(p_bands, thread_count, chal4_band_part2_worker);
+    pthread_barrier_destroy(&shared.barrier);
+
+    if ((RET_SUCCESS != retcode) || (true == shared.b_failed))
+    {
+        retcode = RET_FAILURE;
+        goto EXIT;
+    }
+
+    *p_removed += shared.removed;
+
+EXIT:
+    free(p_bands);
+    return retcode;
+}
+
+/**
+ * @brief Counts part 1 accessible rolls in a chunk of rows (pool reduction)
+ *
+ * @param p_ctx Grid to scan
+ * @param begin First row of the chunk
+ * @param end One past the last row
+ *
+ * @return Number of accessible rolls in the chunk
+ */
+static int64_t
+chal4_pool_count (void * p_ctx, size_t begin, size_t end)
+{
+    return chal4_band_count(p_ctx, begin, end);
+}
+
+/**
+ * @brief Writes one round of a chunk of rows into the next grid (pool
+ * reduction)
+ *
+ * @param p_ctx Pointer to the current and next grids
+ * @param begin First row of the chunk
+ * @param end One past the last row
+ *
+ * @return Number of rolls removed from the chunk
+ */
+static int64_t
+chal4_pool_round (void * p_ctx, size_t begin, size_t end)
+{
+    chal4_grid_t ** pp_grids = p_ctx; // Current, next
+
+    return chal4_band_round(pp_grids[0], pp_grids[1], begin, end);
+}
+
+/**
+ * @brief Counts part 1 accessible rolls as row chunks on a pool
+ *
+ * @param p_grid Grid to scan
+ * @param p_pool Pool to run on
+ * @param p_count Incremented by the number of accessible rolls
+ *
+ * @return RET_SUCCESS on success, RET_FAILURE on failure
+ */
+uint8_t
+chal4_pool_part1 (const chal4_grid_t * p_grid, aoc_pool_t * p_pool, long * p_count)
+{
+    if ((NULL == p_grid) || (NULL == p_count))
+    {
+        perror("ERROR: Invalid arguments passed to pool_part1\n");
+        return RET_FAILURE;
+    }
+
+    *p_count += aoc_pool_reduce(p_pool,
+                                0,
+                                p_grid->height,
+                                0,
+                                chal4_pool_count,
+                                aoc_pool_add,
+                                0,
+                                (void *)p_grid);
+
+    return RET_SUCCESS;
+}
+
+/**
+ * @brief Runs part 2 rounds as row chunks on a pool
+ *
+ * Each round is one reduction over the rows; the caller records it and swaps
+ * the grids between rounds.
+ *
+ * @param p_grid Current grid, holds the stable grid on return
+ * @param p_next Zeroed grid of the same size used as the next-round buffer
+ * @param p_pool Pool to run on
+ * @param p_removed Incremented by the number of rolls removed
+ * @param p_stats Receives the removals and wall time of every round
+ *
+ * @return RET_SUCCESS on success, RET_FAILURE on failure
+ */
+uint8_t
+chal4_pool_part2 (chal4_grid_t *        p_grid,
+                  chal4_grid_t *        p_next,
+                  aoc_pool_t *          p_pool,
+                  long *                p_removed,
+                  chal4_round_stats_t * p_stats)
+{
+    uint8_t         retcode       = RET_FAILURE;
+    chal4_grid_t *  pp_grids[2]   = { p_grid, p_next };
+    chal4_grid_t    swap;
+    long            round_removed = 0;
+    struct timespec round_start;
+
+    if ((NULL == p_grid) || (NULL == p_next) || (NULL == p_removed)
+        || (NULL == p_stats))
+    {
+        perror("ERROR: Invalid arguments passed to pool_part2\n");
+        goto EXIT;
+    }
+
+    do
+    {
+        AOC_TRACE_SCOPE_ARG("round", p_stats->count);
+
+        clock_gettime(CLOCK_MONOTONIC, &round_start);
+
+        round_removed = aoc_pool_reduce(p_pool,
+                                        0,
+                                        p_grid->height,
+                                        0,
+                                        chal4_pool_round,
+                                        aoc_pool_add,
+                                        0,
+                                        pp_grids);
+
+        if (RET_SUCCESS
+            != chal4_round_stats_add(
+                p_stats, round_removed, chal4_elapsed_ms(&round_start)))
+        {
+            goto EXIT;
+        }
+
+        swap    = *p_grid;
+        *p_grid = *p_next;
+        *p_next = swap;
+
+        *p_removed += round_removed;
+    } while (0 < round_removed);
+
+    retcode = RET_SUCCESS;
+EXIT:
+    return retcode;
+}
+
+/** END OF FILE **/
\ No newline at end of file
@@ -0,0 +1,307 @@
+/**
+ * @file chal4_tiles.c
+ *
+ * @brief Dirty-tile synchronous round engine for Advent of Code 2025
+ * Challenge 4
+ *
+ * The grid is cut into TILE_SIZE x TILE_SIZE tiles. A round only checks the
+ * tiles that had a removal in the previous round plus their eight neighbor
+ * tiles; everything else cannot have changed.
+ *
+ * The current and next grids are swapped by pointer after every round. For
+ * that to be safe both buffers must agree on every tile that is skipped, so a
+ * tile that was written last round but is skipped this round is copied
+ * across once.
+ *
+ * @author Mexeck88
+ *
+ * @date 18OCT26
+ */
+
+#include "chal4_simd.h"
+#include "chal4_tiles.h"
+
+/**
+ * @struct chal4_tiles_t
+ * @brief Tile geometry and the three tile bitmaps
+ */
+typedef struct chal4_tiles_t
+{
+    size_t     tiles_x;    // Tiles per tile row
+    size_t     tiles_y;    // Tile rows
+    size_t     words;      // uint64_t words per bitmap
+    uint64_t * p_active;   // Tiles to check this round
+    uint64_t * p_next;     // Tiles to check next round
+    uint64_t * p_written;  // Tiles written into the next grid last round
+    uint64_t * p_block;    // Single allocation behind the three bitmaps
+} chal4_tiles_t;
+
+/**
+ * @brief Sets the bit of a tile and of its eight neighbor tiles
+ *
+ * @param p_tiles Tile geometry
+ * @param p_bitmap Bitmap to mark
+ * @param tile_row Tile row of the changed tile
+ * @param tile_col Tile column of the changed tile
+ */
+static void
+chal4_tiles_mark (const chal4_tiles_t * p_tiles,
+                  uint64_t *            p_bitmap,
+                  size_t                tile_row,
+                  size_t                tile_col)
+{
+    size_t row_first = (0 < tile_row) ? tile_row - 1 : 0;
+    size_t col_first = (0 < tile_col) ? tile_col - 1 : 0;
+    size_t row_last  = (tile_row + 1 < p_tiles->tiles_y) ? tile_row + 1
+                                                         : tile_row;
+    size_t col_last  = (tile_col + 1 < p_tiles->tiles_x) ? tile_col + 1
+                                                         : tile_col;
+    size_t tile      = 0;
+
+    for (size_t row = row_first; row <= row_last; row++)
+    {
+        for (size_t col = col_first; col <= col_last; col++)
+        {
+            tile = (row * p_tiles->tiles_x) + col;
+            p_bitmap[tile / BITS_PER_WORD] |= 1ULL << (tile % BITS_PER_WORD);
+        }
+    }
+}
+
+/**
+ * @brief Runs one round on one tile, writing its cells into the next grid
+ *
+ * @param p_grid Current grid (read only)
+ * @param p_next Next grid
+ * @param row_first First data row of the tile
+ * @param col_first First data column of the tile
+ *
+ * @return Number of rolls removed from the tile
+ */
+static long
+chal4_tiles_round_tile (const chal4_grid_t * p_grid,
+                        chal4_grid_t *       p_next,
+                        size_t               row_first,
+                        size_t               col_first)
+{
+    long   removed  = 0;
+    size_t row_last = row_first + TILE_SIZE;
+    size_t col_last = col_first + TILE_SIZE;
+
+    row_last = (row_last < p_grid->height) ? row_last : p_grid->height;
+    col_last = (col_last < p_grid->width) ? col_last : p_grid->width;
+
+    for (size_t row = row_first; row < row_last; row++)
+    {
+        removed += chal4_row_step(&CHAL4_ROW(p_grid, row)[col_first],
+                                  p_grid->stride,
+                                  &CHAL4_ROW(p_next, row)[col_first],
+                                  col_last - col_first);
+    }
+
+    return removed;
+}
+
+/**
+ * @brief Copies one tile from the current grid into the next grid
+ *
+ * @param p_grid Current grid
+ * @param p_next Next grid
+ * @param row_first First data row of the tile
+ * @param col_first First data column of the tile
+ */
+static void
+chal4_tiles_copy_tile (const chal4_grid_t * p_grid,
+                       chal4_grid_t *       p_next,
+                       size_t               row_first,
+                       size_t               col_first)
+{
+    size_t row_last = row_first + TILE_SIZE;
+    size_t cols     = p_grid->width - col_first;
+
+    row_last = (row_last < p_grid->height) ? row_last : p_grid->height;
+    cols     = (cols < TILE_SIZE) ? cols : TILE_SIZE;
+
+    for (size_t row = row_first; row < row_last; row++)
+    {
+        memcpy(CHAL4_ROW(p_next, row) + col_first,
+               CHAL4_ROW(p_grid, row) + col_first,
+               cols);
+    }
+}
+
+/**
+ * @brief Runs one synchronous round over the active tiles
+ *
+ * @param p_tiles Tile geometry and bitmaps
+ * @param p_grid Current grid (read only)
+ * @param p_next Next grid
+ *
+ * @return Number of rolls removed in the round
+ */
+static long
+chal4_tiles_round (chal4_tiles_t *      p_tiles,
+                   const chal4_grid_t * p_grid,
+                   chal4_grid_t *       p_next)
+{
+    long     removed      = 0;
+    long     tile_removed = 0;
+    uint64_t bits         = 0;
+    size_t   tile         = 0;
+    size_t   tile_row     = 0;
+    size_t   tile_col     = 0;
+
+    for (size_t word = 0; word < p_tiles->words; word++)
+    {
+        // Active tiles are recomputed into the next grid
+        bits = p_tiles->p_active[word];
+        while (0 != bits)
+        {
+            tile     = (word * BITS_PER_WORD) + __builtin_ctzll(bits);
+            tile_row = tile / p_tiles->tiles_x;
+            tile_col = tile % p_tiles->tiles_x;
+            bits &= bits - 1;
+
+            tile_removed = chal4_tiles_round_tile(
+                p_grid, p_next, tile_row * TILE_SIZE, tile_col * TILE_SIZE);
+            if (0 < tile_removed)
+            {
+                chal4_tiles_mark(p_tiles, p_tiles->p_next, tile_row, tile_col);
+                removed += tile_removed;
+            }
+        }
+
+        // Tiles written last round but skipped now must be brought in sync
+        bits = p_tiles->p_written[word] & ~p_tiles->p_active[word];
+        while (0 != bits)
+        {
+            tile = (word * BITS_PER_WORD) + __builtin_ctzll(bits);
+            bits &= bits - 1;
+
+            chal4_tiles_copy_tile(p_grid,
+                                  p_next,
+                                  (tile / p_tiles->tiles_x) * TILE_SIZE,
+                                  (tile % p_tiles->tiles_x) * TILE_SIZE);
+        }
+    }
+
+    return removed;
+}
+
+/**
+ * @brief Allocates the tile bitmaps, with every tile active
+ *
+ * @param p_tiles Tile state to initialize
+ * @param p_grid Grid the tiles cover
+ *
+ * @return RET_SUCCESS on success, RET_FAILURE on failure
+ */
+static uint8_t
+chal4_tiles_init (chal4_tiles_t * p_tiles, const chal4_grid_t * p_grid)
+{
+    uint8_t retcode = RET_FAILURE;
+    size_t  count   = 0;
+
+    p_tiles->tiles_x = (p_grid->width + TILE_SIZE - 1) / TILE_SIZE;
+    p_tiles->tiles_y = (p_grid->height + TILE_SIZE - 1) / TILE_SIZE;
+    count            = p_tiles->tiles_x * p_tiles->tiles_y;
+    p_tiles->words   = (count + BITS_PER_WORD - 1) / BITS_PER_WORD;
+
+    p_tiles->p_block = calloc(3 * p_tiles->words, sizeof(uint64_t));
+    if (NULL == p_tiles->p_block)
+    {
+        perror("ERROR: Unable to allocate memory for tile bitmaps");
+        goto EXIT;
+    }
+
+    p_tiles->p_active  = p_tiles->p_block;
+    p_tiles->p_next    = p_tiles->p_active + p_tiles->words;
+    p_tiles->p_written = p_tiles->p_next + p_tiles->words;
+
+    for (size_t tile = 0; tile < count; tile++)
+    {
+        p_tiles->p_active[tile / BITS_PER_WORD] |= 1ULL
+                                                   << (tile % BITS_PER_WORD);
+    }
+
+    retcode = RET_SUCCESS;
+EXIT:
+    return retcode;
+}
+
+/**
+ * @brief Runs part 2 rounds, only re-checking tiles near last round's changes
+ *
+ * @param p_grid Current grid, holds the stable grid on return
+ * @param p_next Grid of the same size used as the next-round buffer
+ * @param p_removed Incremented by the number of rolls removed
+ * @param p_stats Receives the removals and wall time of every wave
+ *
+ * @return RET_SUCCESS on success, RET_FAILURE on failure
+ */
+uint8_t
+chal4_tiles_part2 (chal4_grid_t *        p_grid,
+                   chal4_grid_t *        p_next,
+                   long *                p_removed,
+                   chal4_round_stats_t * p_stats)
+{
+    uint8_t         retcode       = RET_FAILURE;
+    long            round_removed = 0;
+    uint64_t *      p_swap_bits   = NULL;
+    chal4_grid_t    swap;
+    chal4_tiles_t   tiles;
+    struct timespec round_start;
+
+    memset(&tiles, 0, sizeof(tiles));
+
+    if ((NULL == p_grid) || (NULL == p_next) || (NULL == p_removed)
+        || (NULL == p_stats))
+    {
+        perror("ERROR: NULL pointer passed to tiles_part2\n");
+        goto EXIT;
+    }
+
+    if (RET_SUCCESS != chal4_tiles_init(&tiles, p_grid))
+    {
+        goto EXIT;
+    }
+
+    // Both buffers start identical, so nothing needs syncing before round 1
+    memcpy(p_next->p_block,
+           p_grid->p_block,
+           (p_grid->height + (2 * p_grid->border)) * p_grid->stride);
+
+    do
+    {
+        clock_gettime(CLOCK_MONOTONIC, &round_start);
+
+        round_removed = chal4_tiles_round(&tiles, p_grid, p_next);
+
+        swap    = *p_grid;
+        *p_grid = *p_next;
+        *p_next = swap;
+
+        // This round's active set is what the next round has to sync
+        p_swap_bits       = tiles.p_written;
+        tiles.p_written   = tiles.p_active;
+        tiles.p_active    = tiles.p_next;
+        tiles.p_next      = p_swap_bits;
+        memset(tiles.p_next, 0, tiles.words * sizeof(uint64_t));
+
+        *p_removed += round_removed;
+
+        if (RET_SUCCESS
+            != chal4_round_stats_add(
+                p_stats, round_removed, chal4_elapsed_ms(&round_start)))
+        {
+            goto EXIT;
+        }
+    } while (0 < round_removed);
+
+    retcode = RET_SUCCESS;
+EXIT:
+    free(tiles.p_block);
+    return retcode;
+}
+
+/** END OF FILE **/
\ No newline at end of file
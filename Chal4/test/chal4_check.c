@@ -0,0 +1,975 @@
+/**
+ * @file chal4_check.c
+ *
+ * @brief Differential check of the Advent of Code 2025 Challenge 4 engines
+ *
+ * Random maps, from nearly empty to nearly full, are solved by a cell-by-cell
+ * full rescan with bounds checks in place of a border. That is compared with
+ * the row kernel of every CPU level, the band, pool, dirty-tile, rule (both
+ * kernels), tiled, Morton and peeling engines on the loaded grid, the edit
+ * API placing and removing every roll, and the serial, run-length, stream and
+ * pipelined loaders on the text.
+ * Usage: chal4_check [-n cases] [-S seed] [-o file]
+ *
+ * @author Mexeck88
+ *
+ * @date 18OCT26
+ */
+
+#include <unistd.h>
+
+#include "aoc_check.h"
+#include "aoc_pool.h"
+#include "chal4.h"
+#include "chal4_edit.h"
+#include "chal4_layout.h"
+#include "chal4_peel.h"
+#include "chal4_pipe.h"
+#include "chal4_rules.h"
+#include "chal4_simd.h"
+#include "chal4_sparse.h"
+#include "chal4_stream.h"
+#include "chal4_threads.h"
+#include "chal4_tiles.h"
+
+#define CHECK_CELLS   4096 // Most rolls per case
+#define CHECK_ROWS    80   // Past one 64-row tile
+#define CHECK_COLS    160  // Past two 64-byte vector blocks
+#define CHECK_THREADS 3    // Bands and queues, more than some maps have rows
+#define CHECK_NAME    32
+
+/**
+ * @struct chal4_check_cell_t
+ * @brief One roll of a case; the map is the rolls' bounding box from (0, 0)
+ */
+typedef struct chal4_check_cell_t
+{
+    uint16_t row;
+    uint16_t col;
+} chal4_check_cell_t;
+
+/**
+ * @brief Runs both parts of an engine on a freshly loaded grid
+ */
+typedef uint8_t (*chal4_check_engine_fn_t)(chal4_grid_t *        p_grid,
+                                           chal4_grid_t *        p_next,
+                                           chal4_round_stats_t * p_stats,
+                                           aoc_day_result_t *    p_got);
+
+/**
+ * @struct chal4_check_engine_t
+ * @brief An engine the grid is handed to
+ */
+typedef struct chal4_check_engine_t
+{
+    const char *            p_name;
+    chal4_check_engine_fn_t p_run;
+} chal4_check_engine_t;
+
+static bool    chal4_check_case (const aoc_check_case_t * p_case,
+                                 char *                   p_why,
+                                 size_t                   why_size);
+static void    chal4_check_generate (aoc_rng_t *        p_rng,
+                                     aoc_check_case_t * p_case);
+static bool    chal4_check_simplify (void * p_item, size_t step);
+static void    chal4_check_print (const aoc_check_case_t * p_case,
+                                  FILE *                   p_out);
+static uint8_t chal4_check_bands (chal4_grid_t *        p_grid,
+                                  chal4_grid_t *        p_next,
+                                  chal4_round_stats_t * p_stats,
+                                  aoc_day_result_t *    p_got);
+static uint8_t chal4_check_pool (chal4_grid_t *        p_grid,
+                                 chal4_grid_t *        p_next,
+                                 chal4_round_stats_t * p_stats,
+                                 aoc_day_result_t *    p_got);
+static uint8_t chal4_check_tiles (chal4_grid_t *        p_grid,
+                                  chal4_grid_t *        p_next,
+                                  chal4_round_stats_t * p_stats,
+                                  aoc_day_result_t *    p_got);
+static uint8_t chal4_check_rule (chal4_grid_t *        p_grid,
+                                 chal4_grid_t *        p_next,
+                                 chal4_round_stats_t * p_stats,
+                                 aoc_day_result_t *    p_got);
+static uint8_t chal4_check_rule_generic (chal4_grid_t *        p_grid,
+                                         chal4_grid_t *        p_next,
+                                         chal4_round_stats_t * p_stats,
+                                         aoc_day_result_t *    p_got);
+static uint8_t chal4_check_tiled (chal4_grid_t *        p_grid,
+                                  chal4_grid_t *        p_next,
+                                  chal4_round_stats_t * p_stats,
+                                  aoc_day_result_t *    p_got);
+static uint8_t chal4_check_morton (chal4_grid_t *        p_grid,
+                                   chal4_grid_t *        p_next,
+                                   chal4_round_stats_t * p_stats,
+                                   aoc_day_result_t *    p_got);
+static uint8_t chal4_check_peel (chal4_grid_t *        p_grid,
+                                 chal4_grid_t *        p_next,
+                                 chal4_round_stats_t * p_stats,
+                                 aoc_day_result_t *    p_got);
+
+static const aoc_check_t g_check = {
+    .p_name     = "chal4",
+    .item_size  = sizeof(chal4_check_cell_t),
+    .max_items  = CHECK_CELLS,
+    .p_generate = chal4_check_generate,
+    .p_check    = chal4_check_case,
+    .p_simplify = chal4_check_simplify,
+    .p_merge    = NULL,
+    .p_print    = chal4_check_print,
+};
+
+static const chal4_check_engine_t g_engines[] = {
+    { "bands", chal4_check_bands },
+    { "pool", chal4_check_pool },
+    { "tiles", chal4_check_tiles },
+    { "rule", chal4_check_rule },
+    { "generic rule", chal4_check_rule_generic },
+    { "tiled", chal4_check_tiled },
+    { "morton", chal4_check_morton },
+    { "peel", chal4_check_peel },
+};
+
+/**
+ * @brief Draws a random map: a size up to CHECK_ROWS x CHECK_COLS and a
+ * share of rolls from a few percent to nearly all
+ *
+ * @param p_rng Seeded generator
+ * @param p_case Empty case to fill
+ */
+static void
+chal4_check_generate (aoc_rng_t * p_rng, aoc_check_case_t * p_case)
+{
+    static const uint64_t densities[] = { 5, 35, 65, 90 }; // Percent
+    chal4_check_cell_t *  p_cells     = p_case->p_items;
+    size_t                count       = 0;
+    size_t                height      = 1 + aoc_rng_below(p_rng, CHECK_ROWS);
+    size_t                width       = 1 + aoc_rng_below(p_rng, CHECK_COLS);
+    uint64_t              density     = densities[aoc_rng_below(p_rng, 4)];
+
+    for (size_t row = 0; row < height; row++)
+    {
+        for (size_t col = 0; (col < width) && (count < p_case->capacity);
+             col++)
+        {
+            if (aoc_rng_below(p_rng, 100) < density)
+            {
+                p_cells[count].row = (uint16_t)row;
+                p_cells[count].col = (uint16_t)col;
+                count++;
+            }
+        }
+    }
+
+    p_case->count = count;
+}
+
+/**
+ * @brief Simplifies a roll by moving it toward (0, 0): a row or a column
+ * up, or halfway there
+ *
+ * @param p_item Roll to move
+ * @param step Which way
+ *
+ * @return false once step is past the last way
+ */
+static bool
+chal4_check_simplify (void * p_item, size_t step)
+{
+    chal4_check_cell_t * p_cell = p_item;
+
+    switch (step)
+    {
+        case 0:
+            p_cell->row -= (0 < p_cell->row) ? 1 : 0;
+            break;
+
+        case 1:
+            p_cell->col -= (0 < p_cell->col) ? 1 : 0;
+            break;
+
+        case 2:
+            p_cell->row /= 2;
+            break;
+
+        case 3:
+            p_cell->col /= 2;
+            break;
+
+        default:
+            return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Spreads the rolls of a case over their bounding box, at least 1 x 1
+ *
+ * @param p_case Case to spread
+ * @param p_width Receives the map width
+ * @param p_height Receives the map height
+ *
+ * @return width * height cells, 1 for a roll (rolls may repeat), or NULL if
+ * out of memory; the caller frees it
+ */
+static uint8_t *
+chal4_check_map (const aoc_check_case_t * p_case,
+                 size_t *                 p_width,
+                 size_t *                 p_height)
+{
+    const chal4_check_cell_t * p_cells = p_case->p_items;
+    uint8_t *                  p_map   = NULL;
+
+    *p_width  = 1;
+    *p_height = 1;
+
+    for (size_t idx = 0; idx < p_case->count; idx++)
+    {
+        if (*p_height <= p_cells[idx].row)
+        {
+            *p_height = (size_t)p_cells[idx].row + 1;
+        }
+
+        if (*p_width <= p_cells[idx].col)
+        {
+            *p_width = (size_t)p_cells[idx].col + 1;
+        }
+    }
+
+    p_map = calloc(*p_width * *p_height, 1);
+    if (NULL == p_map)
+    {
+        return NULL;
+    }
+
+    for (size_t idx = 0; idx < p_case->count; idx++)
+    {
+        p_map[(p_cells[idx].row * *p_width) + p_cells[idx].col] = 1;
+    }
+
+    return p_map;
+}
+
+/**
+ * @brief Writes the map as input lines
+ *
+ * @param p_case Case to write
+ * @param p_out Where to write it
+ */
+static void
+chal4_check_print (const aoc_check_case_t * p_case, FILE * p_out)
+{
+    size_t    width  = 0;
+    size_t    height = 0;
+    uint8_t * p_map  = chal4_check_map(p_case, &width, &height);
+
+    if (NULL == p_map)
+    {
+        return;
+    }
+
+    for (size_t row = 0; row < height; row++)
+    {
+        for (size_t col = 0; col < width; col++)
+        {
+            fputc((1 == p_map[(row * width) + col]) ? ROLL_CHAR : '.', p_out);
+        }
+        fputc('\n', p_out);
+    }
+
+    free(p_map);
+}
+
+/**
+ * @brief Reference: counts the accessible rolls cell by cell, checking
+ * every neighbor against the edges, and with b_peel removes them round
+ * after round until none is left
+ *
+ * @param p_map Map to solve, cleared of the removed rolls with b_peel
+ * @param width Map width
+ * @param height Map height
+ * @param b_peel Solve part 2 instead of part 1
+ *
+ * @return Accessible (part 1) or removed (part 2) rolls
+ */
+static long
+chal4_check_reference (uint8_t * p_map,
+                       size_t    width,
+                       size_t    height,
+                       bool      b_peel)
+{
+    long    total     = 0;
+    long    round     = 0;
+    int     neighbors = 0;
+    uint8_t removed[CHECK_ROWS * CHECK_COLS];
+
+    do
+    {
+        round = 0;
+        memset(removed, 0, width * height);
+
+        for (size_t row = 0; row < height; row++)
+        {
+            for (size_t col = 0; col < width; col++)
+            {
+                if (1 != p_map[(row * width) + col])
+                {
+                    continue;
+                }
+
+                neighbors = 0;
+                for (int d_row = -1; d_row <= 1; d_row++)
+                {
+                    for (int d_col = -1; d_col <= 1; d_col++)
+                    {
+                        if (((0 == d_row) && (0 == d_col))
+                            || ((0 == row) && (0 > d_row))
+                            || ((0 == col) && (0 > d_col))
+                            || ((height - 1 == row) && (0 < d_row))
+                            || ((width - 1 == col) && (0 < d_col)))
+                        {
+                            continue;
+                        }
+
+                        neighbors += p_map[((row + d_row) * width)
+                                           + (col + d_col)];
+                    }
+                }
+
+                if (NEIGHBOR_COUNT > neighbors)
+                {
+                    removed[(row * width) + col] = 1;
+                    round++;
+                }
+            }
+        }
+
+        for (size_t cell = 0; (true == b_peel) && (cell < width * height);
+             cell++)
+        {
+            p_map[cell] &= (uint8_t)(1 - removed[cell]);
+        }
+
+        total += round;
+    } while ((true == b_peel) && (0 < round));
+
+    return total;
+}
+
+/**
+ * @brief Runs both parts with the threaded row bands
+ */
+static uint8_t
+chal4_check_bands (chal4_grid_t *        p_grid,
+                   chal4_grid_t *        p_next,
+                   chal4_round_stats_t * p_stats,
+                   aoc_day_result_t *    p_got)
+{
+    long part1 = 0;
+    long part2 = 0;
+
+    if ((RET_SUCCESS != chal4_threads_part1(p_grid, CHECK_THREADS, &part1))
+        || (RET_SUCCESS
+            != chal4_threads_part2(
+                p_grid, p_next, CHECK_THREADS, &part2, p_stats)))
+    {
+        return RET_FAILURE;
+    }
+
+    p_got->part1 = part1;
+    p_got->part2 = part2;
+    return RET_SUCCESS;
+}
+
+/**
+ * @brief Runs both parts as row chunks on the shared pool
+ */
+static uint8_t
+chal4_check_pool (chal4_grid_t *        p_grid,
+                  chal4_grid_t *        p_next,
+                  chal4_round_stats_t * p_stats,
+                  aoc_day_result_t *    p_got)
+{
+    long part1 = 0;
+    long part2 = 0;
+
+    if ((RET_SUCCESS != chal4_pool_part1(p_grid, aoc_pool_shared(), &part1))
+        || (RET_SUCCESS
+            != chal4_pool_part2(
+                p_grid, p_next, aoc_pool_shared(), &part2, p_stats)))
+    {
+        return RET_FAILURE;
+    }
+
+    p_got->part1 = part1;
+    p_got->part2 = part2;
+    return RET_SUCCESS;
+}
+
+/**
+ * @brief Runs part 2 with the dirty-tile engine; its first wave is part 1
+ */
+static uint8_t
+chal4_check_tiles (chal4_grid_t *        p_grid,
+                   chal4_grid_t *        p_next,
+                   chal4_round_stats_t * p_stats,
+                   aoc_day_result_t *    p_got)
+{
+    long part2 = 0;
+
+    if (RET_SUCCESS != chal4_tiles_part2(p_grid, p_next, &part2, p_stats))
+    {
+        return RET_FAILURE;
+    }
+
+    p_got->part1 = (0 < p_stats->count) ? p_stats->p_removed[0] : 0;
+    p_got->part2 = part2;
+    return RET_SUCCESS;
+}
+
+/**
+ * @brief Runs both parts with the default rule, on its specialized kernel
+ * or forced onto the generic one
+ */
+static uint8_t
+chal4_check_rule_kernel (chal4_grid_t *        p_grid,
+                         chal4_grid_t *        p_next,
+                         chal4_round_stats_t * p_stats,
+                         bool                  b_generic,
+                         aoc_day_result_t *    p_got)
+{
+    long                part2 = 0;
+    chal4_rule_t        rule;
+    chal4_rule_engine_t engine;
+
+    if ((RET_SUCCESS != chal4_rule_parse(DEFAULT_RULE, &rule))
+        || (RET_SUCCESS
+            != chal4_rule_bind(&rule, p_grid->stride, b_generic, &engine)))
+    {
+        return RET_FAILURE;
+    }
+
+    p_got->part1 = chal4_rule_pass(&engine, p_grid, NULL);
+
+    if (RET_SUCCESS
+        != chal4_rule_part2(&engine, p_grid, p_next, &part2, p_stats))
+    {
+        return RET_FAILURE;
+    }
+
+    p_got->part2 = part2;
+    return RET_SUCCESS;
+}
+
+/**
+ * @brief Runs both parts with the default rule's specialized kernel
+ */
+static uint8_t
+chal4_check_rule (chal4_grid_t *        p_grid,
+                  chal4_grid_t *        p_next,
+                  chal4_round_stats_t * p_stats,
+                  aoc_day_result_t *    p_got)
+{
+    return chal4_check_rule_kernel(p_grid, p_next, p_stats, false, p_got);
+}
+
+/**
+ * @brief Runs both parts with the default rule on the generic kernel
+ */
+static uint8_t
+chal4_check_rule_generic (chal4_grid_t *        p_grid,
+                          chal4_grid_t *        p_next,
+                          chal4_round_stats_t * p_stats,
+                          aoc_day_result_t *    p_got)
+{
+    return chal4_check_rule_kernel(p_grid, p_next, p_stats, true, p_got);
+}
+
+/**
+ * @brief Runs both parts on a tiled or Morton copy of the grid
+ */
+static uint8_t
+chal4_check_layout (const chal4_grid_t *  p_grid,
+                    chal4_layout_kind_t   kind,
+                    chal4_round_stats_t * p_stats,
+                    aoc_day_result_t *    p_got)
+{
+    uint8_t        retcode = RET_FAILURE;
+    long           part2   = 0;
+    chal4_layout_t layout;
+    chal4_layout_t next;
+
+    memset(&layout, 0, sizeof(layout));
+    memset(&next, 0, sizeof(next));
+
+    if ((RET_SUCCESS != chal4_layout_from_grid(p_grid, kind, &layout))
+        || (RET_SUCCESS != chal4_layout_alloc_like(&layout, &next)))
+    {
+        goto EXIT;
+    }
+
+    p_got->part1 = chal4_layout_pass(&layout, NULL);
+
+    if (RET_SUCCESS != chal4_layout_part2(&layout, &next, &part2, p_stats))
+    {
+        goto EXIT;
+    }
+
+    p_got->part2 = part2;
+    retcode      = RET_SUCCESS;
+EXIT:
+    chal4_layout_free(&layout);
+    chal4_layout_free(&next);
+    return retcode;
+}
+
+/**
+ * @brief Runs both parts on a tiled copy of the grid
+ */
+static uint8_t
+chal4_check_tiled (chal4_grid_t *        p_grid,
+                   chal4_grid_t *        p_next,
+                   chal4_round_stats_t * p_stats,
+                   aoc_day_result_t *    p_got)
+{
+    (void)p_next;
+    return chal4_check_layout(p_grid, LAYOUT_TILED, p_stats, p_got);
+}
+
+/**
+ * @brief Runs both parts on a Morton copy of the grid
+ */
+static uint8_t
+chal4_check_morton (chal4_grid_t *        p_grid,
+                    chal4_grid_t *        p_next,
+                    chal4_round_stats_t * p_stats,
+                    aoc_day_result_t *    p_got)
+{
+    (void)p_next;
+    return chal4_check_layout(p_grid, LAYOUT_MORTON, p_stats, p_got);
+}
+
+/**
+ * @brief Runs both parts with the lock-free peeling engine
+ */
+static uint8_t
+chal4_check_peel (chal4_grid_t *        p_grid,
+                  chal4_grid_t *        p_next,
+                  chal4_round_stats_t * p_stats,
+                  aoc_day_result_t *    p_got)
+{
+    long part1  = 0;
+    long part2  = 0;
+    long stolen = 0;
+
+    (void)p_next;
+    (void)p_stats;
+
+    if (RET_SUCCESS
+        != chal4_peel_run(p_grid, CHECK_THREADS, &part1, &part2, &stolen))
+    {
+        return RET_FAILURE;
+    }
+
+    p_got->part1 = part1;
+    p_got->part2 = part2;
+    return RET_SUCCESS;
+}
+
+/**
+ * @brief Runs both parts with one row kernel, as the serial solver does
+ *
+ * @param p_row_fn Row kernel
+ * @param p_grid Loaded grid, holds the stable grid on return
+ * @param p_next Zeroed grid of the same size
+ * @param p_got Receives both parts
+ */
+static void
+chal4_check_rows (chal4_row_fn_t     p_row_fn,
+                  chal4_grid_t *     p_grid,
+                  chal4_grid_t *     p_next,
+                  aoc_day_result_t * p_got)
+{
+    long         round = 0;
+    chal4_grid_t swap;
+
+    p_got->part1 = 0;
+    p_got->part2 = 0;
+
+    for (size_t row = 0; row < p_grid->height; row++)
+    {
+        p_got->part1 += p_row_fn(
+            CHAL4_ROW(p_grid, row), p_grid->stride, NULL, p_grid->width);
+    }
+
+    do
+    {
+        round = 0;
+        for (size_t row = 0; row < p_grid->height; row++)
+        {
+            round += p_row_fn(CHAL4_ROW(p_grid, row),
+                              p_grid->stride,
+                              CHAL4_ROW(p_next, row),
+                              p_grid->width);
+        }
+
+        swap    = *p_grid;
+        *p_grid = *p_next;
+        *p_next = swap;
+
+        p_got->part2 += round;
+    } while (0 < round);
+}
+
+/**
+ * @brief Places every roll of a case on an empty grid through the edit API,
+ * then removes every other one, checking the live part 1 count after each
+ * half against the reference
+ *
+ * @param p_case Case to edit in
+ * @param p_map Map of the case, cleared of the removed rolls
+ * @param width Map width
+ * @param height Map height
+ * @param p_why Receives the first mismatch
+ * @param why_size Size of p_why
+ *
+ * @return true if both counts agree with the reference
+ */
+static bool
+chal4_check_edit (const aoc_check_case_t * p_case,
+                  uint8_t *                p_map,
+                  size_t                   width,
+                  size_t                   height,
+                  char *                   p_why,
+                  size_t                   why_size)
+{
+    bool                       b_retval = false;
+    const chal4_check_cell_t * p_cells  = p_case->p_items;
+    chal4_grid_t               grid;
+    chal4_edit_state_t         state;
+
+    memset(&grid, 0, sizeof(grid));
+    memset(&state, 0, sizeof(state));
+
+    // The grid moves into the state, which leaves it empty
+    if ((RET_SUCCESS != chal4_grid_alloc(&grid, width, height, GRID_BORDER))
+        || (RET_SUCCESS != chal4_edit_init(&state, &grid)))
+    {
+        snprintf(p_why, why_size, "edit state failed");
+        goto EXIT;
+    }
+
+    for (size_t idx = 0; idx < p_case->count; idx++)
+    {
+        if (RET_SUCCESS
+            != chal4_edit_set_cell(&state, p_cells[idx].row, p_cells[idx].col))
+        {
+            snprintf(p_why, why_size, "edit set failed");
+            goto EXIT;
+        }
+    }
+
+    if (false
+        == aoc_check_equal("edit API",
+                           "after placing every roll",
+                           state.accessible,
+                           chal4_check_reference(p_map, width, height, false),
+                           p_why,
+                           why_size))
+    {
+        goto EXIT;
+    }
+
+    for (size_t idx = 0; idx < p_case->count; idx += 2)
+    {
+        p_map[(p_cells[idx].row * width) + p_cells[idx].col] = 0;
+        if (RET_SUCCESS
+            != chal4_edit_clear_cell(
+                &state, p_cells[idx].row, p_cells[idx].col))
+        {
+            snprintf(p_why, why_size, "edit clear failed");
+            goto EXIT;
+        }
+    }
+
+    if (false
+        == aoc_check_equal("edit API",
+                           "after removing every other roll",
+                           state.accessible,
+                           chal4_check_reference(p_map, width, height, false),
+                           p_why,
+                           why_size))
+    {
+        goto EXIT;
+    }
+
+    b_retval = true;
+EXIT:
+    chal4_grid_free(&grid);
+    chal4_edit_free(&state);
+    return b_retval;
+}
+
+/**
+ * @brief Runs the grid engines, each on its own fresh load of the text
+ *
+ * @param p_path Input text
+ * @param p_want Reference answers
+ * @param p_why Receives the first mismatch
+ * @param why_size Size of p_why
+ *
+ * @return true if every grid engine agrees with the reference
+ */
+static bool
+chal4_check_grid_engines (const char *             p_path,
+                          const aoc_day_result_t * p_want,
+                          char *                   p_why,
+                          size_t                   why_size)
+{
+    bool                b_retval = false;
+    size_t              engines  = sizeof(g_engines) / sizeof(g_engines[0]);
+    size_t              levels   = (size_t)aoc_cpu_detect() + 1;
+    const char *        p_name   = NULL;
+    char                name[CHECK_NAME];
+    chal4_grid_t        grid;
+    chal4_grid_t        next;
+    chal4_round_stats_t stats;
+    aoc_day_result_t    got;
+
+    memset(&grid, 0, sizeof(grid));
+    memset(&next, 0, sizeof(next));
+    memset(&stats, 0, sizeof(stats));
+
+    // Every row kernel this CPU can run, then every engine in g_engines
+    for (size_t idx = 0; idx < levels + engines; idx++)
+    {
+        memset(&got, 0, sizeof(got));
+
+        if (idx < levels)
+        {
+            snprintf(name,
+                     sizeof(name),
+                     "%s row kernel",
+                     aoc_cpu_name((aoc_cpu_level_t)idx));
+            p_name = name;
+        }
+        else
+        {
+            p_name = g_engines[idx - levels].p_name;
+        }
+
+        if ((RET_SUCCESS != chal4_load_input(p_path, GRID_BORDER, NULL, &grid))
+            || (RET_SUCCESS
+                != chal4_grid_alloc(
+                    &next, grid.width, grid.height, grid.border)))
+        {
+            snprintf(p_why, why_size, "%s: unable to load the grid", p_name);
+            goto CLEAN;
+        }
+
+        if (idx < levels)
+        {
+            chal4_check_rows(
+                chal4_row_variant((aoc_cpu_level_t)idx), &grid, &next, &got);
+        }
+        else if (RET_SUCCESS
+                 != g_engines[idx - levels].p_run(&grid, &next, &stats, &got))
+        {
+            snprintf(p_why, why_size, "%s engine failed", p_name);
+            goto CLEAN;
+        }
+
+        if (false == aoc_check_result(p_name, &got, p_want, p_why, why_size))
+        {
+            goto CLEAN;
+        }
+
+        chal4_grid_free(&grid);
+        chal4_grid_free(&next);
+        chal4_round_stats_free(&stats);
+    }
+
+    b_retval = true;
+CLEAN:
+    chal4_grid_free(&grid);
+    chal4_grid_free(&next);
+    chal4_round_stats_free(&stats);
+    return b_retval;
+}
+
+/**
+ * @brief Runs the engines that read the text themselves
+ *
+ * @param p_path Input text
+ * @param p_want Reference answers
+ * @param p_why Receives the first mismatch
+ * @param why_size Size of p_why
+ *
+ * @return true if every text engine agrees with the reference
+ */
+static bool
+chal4_check_text_engines (const char *             p_path,
+                          const aoc_day_result_t * p_want,
+                          char *                   p_why,
+                          size_t                   why_size)
+{
+    bool                b_retval = false;
+    long                part2    = 0;
+    chal4_sparse_t      sparse;
+    chal4_sparse_t      sparse_next;
+    chal4_grid_t        grid;
+    chal4_grid_t        next;
+    chal4_round_stats_t stats;
+    aoc_day_result_t    got = { 0 };
+
+    memset(&sparse, 0, sizeof(sparse));
+    memset(&sparse_next, 0, sizeof(sparse_next));
+    memset(&grid, 0, sizeof(grid));
+    memset(&next, 0, sizeof(next));
+    memset(&stats, 0, sizeof(stats));
+
+    if (RET_SUCCESS != chal4_run(p_path, NULL, &got))
+    {
+        snprintf(p_why, why_size, "chal4_run failed");
+        goto EXIT;
+    }
+
+    if (false == aoc_check_result("chal4_run", &got, p_want, p_why, why_size))
+    {
+        goto EXIT;
+    }
+
+    // Run-length rows
+    if (RET_SUCCESS != chal4_sparse_load(p_path, NULL, &sparse))
+    {
+        snprintf(p_why, why_size, "sparse load failed");
+        goto EXIT;
+    }
+
+    got.part1 = chal4_sparse_pass(&sparse, NULL);
+    if (RET_SUCCESS
+        != chal4_sparse_part2(&sparse, &sparse_next, &part2, &stats))
+    {
+        snprintf(p_why, why_size, "sparse engine failed");
+        goto EXIT;
+    }
+
+    got.part2 = part2;
+    if (false == aoc_check_result("sparse", &got, p_want, p_why, why_size))
+    {
+        goto EXIT;
+    }
+
+    // Three-row ring, part 1 only, added to the count
+    got.part1 = 0;
+    if (RET_SUCCESS != chal4_stream_part1(p_path, &got.part1))
+    {
+        snprintf(p_why, why_size, "stream engine failed");
+        goto EXIT;
+    }
+
+    if (false
+        == aoc_check_equal(
+            "stream", "part 1", got.part1, p_want->part1, p_why, why_size))
+    {
+        goto EXIT;
+    }
+
+    // Grid loaded while the text is still being read
+    if ((RET_SUCCESS
+         != chal4_pipe_load_input(p_path, GRID_BORDER, NULL, &grid))
+        || (RET_SUCCESS
+            != chal4_grid_alloc(&next, grid.width, grid.height, grid.border)))
+    {
+        snprintf(p_why, why_size, "pipelined load failed");
+        goto EXIT;
+    }
+
+    chal4_check_rows(chal4_row_step, &grid, &next, &got);
+    if (false == aoc_check_result("pipe", &got, p_want, p_why, why_size))
+    {
+        goto EXIT;
+    }
+
+    b_retval = true;
+EXIT:
+    chal4_sparse_free(&sparse);
+    chal4_sparse_free(&sparse_next);
+    chal4_grid_free(&grid);
+    chal4_grid_free(&next);
+    chal4_round_stats_free(&stats);
+    return b_retval;
+}
+
+/**
+ * @brief Runs every engine on a case and compares it with the reference
+ *
+ * @param p_case Rolls to check
+ * @param p_why Receives the first mismatch
+ * @param why_size Size of p_why
+ *
+ * @return true if every engine agrees with the reference
+ */
+static bool
+chal4_check_case (const aoc_check_case_t * p_case,
+                  char *                   p_why,
+                  size_t                   why_size)
+{
+    bool             b_retval = false;
+    size_t           width    = 0;
+    size_t           height   = 0;
+    uint8_t *        p_map    = chal4_check_map(p_case, &width, &height);
+    int              fd       = -1;
+    char             path[AOC_CHECK_PATH];
+    aoc_day_result_t want = { 0 };
+
+    if (NULL == p_map)
+    {
+        snprintf(p_why, why_size, "unable to build the map");
+        goto EXIT;
+    }
+
+    want.part1 = chal4_check_reference(p_map, width, height, false);
+    want.part2 = chal4_check_reference(p_map, width, height, true);
+    free(p_map);
+
+    fd = aoc_check_text(&g_check, p_case, path, sizeof(path));
+    if (0 > fd)
+    {
+        snprintf(p_why, why_size, "unable to write the input");
+        goto EXIT;
+    }
+
+    if ((false == chal4_check_grid_engines(path, &want, p_why, why_size))
+        || (false == chal4_check_text_engines(path, &want, p_why, why_size)))
+    {
+        goto EXIT;
+    }
+
+    // A fresh map, the reference above peeled the first one
+    p_map = chal4_check_map(p_case, &width, &height);
+    if (NULL == p_map)
+    {
+        snprintf(p_why, why_size, "unable to build the map");
+        goto EXIT;
+    }
+
+    b_retval = chal4_check_edit(p_case, p_map, width, height, p_why, why_size);
+    free(p_map);
+
+EXIT:
+    if (0 <= fd)
+    {
+        close(fd);
+    }
+
+    return b_retval;
+}
+
+int
+main (int argc, char ** argv)
+{
+    return aoc_check_main(&g_check, argc, argv);
+}
+
+/** END OF FILE **/
\ No newline at end of file
@@ -0,0 +1,54 @@
+/**
+ * @file aoc_alloc.h
+ *
+ * @brief Heap allocation counters for the Advent of Code 2025 challenges,
+ * fed by link-time malloc wrappers.
+ *
+ * Linking with -Wl,--wrap=malloc,--wrap=calloc,--wrap=realloc,--wrap=free,
+ * --wrap=aligned_alloc,--wrap=getline (the ChalN Makefiles' alloc target)
+ * routes every allocation made by the challenge and this library through
+ * aoc_alloc_wrap.c, which counts it and forwards it to the C library.
+ * Without those flags the wrappers are never linked in, aoc_alloc_enabled
+ * is false and the counters stay at zero.
+ *
+ * @author Mexeck88
+ *
+ * @date 18OCT26
+ */
+
+#ifndef AOC_ALLOC_H
+#define AOC_ALLOC_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @struct aoc_alloc_stats_t
+ * @brief Allocation counts and heap use, total or since a mark
+ *
+ * Heap sizes are usable sizes as reported by malloc_usable_size, so they
+ * include the allocator's rounding; bytes is what was asked for.
+ */
+typedef struct aoc_alloc_stats_t
+{
+    uint64_t allocs;   // malloc, calloc, aligned_alloc, new getline buffers
+    uint64_t reallocs; // realloc of a live block, getline growing its buffer
+    uint64_t frees;    // free of a live block, realloc to nothing
+    uint64_t bytes;    // Requested by allocs and reallocs
+    uint64_t live;     // Heap in use
+    uint64_t peak;     // Most heap in use at once
+} aoc_alloc_stats_t;
+
+bool aoc_alloc_enabled (void);
+void aoc_alloc_mark (aoc_alloc_stats_t * p_mark);
+void aoc_alloc_since (const aoc_alloc_stats_t * p_mark,
+                      aoc_alloc_stats_t *       p_delta);
+
+// Used by aoc_alloc_wrap.c only
+void aoc_alloc_attach (void);
+void aoc_alloc_count (size_t requested, size_t old_size, size_t new_size);
+
+#endif /* AOC_ALLOC_H */
+
+/** END OF FILE **/
\ No newline at end of file
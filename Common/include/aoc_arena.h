@@ -0,0 +1,75 @@
+/**
+ * @file aoc_arena.h
+ *
+ * @brief Bump allocator for the parsed data of the Advent of Code 2025
+ * challenges.
+ *
+ * @author Mexeck88
+ *
+ * @date 18OCT26
+ */
+
+#ifndef AOC_ARENA_H
+#define AOC_ARENA_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @enum aoc_arena_info_t
+ * @brief Arena constants
+ */
+typedef enum aoc_arena_info_t
+{
+    AOC_ARENA_CHUNK = 1 << 16, // Default size of the first chunk
+    AOC_ARENA_ALIGN = 16,      // Alignment of aoc_arena_alloc
+    AOC_ARENA_SCALE = 2,       // Chunk growth factor
+} aoc_arena_info_t;
+
+/**
+ * @struct aoc_arena_chunk_t
+ * @brief One heap block carved up by the arena; the payload follows it
+ */
+typedef struct aoc_arena_chunk_t
+{
+    struct aoc_arena_chunk_t * p_next;   // Older chunk
+    size_t                     capacity; // Payload bytes
+    size_t                     used;     // Payload bytes handed out
+} aoc_arena_chunk_t;
+
+/**
+ * @struct aoc_arena_t
+ * @brief Chain of chunks, newest first, released all at once
+ *
+ * Only the newest chunk is bumped. When it is full a new chunk at least
+ * AOC_ARENA_SCALE times larger is pushed, so the chunk count stays
+ * logarithmic in the total size.
+ */
+typedef struct aoc_arena_t
+{
+    aoc_arena_chunk_t * p_head;         // Chunk being bumped
+    void *              p_last;         // Most recent allocation
+    size_t              chunk_size;     // Payload size of the next chunk
+    size_t              bytes_used;     // Payload handed out, padding included
+    size_t              bytes_reserved; // Payload of every chunk
+    size_t              chunk_count;
+    size_t              alloc_count;
+} aoc_arena_t;
+
+void   aoc_arena_init (aoc_arena_t * p_arena, size_t chunk_size);
+void * aoc_arena_alloc (aoc_arena_t * p_arena, size_t size);
+void * aoc_arena_alloc_aligned (aoc_arena_t * p_arena,
+                                size_t        size,
+                                size_t        align);
+void * aoc_arena_grow (aoc_arena_t * p_arena,
+                       void *        p_old,
+                       size_t        old_size,
+                       size_t        new_size,
+                       size_t        align);
+void   aoc_arena_reset (aoc_arena_t * p_arena);
+void   aoc_arena_free (aoc_arena_t * p_arena);
+void   aoc_arena_print (const aoc_arena_t * p_arena, const char * p_phase);
+
+#endif /* AOC_ARENA_H */
+
+/** END OF FILE **/
\ No newline at end of file
@@ -0,0 +1,81 @@
+/**
+ * @file aoc_bench.h
+ *
+ * @brief Phase-timed benchmark harness for the Advent of Code 2025
+ * challenges.
+ *
+ * @author Mexeck88
+ *
+ * @date 18OCT26
+ */
+
+#ifndef AOC_BENCH_H
+#define AOC_BENCH_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @enum aoc_bench_info_t
+ * @brief Benchmark constants
+ */
+typedef enum aoc_bench_info_t
+{
+    AOC_BENCH_RUNS       = 50,  // Timed runs when -b has no count
+    AOC_BENCH_WARMUP     = 5,   // Untimed runs before the timed ones
+    AOC_BENCH_PERCENTILE = 99,  // Tail percentile reported next to the median
+    AOC_BENCH_NS_PER_SEC = 1000000000,
+} aoc_bench_info_t;
+
+/**
+ * @brief One phase of a challenge run
+ *
+ * @param p_ctx Challenge state shared by every phase
+ *
+ * @return AOC_SUCCESS (0) on success, anything else on failure
+ */
+typedef uint8_t (*aoc_bench_fn_t)(void * p_ctx);
+
+/**
+ * @struct aoc_bench_phase_t
+ * @brief A named, separately timed step of a run
+ */
+typedef struct aoc_bench_phase_t
+{
+    const char *   p_name;
+    aoc_bench_fn_t p_run;
+} aoc_bench_phase_t;
+
+/**
+ * @struct aoc_bench_t
+ * @brief Everything the harness needs to time a challenge
+ *
+ * Each run calls every phase in order, then p_reset outside the timed
+ * region so the next run starts from the same state.
+ */
+typedef struct aoc_bench_t
+{
+    const char *              p_name;      // Challenge name in the report
+    const char *              p_file_path; // Input, sized for throughput
+    const aoc_bench_phase_t * p_phases;
+    size_t                    phase_count;
+    aoc_bench_fn_t            p_reset;     // Releases what the phases built
+    void *                    p_ctx;
+    size_t                    runs;        // Timed runs
+    size_t                    warmup;      // Untimed runs first
+} aoc_bench_t;
+
+uint8_t aoc_bench_args (int           argc,
+                        char **       argv,
+                        bool *        p_b_bench,
+                        size_t *      p_runs,
+                        bool *        p_b_pipe,
+                        bool *        p_b_no_cache,
+                        const char ** pp_snap,
+                        const char ** pp_path);
+uint8_t aoc_bench_run (const aoc_bench_t * p_bench);
+
+#endif /* AOC_BENCH_H */
+
+/** END OF FILE **/
\ No newline at end of file
@@ -0,0 +1,77 @@
+/**
+ * @file aoc_cache.h
+ *
+ * @brief Content-addressed on-disk cache of challenge answers for the
+ * Advent of Code 2025 challenges.
+ *
+ * @author Mexeck88
+ *
+ * @date 18OCT26
+ */
+
+#ifndef AOC_CACHE_H
+#define AOC_CACHE_H
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "aoc_day.h"
+#include "aoc_input.h"
+
+/**
+ * @enum aoc_cache_info_t
+ * @brief Cache constants
+ */
+typedef enum aoc_cache_info_t
+{
+    AOC_CACHE_PATH   = 4096, // Longest cache directory or entry path
+    AOC_CACHE_ENTRY  = 1024, // Largest entry file
+    AOC_CACHE_FORMAT = 1,    // Entry layout, bumped when it changes
+} aoc_cache_info_t;
+
+#define AOC_CACHE_ENV     "AOC_CACHE_DIR"  // Overrides the directory
+#define AOC_CACHE_HOME    ".cache/aoc2025" // Under $HOME by default
+#define AOC_CACHE_DEFAULT ".aoc_cache"     // Without $HOME
+
+/**
+ * @struct aoc_cache_t
+ * @brief Cache directory and what happened to the lookups made so far
+ *
+ * One cache may be shared by days running on different threads.
+ */
+typedef struct aoc_cache_t
+{
+    char         dir[AOC_CACHE_PATH];
+    atomic_ulong hits;
+    atomic_ulong misses;
+} aoc_cache_t;
+
+/**
+ * @struct aoc_cache_key_t
+ * @brief Everything an answer depends on
+ */
+typedef struct aoc_cache_key_t
+{
+    int          day;
+    const char * p_version;  // Solver version, bumped when answers change
+    const char * p_params;   // Options that change the answers, "" if none
+    uint64_t     input_hash; // aoc_hash64 of the whole input
+    size_t       input_size;
+} aoc_cache_key_t;
+
+uint64_t aoc_hash64 (const void * p_data, size_t size, uint64_t seed);
+uint8_t  aoc_cache_init (aoc_cache_t * p_cache, const char * p_dir);
+bool     aoc_cache_lookup (aoc_cache_t *       p_cache,
+                           aoc_cache_key_t *   p_key,
+                           const aoc_input_t * p_input,
+                           aoc_day_result_t *  p_result);
+uint8_t  aoc_cache_store (aoc_cache_t *            p_cache,
+                          const aoc_cache_key_t *  p_key,
+                          const aoc_day_result_t * p_result);
+void     aoc_cache_report (aoc_cache_t * p_cache);
+
+#endif /* AOC_CACHE_H */
+
+/** END OF FILE **/
\ No newline at end of file
@@ -0,0 +1,120 @@
+/**
+ * @file aoc_check.h
+ *
+ * @brief Randomized differential checking of the fast engines against the
+ * reference solvers of the Advent of Code 2025 challenges.
+ *
+ * A challenge describes a case as an array of fixed-size items (rotations,
+ * ranges, lines, cells) and supplies a generator, a check that runs every
+ * engine on a case and compares it with the reference, a per-item
+ * simplification, optionally a merge of neighboring items, and a printer
+ * giving the case as puzzle input. The driver runs seeded cases and shrinks
+ * the first failing one to a minimal input.
+ *
+ * @author Mexeck88
+ *
+ * @date 18OCT26
+ */
+
+#ifndef AOC_CHECK_H
+#define AOC_CHECK_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "aoc_day.h"
+#include "aoc_gen.h"
+
+/**
+ * @enum aoc_check_info_t
+ * @brief Checker constants
+ */
+typedef enum aoc_check_info_t
+{
+    AOC_CHECK_CASES   = 5000,   // Cases run when -n is not given
+    AOC_CHECK_SHRINKS = 100000, // Most checks spent shrinking one failure
+    AOC_CHECK_WHY     = 256,    // Longest mismatch description
+    AOC_CHECK_PATH    = 64,     // Room for a /proc/self/fd path
+} aoc_check_info_t;
+
+/**
+ * @struct aoc_check_case_t
+ * @brief One input: count items of the challenge's item size
+ */
+typedef struct aoc_check_case_t
+{
+    void * p_items;
+    size_t count;
+    size_t capacity; // Most items, the challenge's max_items
+} aoc_check_case_t;
+
+/**
+ * @brief Fills an empty case with random items, at most its capacity
+ */
+typedef void (*aoc_check_gen_fn_t)(aoc_rng_t *        p_rng,
+                                   aoc_check_case_t * p_case);
+
+/**
+ * @brief Runs every engine on a case; returns false and describes the first
+ * disagreement with the reference in p_why when one differs
+ */
+typedef bool (*aoc_check_fn_t)(const aoc_check_case_t * p_case,
+                               char *                   p_why,
+                               size_t                   why_size);
+
+/**
+ * @brief Makes one item simpler in its step-th way, leaving it as it is when
+ * that way does not apply; returns false once step is past the last way
+ */
+typedef bool (*aoc_check_simplify_fn_t)(void * p_item, size_t step);
+
+/**
+ * @brief Folds the item after p_item into it, so the case can lose an item
+ * whose effect the others depend on; returns false if the two do not fold
+ */
+typedef bool (*aoc_check_merge_fn_t)(void * p_item, const void * p_next);
+
+/**
+ * @brief Writes a case as puzzle input
+ */
+typedef void (*aoc_check_print_fn_t)(const aoc_check_case_t * p_case,
+                                     FILE *                   p_out);
+
+/**
+ * @struct aoc_check_t
+ * @brief What a challenge's checker provides
+ */
+typedef struct aoc_check_t
+{
+    const char *            p_name;
+    size_t                  item_size;
+    size_t                  max_items;
+    aoc_check_gen_fn_t      p_generate;
+    aoc_check_fn_t          p_check;
+    aoc_check_simplify_fn_t p_simplify;
+    aoc_check_merge_fn_t    p_merge; // NULL if items never fold
+    aoc_check_print_fn_t    p_print;
+} aoc_check_t;
+
+int  aoc_check_main (const aoc_check_t * p_check, int argc, char ** argv);
+bool aoc_check_equal (const char * p_engine,
+                      const char * p_what,
+                      int64_t      got,
+                      int64_t      want,
+                      char *       p_why,
+                      size_t       why_size);
+bool aoc_check_result (const char *             p_engine,
+                       const aoc_day_result_t * p_got,
+                       const aoc_day_result_t * p_want,
+                       char *                   p_why,
+                       size_t                   why_size);
+int  aoc_check_text (const aoc_check_t *      p_check,
+                     const aoc_check_case_t * p_case,
+                     char *                   p_path,
+                     size_t                   path_size);
+
+#endif /* AOC_CHECK_H */
+
+/** END OF FILE **/
\ No newline at end of file
@@ -0,0 +1,55 @@
+/**
+ * @file aoc_cpu.h
+ *
+ * @brief CPU feature detection and kernel dispatch for the Advent of Code
+ * 2025 challenges.
+ *
+ * A challenge keeps one variant of a hot kernel per level, the vector ones
+ * compiled with AOC_CPU_TARGET_* so that a single binary runs anywhere, and
+ * picks its entry with aoc_cpu_level once at startup. The features are read
+ * with cpuid (through the compiler's __builtin_cpu_supports, which also
+ * checks that the OS saves the wider registers) the first time they are
+ * asked for. Setting AOC_SIMD to a level name forces that variant, for
+ * benchmarking and for checking the variants against each other; a level
+ * the CPU lacks falls back to the best one it has.
+ *
+ * @author Mexeck88
+ *
+ * @date 18OCT26
+ */
+
+#ifndef AOC_CPU_H
+#define AOC_CPU_H
+
+/**
+ * @enum aoc_cpu_level_t
+ * @brief Kernel variants, each level implying the ones below it
+ */
+typedef enum aoc_cpu_level_t
+{
+    AOC_CPU_SCALAR = 0, // Plain C
+    AOC_CPU_SSE42,      // SSE4.2 and POPCNT, 16-byte vectors
+    AOC_CPU_AVX2,       // AVX2 and POPCNT, 32-byte vectors
+    AOC_CPU_AVX512,     // AVX-512 F, BW and DQ, 64-byte vectors and masks
+    AOC_CPU_LEVELS,     // Entries in a table of variants
+} aoc_cpu_level_t;
+
+#define AOC_CPU_ENV "AOC_SIMD" // Forces a level by name
+
+// Vector variants are only built for x86; elsewhere every entry is scalar
+#if defined(__x86_64__) || defined(__i386__)
+#define AOC_CPU_X86           1
+#define AOC_CPU_TARGET_SSE42  __attribute__((target("sse4.2,popcnt")))
+#define AOC_CPU_TARGET_AVX2   __attribute__((target("avx2,popcnt")))
+#define AOC_CPU_TARGET_AVX512 __attribute__((target("avx512f,avx512bw,avx512dq,avx512vl,popcnt")))
+#else
+#define AOC_CPU_X86 0
+#endif
+
+aoc_cpu_level_t aoc_cpu_detect (void);
+aoc_cpu_level_t aoc_cpu_level (void);
+const char *    aoc_cpu_name (aoc_cpu_level_t level);
+
+#endif /* AOC_CPU_H */
+
+/** END OF FILE **/
\ No newline at end of file
@@ -0,0 +1,51 @@
+/**
+ * @file aoc_day.h
+ *
+ * @brief Entry point every Advent of Code 2025 challenge exposes to the
+ * unified runner.
+ *
+ * @author Mexeck88
+ *
+ * @date 18OCT26
+ */
+
+#ifndef AOC_DAY_H
+#define AOC_DAY_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+struct aoc_cache_t;
+
+/**
+ * @struct aoc_day_result_t
+ * @brief Answers of one challenge
+ */
+typedef struct aoc_day_result_t
+{
+    int64_t part1;
+    int64_t part2;
+    bool    b_cached; // Answers came from the result cache
+} aoc_day_result_t;
+
+/**
+ * @brief Solves both parts of one challenge
+ *
+ * Loads, parses and solves the input, then releases everything it built.
+ * Prints nothing on success and keeps no global state, so several days can
+ * run at once on different threads. With a cache, answers already known for
+ * the same input are returned without parsing or solving.
+ *
+ * @param p_file_path Input file, "-" for stdin
+ * @param p_cache Result cache, NULL to bypass it
+ * @param p_result Receives the answers
+ *
+ * @return AOC_SUCCESS (0) on success, anything else on failure
+ */
+typedef uint8_t (*aoc_day_fn_t)(const char *         p_file_path,
+                                struct aoc_cache_t * p_cache,
+                                aoc_day_result_t *   p_result);
+
+#endif /* AOC_DAY_H */
+
+/** END OF FILE **/
\ No newline at end of file
@@ -0,0 +1,101 @@
+/**
+ * @file aoc_gen.h
+ *
+ * @brief Seeded random numbers and streaming output for the Advent of Code
+ * 2025 input generators.
+ *
+ * @author Mexeck88
+ *
+ * @date 18OCT26
+ */
+
+#ifndef AOC_GEN_H
+#define AOC_GEN_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @enum aoc_gen_info_t
+ * @brief Generator constants
+ */
+typedef enum aoc_gen_info_t
+{
+    AOC_GEN_BUFFER     = 1 << 20, // Output is written in blocks of this size
+    AOC_GEN_UNIT_SCALE = 1024,    // K, M, G and T size suffixes
+    AOC_GEN_SEED       = 2025,    // Seed when -S is not given
+    AOC_GEN_DIGITS     = 20,      // Decimal digits in UINT64_MAX
+} aoc_gen_info_t;
+
+/**
+ * @enum aoc_gen_opt_t
+ * @brief Outcome of aoc_gen_option
+ */
+typedef enum aoc_gen_opt_t
+{
+    AOC_GEN_OPT_USED,  // A shared option, stored
+    AOC_GEN_OPT_OTHER, // Not a shared option, the generator handles it
+    AOC_GEN_OPT_BAD,   // A shared option with an invalid value
+} aoc_gen_opt_t;
+
+/**
+ * @brief getopt string of the options every generator shares
+ */
+#define AOC_GEN_OPTIONS "n:s:S:o:"
+
+/**
+ * @struct aoc_rng_t
+ * @brief xoshiro256** state; the same seed always gives the same stream
+ */
+typedef struct aoc_rng_t
+{
+    uint64_t state[4];
+} aoc_rng_t;
+
+/**
+ * @struct aoc_writer_t
+ * @brief Buffered writer to a file or stdout, for outputs of any size
+ */
+typedef struct aoc_writer_t
+{
+    char *   p_buffer;
+    size_t   used;    // Bytes waiting in p_buffer
+    int      fd;
+    uint64_t written; // Bytes accepted so far, buffered ones included
+} aoc_writer_t;
+
+/**
+ * @struct aoc_gen_args_t
+ * @brief Options every generator shares; -n and -s override each other
+ */
+typedef struct aoc_gen_args_t
+{
+    uint64_t     count; // Records to write (-n), 0 when going by size
+    uint64_t     size;  // Bytes to write at least (-s), 0 when going by count
+    uint64_t     seed;  // -S
+    const char * p_out; // -o, "-" for stdout
+} aoc_gen_args_t;
+
+void     aoc_rng_seed (aoc_rng_t * p_rng, uint64_t seed);
+uint64_t aoc_rng_next (aoc_rng_t * p_rng);
+uint64_t aoc_rng_below (aoc_rng_t * p_rng, uint64_t bound);
+double   aoc_rng_unit (aoc_rng_t * p_rng);
+uint8_t  aoc_writer_open (aoc_writer_t * p_writer, const char * p_path);
+uint8_t  aoc_writer_put (aoc_writer_t * p_writer,
+                         const char *   p_data,
+                         size_t         length);
+uint8_t  aoc_writer_number (aoc_writer_t * p_writer, uint64_t value);
+uint8_t  aoc_writer_close (aoc_writer_t * p_writer);
+bool     aoc_gen_parse_size (const char * p_text, uint64_t * p_size);
+void     aoc_gen_args_init (aoc_gen_args_t * p_args, uint64_t count);
+uint8_t  aoc_gen_option (aoc_gen_args_t * p_args,
+                         int              option,
+                         const char *     p_value);
+bool     aoc_gen_more (const aoc_gen_args_t * p_args,
+                       const aoc_writer_t *   p_writer,
+                       uint64_t               records);
+
+#endif /* AOC_GEN_H */
+
+/** END OF FILE **/
\ No newline at end of file
@@ -0,0 +1,75 @@
+/**
+ * @file aoc_input.h
+ *
+ * @brief Shared zero-copy input reader for the Advent of Code 2025 challenges.
+ *
+ * @author Mexeck88
+ *
+ * @date 18OCT26
+ */
+
+#ifndef AOC_INPUT_H
+#define AOC_INPUT_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @enum aoc_retcode_t
+ * @brief Return code constants for the common library
+ */
+typedef enum aoc_retcode_t
+{
+    AOC_SUCCESS = 0,
+    AOC_FAILURE = 1,
+} aoc_retcode_t;
+
+/**
+ * @enum aoc_input_info_t
+ * @brief Input reader constants
+ */
+typedef enum aoc_input_info_t
+{
+    AOC_SEQUENTIAL_MIN = 1 << 20, // Mapped files from this size get
+                                  // MADV_SEQUENTIAL
+    AOC_READ_CHUNK     = 1 << 16, // First buffer size for read() fallback
+    AOC_READ_SCALE     = 2,       // read() buffer growth factor
+} aoc_input_info_t;
+
+/**
+ * @struct aoc_view_t
+ * @brief A slice of the input; not NUL-terminated
+ */
+typedef struct aoc_view_t
+{
+    const char * p_data;
+    size_t       length;
+} aoc_view_t;
+
+/**
+ * @struct aoc_input_t
+ * @brief Whole input, mapped read-only or read into a buffer
+ *
+ * Views handed out by the reader point into p_data and stay valid until
+ * aoc_input_close.
+ */
+typedef struct aoc_input_t
+{
+    const char * p_data;
+    size_t       size;
+    size_t       pos;      // Read cursor for lines and tokens
+    bool         b_mapped; // p_data is an mmap of the file
+} aoc_input_t;
+
+uint8_t aoc_input_open (const char * p_file_path, aoc_input_t * p_input);
+void    aoc_input_close (aoc_input_t * p_input);
+bool    aoc_input_next_line (aoc_input_t * p_input, aoc_view_t * p_line);
+bool    aoc_input_next_token (aoc_input_t * p_input,
+                              const char *  p_delims,
+                              aoc_view_t *  p_token);
+bool    aoc_view_parse_long (aoc_view_t view, long * p_value);
+
+#endif /* AOC_INPUT_H */
+
+/** END OF FILE **/
\ No newline at end of file
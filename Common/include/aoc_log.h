@@ -0,0 +1,104 @@
+/**
+ * @file aoc_log.h
+ *
+ * @brief Compile-time levelled logging for the Advent of Code 2025
+ * challenges, written out by a background thread.
+ *
+ * @author Mexeck88
+ *
+ * @date 18OCT26
+ */
+
+#ifndef AOC_LOG_H
+#define AOC_LOG_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * Levels, usable in #if. Calls above AOC_LOG_LEVEL compile to nothing and
+ * their arguments are never evaluated. Release builds keep warnings and
+ * errors; -DDEBUG builds keep everything. Either can be overridden with
+ * -DAOC_LOG_LEVEL=AOC_LOG_LEVEL_...
+ */
+#define AOC_LOG_LEVEL_NONE  0
+#define AOC_LOG_LEVEL_ERROR 1
+#define AOC_LOG_LEVEL_WARN  2
+#define AOC_LOG_LEVEL_INFO  3
+#define AOC_LOG_LEVEL_DEBUG 4
+#define AOC_LOG_LEVEL_TRACE 5
+
+#ifndef AOC_LOG_LEVEL
+#ifdef DEBUG
+#define AOC_LOG_LEVEL AOC_LOG_LEVEL_TRACE
+#else
+#define AOC_LOG_LEVEL AOC_LOG_LEVEL_WARN
+#endif
+#endif
+
+/**
+ * @enum aoc_log_info_t
+ * @brief Logger constants
+ */
+typedef enum aoc_log_info_t
+{
+    AOC_LOG_ARGS       = 4,       // Integer arguments a record can carry
+    AOC_LOG_RING       = 1 << 14, // Records in flight, a power of two
+    AOC_LOG_IDLE       = 1000000, // Writer sleep in ns when the ring is empty
+    AOC_LOG_NS_PER_SEC = 1000000000,
+} aoc_log_info_t;
+
+/*
+ * A record is a format string literal and 1 to AOC_LOG_ARGS integer
+ * arguments, each converted to long, so formats use %ld, %lx and the like.
+ * The newline is added by the writer. Formatting and I/O happen on the
+ * writer thread; the caller only fills a ring slot and never blocks. When
+ * the ring is full the record is dropped and counted instead.
+ */
+#define AOC_LOG_AT(level, p_fmt, ...)          \
+    aoc_log_record((level),                    \
+                   (p_fmt),                    \
+                   (const long[AOC_LOG_ARGS]) { __VA_ARGS__ })
+
+#if AOC_LOG_LEVEL >= AOC_LOG_LEVEL_ERROR
+#define AOC_LOG_ERROR(p_fmt, ...) \
+    AOC_LOG_AT(AOC_LOG_LEVEL_ERROR, p_fmt, __VA_ARGS__)
+#else
+#define AOC_LOG_ERROR(p_fmt, ...) ((void)0)
+#endif
+
+#if AOC_LOG_LEVEL >= AOC_LOG_LEVEL_WARN
+#define AOC_LOG_WARN(p_fmt, ...) \
+    AOC_LOG_AT(AOC_LOG_LEVEL_WARN, p_fmt, __VA_ARGS__)
+#else
+#define AOC_LOG_WARN(p_fmt, ...) ((void)0)
+#endif
+
+#if AOC_LOG_LEVEL >= AOC_LOG_LEVEL_INFO
+#define AOC_LOG_INFO(p_fmt, ...) \
+    AOC_LOG_AT(AOC_LOG_LEVEL_INFO, p_fmt, __VA_ARGS__)
+#else
+#define AOC_LOG_INFO(p_fmt, ...) ((void)0)
+#endif
+
+#if AOC_LOG_LEVEL >= AOC_LOG_LEVEL_DEBUG
+#define AOC_LOG_DEBUG(p_fmt, ...) \
+    AOC_LOG_AT(AOC_LOG_LEVEL_DEBUG, p_fmt, __VA_ARGS__)
+#else
+#define AOC_LOG_DEBUG(p_fmt, ...) ((void)0)
+#endif
+
+#if AOC_LOG_LEVEL >= AOC_LOG_LEVEL_TRACE
+#define AOC_LOG_TRACE(p_fmt, ...) \
+    AOC_LOG_AT(AOC_LOG_LEVEL_TRACE, p_fmt, __VA_ARGS__)
+#else
+#define AOC_LOG_TRACE(p_fmt, ...) ((void)0)
+#endif
+
+void     aoc_log_record (int level, const char * p_fmt, const long * p_args);
+void     aoc_log_flush (void);
+uint64_t aoc_log_dropped (void);
+
+#endif /* AOC_LOG_H */
+
+/** END OF FILE **/
\ No newline at end of file
@@ -0,0 +1,64 @@
+/**
+ * @file aoc_perf.h
+ *
+ * @brief Hardware and software performance counters for the Advent of Code
+ * 2025 challenges, on top of Linux perf_event_open.
+ *
+ * @author Mexeck88
+ *
+ * @date 18OCT26
+ */
+
+#ifndef AOC_PERF_H
+#define AOC_PERF_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @enum aoc_perf_counter_t
+ * @brief Counters recorded around every phase
+ */
+typedef enum aoc_perf_counter_t
+{
+    AOC_PERF_CYCLES,
+    AOC_PERF_INSTRUCTIONS,
+    AOC_PERF_CACHE_MISSES,
+    AOC_PERF_BRANCH_MISSES,
+    AOC_PERF_PAGE_FAULTS,
+    AOC_PERF_COUNT,
+} aoc_perf_counter_t;
+
+/**
+ * @struct aoc_perf_t
+ * @brief Open counters; each one is opened on its own so a missing counter
+ * does not take the others down with it
+ */
+typedef struct aoc_perf_t
+{
+    int    fd[AOC_PERF_COUNT]; // -1 when the counter is unavailable
+    size_t open_count;
+} aoc_perf_t;
+
+/**
+ * @struct aoc_perf_sample_t
+ * @brief Counter totals, scaled up when the kernel multiplexed a counter
+ */
+typedef struct aoc_perf_sample_t
+{
+    uint64_t value[AOC_PERF_COUNT];
+} aoc_perf_sample_t;
+
+bool aoc_perf_open (aoc_perf_t * p_perf);
+void aoc_perf_start (const aoc_perf_t * p_perf);
+void aoc_perf_stop (const aoc_perf_t * p_perf, aoc_perf_sample_t * p_total);
+void aoc_perf_close (aoc_perf_t * p_perf);
+void aoc_perf_print (const aoc_perf_t *        p_perf,
+                     const aoc_perf_sample_t * p_total,
+                     size_t                    runs,
+                     size_t                    bytes);
+
+#endif /* AOC_PERF_H */
+
+/** END OF FILE **/
\ No newline at end of file
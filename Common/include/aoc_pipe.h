@@ -0,0 +1,124 @@
+/**
+ * @file aoc_pipe.h
+ *
+ * @brief Three-stage reader / parser / solver pipeline for the Advent of
+ * Code 2025 challenges.
+ *
+ * @author Mexeck88
+ *
+ * @date 18OCT26
+ */
+
+#ifndef AOC_PIPE_H
+#define AOC_PIPE_H
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "aoc_input.h"
+
+/**
+ * @enum aoc_pipe_info_t
+ * @brief Pipeline constants
+ */
+typedef enum aoc_pipe_info_t
+{
+    AOC_PIPE_CHUNK      = 1 << 16, // Bytes per read() buffer
+    AOC_PIPE_CHUNKS     = 8,       // Read buffers shared by reader and parser
+    AOC_PIPE_BATCH      = 1 << 14, // First size of a record batch in bytes
+    AOC_PIPE_BATCHES    = 8,       // Batches shared by parser and solver
+    AOC_PIPE_QUEUE      = 16,      // Ring slots, power of two > either pool
+    AOC_PIPE_SPIN       = 64,      // Yields before a blocked stage naps
+    AOC_PIPE_NAP        = 50000,   // Nap of a blocked stage in nanoseconds
+    AOC_PIPE_CACHE_LINE = 64,
+} aoc_pipe_info_t;
+
+/**
+ * @struct aoc_spsc_t
+ * @brief Bounded lock-free single-producer / single-consumer ring of
+ * pointers
+ *
+ * Each index is written by one side only and sits on its own cache line.
+ */
+typedef struct aoc_spsc_t
+{
+    _Alignas(AOC_PIPE_CACHE_LINE) atomic_size_t head; // Next slot to pop
+    _Alignas(AOC_PIPE_CACHE_LINE) atomic_size_t tail; // Next slot to push
+    _Alignas(AOC_PIPE_CACHE_LINE) void * p_slots[AOC_PIPE_QUEUE];
+} aoc_spsc_t;
+
+/**
+ * @struct aoc_pipe_batch_t
+ * @brief Packed records handed from the parser to the solver
+ *
+ * Records are stored back to back in the order they were emitted, without
+ * padding, so a challenge with one record type can read p_data as an array.
+ */
+typedef struct aoc_pipe_batch_t
+{
+    uint8_t * p_data;
+    size_t    used;     // Bytes of records
+    size_t    count;    // Records
+    size_t    capacity; // Bytes allocated
+} aoc_pipe_batch_t;
+
+struct aoc_pipe_state_t;
+
+/**
+ * @struct aoc_pipe_out_t
+ * @brief Where the parser callback emits its records
+ */
+typedef struct aoc_pipe_out_t
+{
+    struct aoc_pipe_state_t * p_state;
+    aoc_pipe_batch_t *        p_batch; // Batch being filled
+} aoc_pipe_out_t;
+
+/**
+ * @brief Turns one token of the input into records, on the parser thread
+ *
+ * @param p_ctx Challenge state
+ * @param token Token between two delimiters, never empty
+ * @param p_out Records go out through aoc_pipe_emit
+ *
+ * @return AOC_SUCCESS (0) on success, anything else stops the pipeline
+ */
+typedef uint8_t (*aoc_pipe_parse_fn_t)(void *           p_ctx,
+                                       aoc_view_t       token,
+                                       aoc_pipe_out_t * p_out);
+
+/**
+ * @brief Consumes one batch of records, on the calling thread
+ *
+ * @param p_ctx Challenge state
+ * @param p_batch Records in input order; invalid once the callback returns
+ *
+ * @return AOC_SUCCESS (0) on success, anything else stops the pipeline
+ */
+typedef uint8_t (*aoc_pipe_solve_fn_t)(void *                   p_ctx,
+                                       const aoc_pipe_batch_t * p_batch);
+
+/**
+ * @struct aoc_pipe_t
+ * @brief What a challenge hands to the pipeline
+ */
+typedef struct aoc_pipe_t
+{
+    const char *        p_file_path; // Input file, "-" for stdin
+    const char *        p_delims;    // Token separators, empty tokens skipped
+    aoc_pipe_parse_fn_t p_parse;
+    aoc_pipe_solve_fn_t p_solve;
+    void *              p_ctx;       // Given to both callbacks
+} aoc_pipe_t;
+
+void    aoc_spsc_init (aoc_spsc_t * p_queue);
+bool    aoc_spsc_push (aoc_spsc_t * p_queue, void * p_item);
+bool    aoc_spsc_pop (aoc_spsc_t * p_queue, void ** pp_item);
+void *  aoc_pipe_emit (aoc_pipe_out_t * p_out, size_t size);
+uint8_t aoc_pipe_run (const aoc_pipe_t * p_pipe);
+
+#endif /* AOC_PIPE_H */
+
+/** END OF FILE **/
\ No newline at end of file
@@ -0,0 +1,160 @@
+/**
+ * @file aoc_pool.h
+ *
+ * @brief Work-stealing thread pool with parallel-for and reductions for the
+ * Advent of Code 2025 challenges.
+ *
+ * @author Mexeck88
+ *
+ * @date 18OCT26
+ */
+
+#ifndef AOC_POOL_H
+#define AOC_POOL_H
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @enum aoc_pool_info_t
+ * @brief Pool constants
+ */
+typedef enum aoc_pool_info_t
+{
+    AOC_POOL_DEQUE      = 256,  // Tasks per worker deque, power of two
+    AOC_POOL_CHUNKS     = 8,    // Automatic grain: chunks per worker
+    AOC_POOL_SPIN       = 64,   // Empty steal rounds before a worker sleeps
+    AOC_POOL_MAX        = 256,  // Most workers in one pool
+    AOC_POOL_CACHE_LINE = 64,
+} aoc_pool_info_t;
+
+#define AOC_POOL_ENV "AOC_THREADS" // Size of the shared pool
+
+/**
+ * @brief Body of a parallel-for, run on chunks of the index range
+ *
+ * @param p_ctx Caller's state
+ * @param begin First index of the chunk
+ * @param end One past the last index of the chunk
+ * @param worker Index of the running worker, below aoc_pool_size
+ */
+typedef void (*aoc_pool_for_fn_t)(void * p_ctx,
+                                  size_t begin,
+                                  size_t end,
+                                  int    worker);
+
+/**
+ * @brief Body of a reduction: reduces one chunk of the index range
+ *
+ * @return The chunk's value
+ */
+typedef int64_t (*aoc_pool_map_fn_t)(void * p_ctx, size_t begin, size_t end);
+
+/**
+ * @brief Associative operator merging two partial results
+ */
+typedef int64_t (*aoc_pool_combine_fn_t)(int64_t left, int64_t right);
+
+struct aoc_pool_t;
+
+/**
+ * @struct aoc_pool_job_t
+ * @brief One parallel-for call
+ */
+typedef struct aoc_pool_job_t
+{
+    aoc_pool_for_fn_t       p_fn;
+    void *                  p_ctx;
+    size_t                  begin;     // Whole index range
+    size_t                  end;
+    size_t                  grain;     // Largest chunk run without a split
+    atomic_size_t           remaining; // Indices not run yet
+    bool                    b_done;    // Guarded by the pool lock
+    struct aoc_pool_job_t * p_next;    // Submission queue link
+} aoc_pool_job_t;
+
+/**
+ * @struct aoc_pool_task_t
+ * @brief Part of a job's index range
+ */
+typedef struct aoc_pool_task_t
+{
+    aoc_pool_job_t * p_job;
+    size_t           begin;
+    size_t           end;
+} aoc_pool_task_t;
+
+/**
+ * @struct aoc_pool_deque_t
+ * @brief Chase-Lev deque: the owner pushes and takes at the bottom, thieves
+ * steal from the top
+ */
+typedef struct aoc_pool_deque_t
+{
+    _Alignas(AOC_POOL_CACHE_LINE) atomic_long top;    // Next task to steal
+    _Alignas(AOC_POOL_CACHE_LINE) atomic_long bottom; // Next free slot
+    aoc_pool_task_t tasks[AOC_POOL_DEQUE];
+} aoc_pool_deque_t;
+
+/**
+ * @struct aoc_pool_worker_t
+ * @brief One pool thread, its deque and its counters
+ */
+typedef struct aoc_pool_worker_t
+{
+    aoc_pool_deque_t    deque;
+    struct aoc_pool_t * p_pool;
+    int                 index;
+    uint64_t            seed;   // Victim selection
+    atomic_ulong        chunks; // Body calls
+    atomic_ulong        steals; // Tasks taken from other deques
+    pthread_t           thread;
+} aoc_pool_worker_t;
+
+/**
+ * @struct aoc_pool_t
+ * @brief Fixed set of workers serving parallel-for calls from any thread
+ */
+typedef struct aoc_pool_t
+{
+    aoc_pool_worker_t * p_workers;
+    int                 worker_count;
+    pthread_mutex_t     lock;
+    pthread_cond_t      wake;     // New work for sleeping workers
+    pthread_cond_t      done;     // A job finished
+    aoc_pool_job_t *    p_head;   // Jobs no worker has picked up yet
+    aoc_pool_job_t *    p_tail;
+    atomic_int          queued;   // Jobs in the submission queue
+    atomic_int          sleepers; // Workers waiting on wake
+    atomic_bool         b_stop;
+} aoc_pool_t;
+
+uint8_t      aoc_pool_create (aoc_pool_t * p_pool, int worker_count);
+void         aoc_pool_destroy (aoc_pool_t * p_pool);
+aoc_pool_t * aoc_pool_shared (void);
+int          aoc_pool_size (const aoc_pool_t * p_pool);
+void         aoc_pool_for (aoc_pool_t *      p_pool,
+                           size_t            begin,
+                           size_t            end,
+                           size_t            grain,
+                           aoc_pool_for_fn_t p_fn,
+                           void *            p_ctx);
+int64_t      aoc_pool_reduce (aoc_pool_t *          p_pool,
+                              size_t                begin,
+                              size_t                end,
+                              size_t                grain,
+                              aoc_pool_map_fn_t     p_map,
+                              aoc_pool_combine_fn_t p_combine,
+                              int64_t               identity,
+                              void *                p_ctx);
+int64_t      aoc_pool_add (int64_t left, int64_t right);
+void         aoc_pool_counters (aoc_pool_t * p_pool,
+                                uint64_t *   p_chunks,
+                                uint64_t *   p_steals);
+
+#endif /* AOC_POOL_H */
+
+/** END OF FILE **/
\ No newline at end of file
@@ -0,0 +1,82 @@
+/**
+ * @file aoc_snap.h
+ *
+ * @brief Binary snapshots of parsed inputs for the Advent of Code 2025
+ * challenges.
+ *
+ * A snapshot is a fixed 64-byte header followed by a day's parsed input in
+ * the layout its solvers use, so loading one is a map and a check rather
+ * than a parse. Each day converts its text with -s and recognizes a
+ * snapshot given in place of the text by its magic. Payloads are written in
+ * the machine's byte order; a file from the other order fails the version
+ * check.
+ *
+ * @author Mexeck88
+ *
+ * @date 18OCT26
+ */
+
+#ifndef AOC_SNAP_H
+#define AOC_SNAP_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "aoc_input.h"
+
+/**
+ * @enum aoc_snap_info_t
+ * @brief Snapshot constants
+ */
+typedef enum aoc_snap_info_t
+{
+    AOC_SNAP_VERSION    = 1,    // Header or payload layout, bumped on change
+    AOC_SNAP_MAGIC_SIZE = 8,    // Bytes of AOC_SNAP_MAGIC, NUL included
+    AOC_SNAP_PATH       = 4096, // Longest snapshot path
+} aoc_snap_info_t;
+
+#define AOC_SNAP_MAGIC "AOCSNAP"
+
+/**
+ * @struct aoc_snap_header_t
+ * @brief First 64 bytes of a snapshot; the payload follows, 8-byte aligned
+ */
+typedef struct aoc_snap_header_t
+{
+    char     magic[AOC_SNAP_MAGIC_SIZE];
+    uint32_t version;
+    uint32_t day;
+    uint64_t count;        // Records: rotations, ranges, lines or grid rows
+    uint64_t width;        // Grid columns for day 4, else 0
+    uint64_t payload_size; // Bytes after the header
+    uint64_t checksum;     // aoc_hash64 of the payload
+    uint64_t reserved[2];  // 0
+} aoc_snap_header_t;
+
+/**
+ * @struct aoc_snap_t
+ * @brief A checked snapshot, pointing into the input it was found in
+ */
+typedef struct aoc_snap_t
+{
+    uint64_t        count;
+    uint64_t        width;
+    const uint8_t * p_payload;
+    size_t          size;
+} aoc_snap_t;
+
+bool    aoc_snap_detect (const aoc_input_t * p_input);
+uint8_t aoc_snap_open (const aoc_input_t * p_input,
+                       uint32_t            day,
+                       aoc_snap_t *        p_snap);
+uint8_t aoc_snap_write (const char * p_path,
+                        uint32_t     day,
+                        uint64_t     count,
+                        uint64_t     width,
+                        const void * p_payload,
+                        size_t       size);
+
+#endif /* AOC_SNAP_H */
+
+/** END OF FILE **/
\ No newline at end of file
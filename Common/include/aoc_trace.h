@@ -0,0 +1,83 @@
+/**
+ * @file aoc_trace.h
+ *
+ * @brief Scoped timeline spans for the Advent of Code 2025 challenges,
+ * exported as Chrome trace-event JSON.
+ *
+ * AOC_TRACE_SCOPE("name") times from where it stands to the end of the
+ * enclosing block. Spans go into a buffer owned by the running thread, so
+ * recording takes no lock, and the buffers are written out when the program
+ * exits, to AOC_TRACE_FILE or trace.json, for chrome://tracing or Perfetto.
+ * Unless the challenge is compiled with -DAOC_TRACE (the ChalN Makefiles'
+ * trace target), the macros expand to nothing and none of this is linked.
+ *
+ * A span must open before any goto of its block, since jumping into the
+ * scope of a span would skip its start.
+ *
+ * @author Mexeck88
+ *
+ * @date 18OCT26
+ */
+
+#ifndef AOC_TRACE_H
+#define AOC_TRACE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * @enum aoc_trace_info_t
+ * @brief Trace constants
+ */
+typedef enum aoc_trace_info_t
+{
+    AOC_TRACE_EVENTS = 32768, // Spans kept per thread, later ones are dropped
+} aoc_trace_info_t;
+
+#define AOC_TRACE_ENV     "AOC_TRACE_FILE" // Where the timeline is written
+#define AOC_TRACE_DEFAULT "trace.json"
+
+/**
+ * @struct aoc_trace_span_t
+ * @brief An open span, closed by aoc_trace_end
+ */
+typedef struct aoc_trace_span_t
+{
+    const char * p_name;   // String literal, kept until exit
+    int64_t      arg;      // Range, batch or round number
+    bool         b_arg;    // arg is shown
+    uint64_t     start_ns;
+} aoc_trace_span_t;
+
+aoc_trace_span_t aoc_trace_begin (const char * p_name, bool b_arg, int64_t arg);
+void             aoc_trace_end (aoc_trace_span_t * p_span);
+uint8_t          aoc_trace_write (const char * p_path);
+
+#ifdef AOC_TRACE
+#define AOC_TRACE_JOIN(left, right) left##right
+#define AOC_TRACE_NAME(line)        AOC_TRACE_JOIN(aoc_trace_span_, line)
+
+/**
+ * @brief Opens a span closed at the end of the enclosing block
+ */
+#define AOC_TRACE_SCOPE(p_name)                                       \
+    aoc_trace_span_t AOC_TRACE_NAME(__LINE__)                         \
+        __attribute__((cleanup(aoc_trace_end), unused))               \
+        = aoc_trace_begin((p_name), false, 0)
+
+/**
+ * @brief Opens a span showing a number, such as a round, closed at the end
+ * of the enclosing block
+ */
+#define AOC_TRACE_SCOPE_ARG(p_name, arg)                              \
+    aoc_trace_span_t AOC_TRACE_NAME(__LINE__)                         \
+        __attribute__((cleanup(aoc_trace_end), unused))               \
+        = aoc_trace_begin((p_name), true, (int64_t)(arg))
+#else
+#define AOC_TRACE_SCOPE(p_name)          ((void)0)
+#define AOC_TRACE_SCOPE_ARG(p_name, arg) ((void)sizeof(arg)) // Not evaluated
+#endif /* AOC_TRACE */
+
+#endif /* AOC_TRACE_H */
+
+/** END OF FILE **/
\ No newline at end of file
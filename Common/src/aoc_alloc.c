@@ -0,0 +1,156 @@
+/**
+ * @file aoc_alloc.c
+ *
+ * @brief Heap allocation counters for the Advent of Code 2025 challenges
+ *
+ * One set of process-wide counters, updated with relaxed atomics so that
+ * pool workers can allocate at the same time. Every allocation costs a few
+ * uncontended atomic adds on top of the C library's own work, so a profiled
+ * run keeps close to native speed at any input size. The benchmark harness
+ * marks the counters before each phase and reads them back after it.
+ *
+ * @author Mexeck88
+ *
+ * @date 18OCT26
+ */
+
+#include <stdatomic.h>
+
+#include "aoc_alloc.h"
+
+/**
+ * @struct aoc_alloc_counters_t
+ * @brief Shared counters behind aoc_alloc_stats_t
+ */
+typedef struct aoc_alloc_counters_t
+{
+    atomic_bool      b_attached; // The wrappers are linked in
+    _Atomic uint64_t allocs;
+    _Atomic uint64_t reallocs;
+    _Atomic uint64_t frees;
+    _Atomic uint64_t bytes;
+    _Atomic uint64_t live;
+    _Atomic uint64_t peak;
+} aoc_alloc_counters_t;
+
+static aoc_alloc_counters_t g_alloc;
+
+/**
+ * @brief Tells whether allocations are being counted
+ *
+ * @return true when the program was linked with the allocation wrappers
+ */
+bool
+aoc_alloc_enabled (void)
+{
+    return atomic_load_explicit(&g_alloc.b_attached, memory_order_relaxed);
+}
+
+/**
+ * @brief Called once by the wrappers, from a constructor, when linked in
+ */
+void
+aoc_alloc_attach (void)
+{
+    atomic_store_explicit(&g_alloc.b_attached, true, memory_order_relaxed);
+}
+
+/**
+ * @brief Counts one allocator call
+ *
+ * A block appearing is an alloc, a block going away is a free and a block
+ * changing size is a realloc. Calls that change nothing, such as free(NULL),
+ * are not counted.
+ *
+ * @param requested Bytes asked for, 0 for a free
+ * @param old_size Usable size of the block before the call, 0 if none
+ * @param new_size Usable size of the block after the call, 0 if none
+ */
+void
+aoc_alloc_count (size_t requested, size_t old_size, size_t new_size)
+{
+    uint64_t live = 0;
+    uint64_t peak = 0;
+
+    if ((0 == old_size) && (0 == new_size))
+    {
+        return;
+    }
+
+    if (0 == old_size)
+    {
+        atomic_fetch_add_explicit(&g_alloc.allocs, 1, memory_order_relaxed);
+    }
+    else if (0 == new_size)
+    {
+        atomic_fetch_add_explicit(&g_alloc.frees, 1, memory_order_relaxed);
+    }
+    else
+    {
+        atomic_fetch_add_explicit(&g_alloc.reallocs, 1, memory_order_relaxed);
+    }
+
+    atomic_fetch_add_explicit(&g_alloc.bytes, requested, memory_order_relaxed);
+
+    // Unsigned wrap-around makes a shrink a subtraction
+    live = atomic_fetch_add_explicit(&g_alloc.live,
+                                     (uint64_t)new_size - (uint64_t)old_size,
+                                     memory_order_relaxed)
+           + ((uint64_t)new_size - (uint64_t)old_size);
+
+    peak = atomic_load_explicit(&g_alloc.peak, memory_order_relaxed);
+    while ((live > peak)
+           && (false
+               == atomic_compare_exchange_weak_explicit(&g_alloc.peak,
+                                                        &peak,
+                                                        live,
+                                                        memory_order_relaxed,
+                                                        memory_order_relaxed)))
+    {
+        // peak was reloaded by the failed exchange
+    }
+}
+
+/**
+ * @brief Takes a snapshot of the counters and restarts the high-water mark
+ *
+ * From here on, peak is the most heap in use since this call.
+ *
+ * @param p_mark Receives the snapshot
+ */
+void
+aoc_alloc_mark (aoc_alloc_stats_t * p_mark)
+{
+    p_mark->allocs   = atomic_load_explicit(&g_alloc.allocs, memory_order_relaxed);
+    p_mark->reallocs = atomic_load_explicit(&g_alloc.reallocs, memory_order_relaxed);
+    p_mark->frees    = atomic_load_explicit(&g_alloc.frees, memory_order_relaxed);
+    p_mark->bytes    = atomic_load_explicit(&g_alloc.bytes, memory_order_relaxed);
+    p_mark->live     = atomic_load_explicit(&g_alloc.live, memory_order_relaxed);
+    p_mark->peak     = p_mark->live;
+    atomic_store_explicit(&g_alloc.peak, p_mark->live, memory_order_relaxed);
+}
+
+/**
+ * @brief Counts what happened since a mark
+ *
+ * @param p_mark Snapshot from aoc_alloc_mark
+ * @param p_delta Receives the calls and bytes since the mark, the heap in
+ * use now and the most heap in use since the mark
+ */
+void
+aoc_alloc_since (const aoc_alloc_stats_t * p_mark, aoc_alloc_stats_t * p_delta)
+{
+    p_delta->allocs = atomic_load_explicit(&g_alloc.allocs, memory_order_relaxed)
+                      - p_mark->allocs;
+    p_delta->reallocs
+        = atomic_load_explicit(&g_alloc.reallocs, memory_order_relaxed)
+          - p_mark->reallocs;
+    p_delta->frees = atomic_load_explicit(&g_alloc.frees, memory_order_relaxed)
+                     - p_mark->frees;
+    p_delta->bytes = atomic_load_explicit(&g_alloc.bytes, memory_order_relaxed)
+                     - p_mark->bytes;
+    p_delta->live = atomic_load_explicit(&g_alloc.live, memory_order_relaxed);
+    p_delta->peak = atomic_load_explicit(&g_alloc.peak, memory_order_relaxed);
+}
+
+/** END OF FILE **/
\ No newline at end of file
@@ -0,0 +1,144 @@
+/**
+ * @file aoc_alloc_wrap.c
+ *
+ * @brief Link-time malloc wrappers feeding aoc_alloc.c
+ *
+ * With -Wl,--wrap=malloc the linker sends every call to malloc in the
+ * program's own objects (this library included) to __wrap_malloc, and
+ * __real_malloc to the C library's malloc; likewise for the other wrapped
+ * functions. Nothing here is referenced otherwise, so an ordinary link
+ * never pulls this file out of libaoc.a. Allocations made inside the C
+ * library, such as those of fopen or pthread_create, are neither seen nor
+ * freed by the program and so do not unbalance the counts; getline is
+ * wrapped because its buffer is freed by the caller.
+ *
+ * @author Mexeck88
+ *
+ * @date 18OCT26
+ */
+
+#include <malloc.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/types.h>
+
+#include "aoc_alloc.h"
+
+void *  __real_malloc (size_t size);
+void *  __real_calloc (size_t count, size_t size);
+void *  __real_realloc (void * p_block, size_t size);
+void    __real_free (void * p_block);
+void *  __real_aligned_alloc (size_t alignment, size_t size);
+ssize_t __real_getline (char ** pp_line, size_t * p_cap, FILE * p_file);
+
+void *  __wrap_malloc (size_t size);
+void *  __wrap_calloc (size_t count, size_t size);
+void *  __wrap_realloc (void * p_block, size_t size);
+void    __wrap_free (void * p_block);
+void *  __wrap_aligned_alloc (size_t alignment, size_t size);
+ssize_t __wrap_getline (char ** pp_line, size_t * p_cap, FILE * p_file);
+
+/**
+ * @brief Usable size of a block, 0 for NULL
+ */
+static size_t
+aoc_alloc_size (void * p_block)
+{
+    return (NULL == p_block) ? 0 : malloc_usable_size(p_block);
+}
+
+/**
+ * @brief Reports that the wrappers are linked in, before main runs
+ */
+__attribute__((constructor)) static void
+aoc_alloc_wrap_init (void)
+{
+    aoc_alloc_attach();
+}
+
+/**
+ * @brief Counted malloc
+ */
+void *
+__wrap_malloc (size_t size)
+{
+    void * p_block = __real_malloc(size);
+
+    aoc_alloc_count(size, 0, aoc_alloc_size(p_block));
+    return p_block;
+}
+
+/**
+ * @brief Counted calloc
+ */
+void *
+__wrap_calloc (size_t count, size_t size)
+{
+    void * p_block = __real_calloc(count, size);
+
+    aoc_alloc_count(count * size, 0, aoc_alloc_size(p_block));
+    return p_block;
+}
+
+/**
+ * @brief Counted realloc
+ */
+void *
+__wrap_realloc (void * p_block, size_t size)
+{
+    size_t old_size = aoc_alloc_size(p_block);
+    void * p_new    = __real_realloc(p_block, size);
+
+    // A failed realloc leaves the old block in place
+    if ((NULL == p_new) && (0 != size))
+    {
+        return NULL;
+    }
+
+    aoc_alloc_count(size, old_size, aoc_alloc_size(p_new));
+    return p_new;
+}
+
+/**
+ * @brief Counted free
+ */
+void
+__wrap_free (void * p_block)
+{
+    aoc_alloc_count(0, aoc_alloc_size(p_block), 0);
+    __real_free(p_block);
+}
+
+/**
+ * @brief Counted aligned_alloc
+ */
+void *
+__wrap_aligned_alloc (size_t alignment, size_t size)
+{
+    void * p_block = __real_aligned_alloc(alignment, size);
+
+    aoc_alloc_count(size, 0, aoc_alloc_size(p_block));
+    return p_block;
+}
+
+/**
+ * @brief Counted getline, for the buffer it allocates or grows
+ */
+ssize_t
+__wrap_getline (char ** pp_line, size_t * p_cap, FILE * p_file)
+{
+    char *  p_old    = *pp_line;
+    size_t  old_size = aoc_alloc_size(p_old);
+    ssize_t len      = __real_getline(pp_line, p_cap, p_file);
+    size_t  new_size = aoc_alloc_size(*pp_line);
+
+    // Reading into a buffer that was already big enough allocates nothing
+    if ((*pp_line != p_old) || (new_size != old_size))
+    {
+        aoc_alloc_count(*p_cap, old_size, new_size);
+    }
+
+    return len;
+}
+
+/** END OF FILE **/
\ No newline at end of file
@@ -0,0 +1,326 @@
+/**
+ * @file aoc_arena.c
+ *
+ * @brief Bump allocator for the parsed data of the Advent of Code 2025
+ * challenges
+ *
+ * Allocations are carved out of a few large chunks and never freed on their
+ * own; the whole arena is reset or freed in one call once a phase is done.
+ * The most recent allocation can grow in place, which is what the growing
+ * arrays built by the loaders need.
+ *
+ * @author Mexeck88
+ *
+ * @date 18OCT26
+ */
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "aoc_arena.h"
+
+/**
+ * @brief Returns the first payload byte of a chunk
+ *
+ * @param p_chunk Chunk
+ *
+ * @return Payload address
+ */
+static uint8_t *
+aoc_arena_payload (aoc_arena_chunk_t * p_chunk)
+{
+    return (uint8_t *)(p_chunk + 1); // Payload follows the header
+}
+
+/**
+ * @brief Tries to bump the newest chunk
+ *
+ * @param p_arena Arena
+ * @param size Bytes needed
+ * @param align Power of two alignment
+ *
+ * @return The allocation, or NULL if the newest chunk is too full
+ */
+static void *
+aoc_arena_bump (aoc_arena_t * p_arena, size_t size, size_t align)
+{
+    aoc_arena_chunk_t * p_head = p_arena->p_head;
+    uintptr_t           base   = 0;
+    uintptr_t           start  = 0;
+    size_t              offset = 0;
+
+    if (NULL == p_head)
+    {
+        return NULL;
+    }
+
+    base   = (uintptr_t)aoc_arena_payload(p_head);
+    start  = (base + p_head->used + align - 1) & ~((uintptr_t)align - 1);
+    offset = (size_t)(start - base); // start >= base
+
+    if ((offset > p_head->capacity) || (size > (p_head->capacity - offset)))
+    {
+        return NULL;
+    }
+
+    p_arena->bytes_used += (offset + size) - p_head->used;
+    p_head->used = offset + size;
+    p_arena->alloc_count++;
+    p_arena->p_last = (void *)start;
+
+    return p_arena->p_last;
+}
+
+/**
+ * @brief Pushes a chunk big enough for one allocation of the given size
+ *
+ * @param p_arena Arena
+ * @param size Bytes needed
+ * @param align Power of two alignment
+ *
+ * @return true on success, false if the chunk could not be allocated
+ */
+static bool
+aoc_arena_push (aoc_arena_t * p_arena, size_t size, size_t align)
+{
+    aoc_arena_chunk_t * p_chunk  = NULL;
+    size_t              capacity = p_arena->chunk_size;
+
+    if ((size > (SIZE_MAX - align))
+        || ((size + align) > (SIZE_MAX - sizeof(aoc_arena_chunk_t))))
+    {
+        printf("ERROR: Arena allocation of %zu bytes is too large\n", size);
+        return false;
+    }
+
+    // Room for the worst-case alignment padding
+    if (capacity < (size + align))
+    {
+        capacity = size + align;
+    }
+
+    p_chunk = malloc(sizeof(aoc_arena_chunk_t) + capacity);
+    if (NULL == p_chunk)
+    {
+        perror("ERROR: Unable to allocate arena chunk");
+        return false;
+    }
+
+    p_chunk->p_next   = p_arena->p_head;
+    p_chunk->capacity = capacity;
+    p_chunk->used     = 0;
+    p_arena->p_head   = p_chunk;
+
+    p_arena->bytes_reserved += capacity;
+    p_arena->chunk_count++;
+
+    if (capacity <= (SIZE_MAX / AOC_ARENA_SCALE))
+    {
+        p_arena->chunk_size = capacity * AOC_ARENA_SCALE;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Prepares an empty arena; no memory is taken until the first
+ * allocation
+ *
+ * @param p_arena Arena to initialize
+ * @param chunk_size Payload size of the first chunk (0 for AOC_ARENA_CHUNK)
+ */
+void
+aoc_arena_init (aoc_arena_t * p_arena, size_t chunk_size)
+{
+    if (NULL == p_arena)
+    {
+        return;
+    }
+
+    memset(p_arena, 0, sizeof(*p_arena));
+    p_arena->chunk_size = (0 < chunk_size) ? chunk_size : AOC_ARENA_CHUNK;
+}
+
+/**
+ * @brief Allocates with the alignment of AOC_ARENA_ALIGN
+ *
+ * @param p_arena Arena
+ * @param size Bytes needed
+ *
+ * @return The allocation, or NULL on failure
+ */
+void *
+aoc_arena_alloc (aoc_arena_t * p_arena, size_t size)
+{
+    return aoc_arena_alloc_aligned(p_arena, size, AOC_ARENA_ALIGN);
+}
+
+/**
+ * @brief Allocates with a caller-chosen alignment
+ *
+ * @param p_arena Arena
+ * @param size Bytes needed
+ * @param align Power of two alignment
+ *
+ * @return The allocation, or NULL on failure
+ */
+void *
+aoc_arena_alloc_aligned (aoc_arena_t * p_arena, size_t size, size_t align)
+{
+    void * p_data = NULL;
+
+    if ((NULL == p_arena) || (0 == align) || (0 != (align & (align - 1))))
+    {
+        printf("ERROR: Bad arguments passed to arena_alloc\n");
+        return NULL;
+    }
+
+    p_data = aoc_arena_bump(p_arena, size, align);
+    if ((NULL == p_data) && (true == aoc_arena_push(p_arena, size, align)))
+    {
+        p_data = aoc_arena_bump(p_arena, size, align);
+    }
+
+    return p_data;
+}
+
+/**
+ * @brief Grows an allocation, in place when it is the most recent one
+ *
+ * Otherwise the data moves to a new allocation and the old bytes stay used
+ * until the arena is reset.
+ *
+ * @param p_arena Arena
+ * @param p_old Allocation to grow (NULL to allocate)
+ * @param old_size Current size of p_old
+ * @param new_size Size needed
+ * @param align Alignment p_old was allocated with
+ *
+ * @return The grown allocation, or NULL on failure (p_old is untouched)
+ */
+void *
+aoc_arena_grow (aoc_arena_t * p_arena,
+                void *        p_old,
+                size_t        old_size,
+                size_t        new_size,
+                size_t        align)
+{
+    aoc_arena_chunk_t * p_head = NULL;
+    void *              p_new  = NULL;
+    size_t              offset = 0;
+
+    if ((NULL == p_arena) || (NULL == p_old))
+    {
+        return aoc_arena_alloc_aligned(p_arena, new_size, align);
+    }
+
+    if (new_size <= old_size)
+    {
+        return p_old;
+    }
+
+    p_head = p_arena->p_head;
+    if ((p_old == p_arena->p_last) && (NULL != p_head))
+    {
+        offset = (size_t)((uint8_t *)p_old - aoc_arena_payload(p_head));
+        if (new_size <= (p_head->capacity - offset))
+        {
+            p_arena->bytes_used += (offset + new_size) - p_head->used;
+            p_head->used = offset + new_size;
+            return p_old;
+        }
+    }
+
+    p_new = aoc_arena_alloc_aligned(p_arena, new_size, align);
+    if (NULL != p_new)
+    {
+        memcpy(p_new, p_old, old_size);
+    }
+
+    return p_new;
+}
+
+/**
+ * @brief Drops every allocation, keeping only the newest (largest) chunk
+ *
+ * @param p_arena Arena to reset
+ */
+void
+aoc_arena_reset (aoc_arena_t * p_arena)
+{
+    aoc_arena_chunk_t * p_chunk = NULL;
+    aoc_arena_chunk_t * p_next  = NULL;
+
+    if ((NULL == p_arena) || (NULL == p_arena->p_head))
+    {
+        return;
+    }
+
+    p_chunk = p_arena->p_head->p_next;
+    while (NULL != p_chunk)
+    {
+        p_next = p_chunk->p_next;
+        free(p_chunk);
+        p_chunk = p_next;
+    }
+
+    p_arena->p_head->p_next = NULL;
+    p_arena->p_head->used   = 0;
+    p_arena->p_last         = NULL;
+    p_arena->bytes_used     = 0;
+    p_arena->bytes_reserved = p_arena->p_head->capacity;
+    p_arena->chunk_count    = 1;
+    p_arena->alloc_count    = 0;
+}
+
+/**
+ * @brief Releases every chunk; the arena must be initialized again to reuse
+ *
+ * @param p_arena Arena to release (safe to call on a zeroed one)
+ */
+void
+aoc_arena_free (aoc_arena_t * p_arena)
+{
+    aoc_arena_chunk_t * p_next = NULL;
+
+    if (NULL == p_arena)
+    {
+        return;
+    }
+
+    while (NULL != p_arena->p_head)
+    {
+        p_next = p_arena->p_head->p_next;
+        free(p_arena->p_head);
+        p_arena->p_head = p_next;
+    }
+
+    memset(p_arena, 0, sizeof(*p_arena));
+}
+
+/**
+ * @brief Prints the arena counters for one phase of a run
+ *
+ * @param p_arena Arena
+ * @param p_phase Name of the phase that just finished
+ */
+void
+aoc_arena_print (const aoc_arena_t * p_arena, const char * p_phase)
+{
+    if ((NULL == p_arena) || (NULL == p_phase))
+    {
+        return;
+    }
+
+    printf("Arena (%s): %zu bytes used of %zu reserved, %zu allocations in "
+           "%zu chunks\n",
+           p_phase,
+           p_arena->bytes_used,
+           p_arena->bytes_reserved,
+           p_arena->alloc_count,
+           p_arena->chunk_count);
+}
+
+/** END OF FILE **/
\ No newline at end of file
@@ -0,0 +1,650 @@
+/**
+ * @file aoc_bench.c
+ *
+ * @brief Phase-timed benchmark harness for the Advent of Code 2025
+ * challenges
+ *
+ * A challenge describes its run as phases (load, parse, part 1, part 2).
+ * The harness repeats the run, times every phase with the monotonic clock
+ * and prints min, median and p99 per phase as JSON on stdout, next to the
+ * mean hardware counters of the timed runs (see aoc_perf.c). The
+ * challenge's own output is sent to /dev/null while it runs, so the report
+ * stays parseable and terminal speed does not leak into the timings. When
+ * the program is linked with the allocation wrappers (see aoc_alloc.h),
+ * each phase also reports the heap calls and high-water mark of its last
+ * timed run.
+ *
+ * @author Mexeck88
+ *
+ * @date 18OCT26
+ */
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "aoc_alloc.h"
+#include "aoc_bench.h"
+#include "aoc_cpu.h"
+#include "aoc_input.h"
+#include "aoc_perf.h"
+
+/**
+ * @struct aoc_bench_stats_t
+ * @brief Summary of the timed samples of one phase
+ */
+typedef struct aoc_bench_stats_t
+{
+    uint64_t min_ns;
+    uint64_t median_ns;
+    uint64_t tail_ns; // AOC_BENCH_PERCENTILE
+    double   mean_ns;
+} aoc_bench_stats_t;
+
+/**
+ * @brief Parses the common command line:
+ * [-b [runs] | -p | -n | -s snapshot] [input_file]
+ *
+ * A number right after -b is the run count; any other argument is the input
+ * path, "-" meaning stdin. -p asks for the pipelined solve, -n for a solve
+ * that bypasses the result cache and -s for the parsed input to be written
+ * as a snapshot instead of solved. Benchmarks and pipelined solves never use
+ * the cache.
+ *
+ * @param argc Argument count
+ * @param argv Argument vector
+ * @param p_b_bench Set to true when -b is given
+ * @param p_runs Timed runs (AOC_BENCH_RUNS when no count is given)
+ * @param p_b_pipe Set to true when -p is given
+ * @param p_b_no_cache Set to true when -n is given
+ * @param pp_snap Snapshot path given with -s, NULL without it
+ * @param pp_path Input path, left untouched when none is given
+ *
+ * @return AOC_SUCCESS on success, AOC_FAILURE on a bad command line
+ */
+uint8_t
+aoc_bench_args (int           argc,
+                char **       argv,
+                bool *        p_b_bench,
+                size_t *      p_runs,
+                bool *        p_b_pipe,
+                bool *        p_b_no_cache,
+                const char ** pp_snap,
+                const char ** pp_path)
+{
+    uint8_t    retcode = AOC_FAILURE;
+    int        arg     = 1;
+    long       runs    = AOC_BENCH_RUNS;
+    aoc_view_t count   = { 0 };
+
+    if ((NULL == argv) || (NULL == p_b_bench) || (NULL == p_runs)
+        || (NULL == p_b_pipe) || (NULL == p_b_no_cache) || (NULL == pp_snap)
+        || (NULL == pp_path))
+    {
+        printf("ERROR: NULL pointer passed to bench_args\n");
+        goto EXIT;
+    }
+
+    *p_b_bench    = false;
+    *p_runs       = AOC_BENCH_RUNS;
+    *p_b_pipe     = false;
+    *p_b_no_cache = false;
+    *pp_snap      = NULL;
+
+    if ((arg < argc) && (0 == strcmp(argv[arg], "-p")))
+    {
+        *p_b_pipe = true;
+        arg++;
+    }
+    else if ((arg < argc) && (0 == strcmp(argv[arg], "-n")))
+    {
+        *p_b_no_cache = true;
+        arg++;
+    }
+    else if ((arg + 1 < argc) && (0 == strcmp(argv[arg], "-s")))
+    {
+        *pp_snap = argv[arg + 1];
+        arg += 2;
+    }
+    else if ((arg < argc) && (0 == strcmp(argv[arg], "-b")))
+    {
+        *p_b_bench = true;
+        arg++;
+
+        if ((arg < argc) && ('-' != argv[arg][0]))
+        {
+            count.p_data = argv[arg];
+            count.length = strlen(argv[arg]);
+            if (true == aoc_view_parse_long(count, &runs))
+            {
+                if (0 >= runs)
+                {
+                    printf("ERROR: Run count must be positive: %s\n",
+                           argv[arg]);
+                    goto EXIT;
+                }
+                arg++;
+            }
+        }
+    }
+
+    if ((arg < argc)
+        && ((0 == strcmp(argv[arg], "-")) || ('-' != argv[arg][0])))
+    {
+        *pp_path = argv[arg];
+        arg++;
+    }
+
+    if (arg < argc)
+    {
+        printf("Usage: %s [-b [runs] | -p | -n | -s snapshot] [input_file]\n",
+               argv[0]);
+        goto EXIT;
+    }
+
+    // Every run reloads the input, which a pipe cannot give twice
+    if ((true == *p_b_bench) && (NULL != *pp_path)
+        && (0 == strcmp(*pp_path, "-")))
+    {
+        printf("ERROR: -b needs an input file, not stdin\n");
+        goto EXIT;
+    }
+
+    *p_runs = (size_t)runs; // > 0
+    retcode = AOC_SUCCESS;
+EXIT:
+    return retcode;
+}
+
+/**
+ * @brief Reads the monotonic clock
+ *
+ * @return Nanoseconds since an arbitrary fixed point
+ */
+static uint64_t
+aoc_bench_now_ns (void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return ((uint64_t)now.tv_sec * AOC_BENCH_NS_PER_SEC) + (uint64_t)now.tv_nsec;
+}
+
+/**
+ * @brief qsort comparator for nanosecond samples
+ */
+static int
+aoc_bench_compare (const void * p_left, const void * p_right)
+{
+    uint64_t left  = *(const uint64_t *)p_left;
+    uint64_t right = *(const uint64_t *)p_right;
+
+    return (left > right) - (left < right);
+}
+
+/**
+ * @brief Sorts the samples of one phase and summarizes them
+ *
+ * @param p_samples Samples, sorted in place
+ * @param count Number of samples (> 0)
+ *
+ * @return Min, median, tail percentile (nearest rank) and mean
+ */
+static aoc_bench_stats_t
+aoc_bench_summarize (uint64_t * p_samples, size_t count)
+{
+    aoc_bench_stats_t stats = { 0 };
+    size_t            rank  = 0;
+    double            sum   = 0.0;
+
+    qsort(p_samples, count, sizeof(uint64_t), aoc_bench_compare);
+
+    for (size_t idx = 0; idx < count; idx++)
+    {
+        sum += (double)p_samples[idx];
+    }
+
+    // Nearest rank: the smallest sample at or above the percentile
+    rank = ((count * AOC_BENCH_PERCENTILE) + 99) / 100; // 1 - count
+
+    stats.min_ns    = p_samples[0];
+    stats.median_ns = (0 == (count % 2))
+                          ? (p_samples[(count / 2) - 1] + p_samples[count / 2])
+                                / 2
+                          : p_samples[count / 2];
+    stats.tail_ns   = p_samples[rank - 1];
+    stats.mean_ns   = sum / (double)count;
+
+    return stats;
+}
+
+/**
+ * @brief Prints a string as a JSON string literal
+ *
+ * @param p_text Text to quote
+ */
+static void
+aoc_bench_print_string (const char * p_text)
+{
+    putchar('"');
+    for (; '\0' != *p_text; p_text++)
+    {
+        if (('"' == *p_text) || ('\\' == *p_text))
+        {
+            printf("\\%c", *p_text);
+        }
+        else if ((unsigned char)*p_text < ' ')
+        {
+            printf("\\u%04x", (unsigned char)*p_text);
+        }
+        else
+        {
+            putchar(*p_text);
+        }
+    }
+    putchar('"');
+}
+
+/**
+ * @brief Prints the heap use of one phase, null without the wrappers
+ *
+ * @param p_alloc Allocation counts of the phase
+ * @param lines Input size in lines
+ */
+static void
+aoc_bench_print_alloc (const aoc_alloc_stats_t * p_alloc, size_t lines)
+{
+    printf(", \"alloc\": ");
+    if (false == aoc_alloc_enabled())
+    {
+        printf("null");
+        return;
+    }
+
+    printf("{\"allocs\": %llu, \"reallocs\": %llu, \"frees\": %llu, "
+           "\"bytes\": %llu, \"live_bytes\": %llu, \"peak_bytes\": %llu, "
+           "\"allocs_per_line\": %.3f}",
+           (unsigned long long)p_alloc->allocs,
+           (unsigned long long)p_alloc->reallocs,
+           (unsigned long long)p_alloc->frees,
+           (unsigned long long)p_alloc->bytes,
+           (unsigned long long)p_alloc->live,
+           (unsigned long long)p_alloc->peak,
+           (0 < lines) ? ((double)p_alloc->allocs / (double)lines) : 0.0);
+}
+
+/**
+ * @brief Adds one phase's heap use to the run total
+ *
+ * Calls and bytes add up; the heap in use is the later phase's and the
+ * high-water mark is the larger one.
+ *
+ * @param p_total Run total
+ * @param p_phase Phase to add, in phase order
+ */
+static void
+aoc_bench_add_alloc (aoc_alloc_stats_t * p_total, const aoc_alloc_stats_t * p_phase)
+{
+    p_total->allocs += p_phase->allocs;
+    p_total->reallocs += p_phase->reallocs;
+    p_total->frees += p_phase->frees;
+    p_total->bytes += p_phase->bytes;
+    p_total->live = p_phase->live;
+    p_total->peak = (p_phase->peak > p_total->peak) ? p_phase->peak : p_total->peak;
+}
+
+/**
+ * @brief Prints the JSON object for one phase
+ *
+ * Throughput is measured against the median run.
+ *
+ * @param p_name Phase name
+ * @param p_stats Phase summary
+ * @param bytes Input size in bytes
+ * @param lines Input size in lines
+ * @param p_perf Counters the totals came from
+ * @param p_counts Counter totals over the timed runs
+ * @param runs Timed runs
+ * @param p_alloc Heap use of the last timed run
+ */
+static void
+aoc_bench_print_phase (const char *              p_name,
+                       const aoc_bench_stats_t * p_stats,
+                       size_t                    bytes,
+                       size_t                    lines,
+                       const aoc_perf_t *        p_perf,
+                       const aoc_perf_sample_t * p_counts,
+                       size_t                    runs,
+                       const aoc_alloc_stats_t * p_alloc)
+{
+    double seconds = (0 < p_stats->median_ns)
+                         ? (double)p_stats->median_ns / AOC_BENCH_NS_PER_SEC
+                         : 1.0 / AOC_BENCH_NS_PER_SEC; // Below clock resolution
+
+    printf("{\"name\": ");
+    aoc_bench_print_string(p_name);
+    printf(", \"min_ns\": %llu, \"median_ns\": %llu, \"p%d_ns\": %llu, "
+           "\"mean_ns\": %.1f, \"bytes_per_sec\": %.1f, "
+           "\"lines_per_sec\": %.1f, \"counters\": ",
+           (unsigned long long)p_stats->min_ns,
+           (unsigned long long)p_stats->median_ns,
+           AOC_BENCH_PERCENTILE,
+           (unsigned long long)p_stats->tail_ns,
+           p_stats->mean_ns,
+           (double)bytes / seconds,
+           (double)lines / seconds);
+    aoc_perf_print(p_perf, p_counts, runs, bytes);
+    aoc_bench_print_alloc(p_alloc, lines);
+    printf("}");
+}
+
+/**
+ * @brief Measures the input the throughput figures are based on
+ *
+ * @param p_file_path Input file
+ * @param p_bytes Receives the size in bytes
+ * @param p_lines Receives the number of lines (a last line without a newline
+ * counts)
+ *
+ * @return AOC_SUCCESS on success, AOC_FAILURE on failure
+ */
+static uint8_t
+aoc_bench_measure_input (const char * p_file_path,
+                         size_t *     p_bytes,
+                         size_t *     p_lines)
+{
+    aoc_input_t input = { 0 };
+    aoc_view_t  line  = { 0 };
+
+    if (AOC_SUCCESS != aoc_input_open(p_file_path, &input))
+    {
+        return AOC_FAILURE;
+    }
+
+    *p_bytes = input.size;
+    *p_lines = 0;
+    while (true == aoc_input_next_line(&input, &line))
+    {
+        (*p_lines)++;
+    }
+
+    aoc_input_close(&input);
+    return AOC_SUCCESS;
+}
+
+/**
+ * @brief Runs every phase once, recording the phase times when asked to
+ *
+ * The counters start before and stop after the clock reads, so their
+ * ioctl() calls stay out of the timings.
+ *
+ * @param p_bench Benchmark description
+ * @param p_perf Open counters
+ * @param p_times Receives one time per phase, NULL for a warmup run
+ * @param p_counts Counter totals per phase, added to on timed runs
+ * @param p_allocs Heap use per phase, overwritten on timed runs
+ *
+ * @return Index of the failed phase, or phase_count when all succeeded
+ */
+static size_t
+aoc_bench_run_once (const aoc_bench_t * p_bench,
+                    const aoc_perf_t *  p_perf,
+                    uint64_t *          p_times,
+                    aoc_perf_sample_t * p_counts,
+                    aoc_alloc_stats_t * p_allocs)
+{
+    size_t            phase = 0;
+    uint64_t          start = 0;
+    uint8_t           rc    = AOC_SUCCESS;
+    aoc_alloc_stats_t mark;
+
+    for (phase = 0; phase < p_bench->phase_count; phase++)
+    {
+        if (NULL != p_times)
+        {
+            aoc_alloc_mark(&mark);
+            aoc_perf_start(p_perf);
+        }
+
+        start = aoc_bench_now_ns();
+        rc    = p_bench->p_phases[phase].p_run(p_bench->p_ctx);
+        if (NULL != p_times)
+        {
+            p_times[phase] = aoc_bench_now_ns() - start;
+            aoc_perf_stop(p_perf, &p_counts[phase]);
+            aoc_alloc_since(&mark, &p_allocs[phase]);
+        }
+
+        if (AOC_SUCCESS != rc)
+        {
+            break;
+        }
+    }
+
+    (void)p_bench->p_reset(p_bench->p_ctx);
+    return phase;
+}
+
+/**
+ * @brief Runs the warmup and the timed runs with stdout sent to /dev/null
+ *
+ * @param p_bench Benchmark description
+ * @param p_perf Open counters
+ * @param p_samples Receives runs x phase_count times, run-major
+ * @param p_counts Receives the counter totals of every phase
+ * @param p_allocs Receives the heap use of every phase
+ *
+ * @return AOC_SUCCESS on success, AOC_FAILURE on failure
+ */
+static uint8_t
+aoc_bench_collect (const aoc_bench_t * p_bench,
+                   const aoc_perf_t *  p_perf,
+                   uint64_t *          p_samples,
+                   aoc_perf_sample_t * p_counts,
+                   aoc_alloc_stats_t * p_allocs)
+{
+    uint8_t retcode  = AOC_FAILURE;
+    int     saved_fd = -1;
+    int     null_fd  = -1;
+    size_t  failed   = p_bench->phase_count;
+    size_t  run      = 0;
+
+    fflush(stdout);
+    saved_fd = dup(STDOUT_FILENO);
+    null_fd  = open("/dev/null", O_WRONLY);
+    if ((0 > saved_fd) || (0 > null_fd)
+        || (0 > dup2(null_fd, STDOUT_FILENO)))
+    {
+        perror("ERROR: Unable to silence stdout for the benchmark");
+        goto CLEAN;
+    }
+
+    for (run = 0; run < p_bench->warmup + p_bench->runs; run++)
+    {
+        failed = aoc_bench_run_once(
+            p_bench,
+            p_perf,
+            (run < p_bench->warmup)
+                ? NULL
+                : &p_samples[(run - p_bench->warmup) * p_bench->phase_count],
+            p_counts,
+            p_allocs);
+
+        if (p_bench->phase_count != failed)
+        {
+            break;
+        }
+    }
+
+    fflush(stdout);
+    dup2(saved_fd, STDOUT_FILENO);
+
+    if (p_bench->phase_count != failed)
+    {
+        fprintf(stderr,
+                "ERROR: Phase %s failed on run %zu\n",
+                p_bench->p_phases[failed].p_name,
+                run + 1);
+        goto CLEAN;
+    }
+
+    retcode = AOC_SUCCESS;
+CLEAN:
+    if (0 <= null_fd)
+    {
+        close(null_fd);
+    }
+
+    if (0 <= saved_fd)
+    {
+        close(saved_fd);
+    }
+
+    return retcode;
+}
+
+/**
+ * @brief Benchmarks a challenge and prints the JSON report on stdout
+ *
+ * @param p_bench Benchmark description
+ *
+ * @return AOC_SUCCESS on success, AOC_FAILURE on failure
+ */
+uint8_t
+aoc_bench_run (const aoc_bench_t * p_bench)
+{
+    uint8_t             retcode   = AOC_FAILURE;
+    uint64_t *          p_samples = NULL;
+    uint64_t *          p_column  = NULL;
+    aoc_perf_sample_t * p_counts  = NULL;
+    aoc_alloc_stats_t * p_allocs  = NULL;
+    aoc_perf_t          perf;
+    size_t              phases    = 0;
+    size_t              runs      = 0;
+    size_t              bytes     = 0;
+    size_t              lines     = 0;
+    aoc_bench_stats_t   stats;
+
+    if ((NULL == p_bench) || (NULL == p_bench->p_phases)
+        || (NULL == p_bench->p_reset) || (0 == p_bench->phase_count)
+        || (0 == p_bench->runs))
+    {
+        printf("ERROR: Bad benchmark passed to bench_run\n");
+        goto EXIT;
+    }
+
+    phases = p_bench->phase_count;
+    runs   = p_bench->runs;
+
+    if (AOC_SUCCESS
+        != aoc_bench_measure_input(p_bench->p_file_path, &bytes, &lines))
+    {
+        goto EXIT;
+    }
+
+    // Run-major samples, a column per phase and one for the run total
+    if (runs > (SIZE_MAX / sizeof(uint64_t) / (phases + 2)))
+    {
+        printf("ERROR: Too many benchmark runs: %zu\n", runs);
+        goto EXIT;
+    }
+
+    p_samples = calloc(runs * (phases + 2), sizeof(uint64_t));
+    if (NULL == p_samples)
+    {
+        perror("ERROR: Unable to allocate memory for benchmark samples");
+        goto EXIT;
+    }
+    p_column = p_samples + (runs * phases);
+
+    if (false == aoc_perf_open(&perf))
+    {
+        fprintf(stderr, "NOTE: No performance counters, timing only\n");
+    }
+
+    // One counter total per phase, then the run total
+    p_counts = calloc(phases + 1, sizeof(aoc_perf_sample_t));
+    if (NULL == p_counts)
+    {
+        perror("ERROR: Unable to allocate memory for benchmark counters");
+        goto CLEAN;
+    }
+
+    // Heap use per phase, then the run total
+    p_allocs = calloc(phases + 1, sizeof(aoc_alloc_stats_t));
+    if (NULL == p_allocs)
+    {
+        perror("ERROR: Unable to allocate memory for benchmark heap use");
+        goto CLEAN;
+    }
+
+    if (AOC_SUCCESS
+        != aoc_bench_collect(p_bench, &perf, p_samples, p_counts, p_allocs))
+    {
+        goto CLEAN;
+    }
+
+    printf("{\n  \"challenge\": ");
+    aoc_bench_print_string(p_bench->p_name);
+    printf(",\n  \"input\": ");
+    aoc_bench_print_string(p_bench->p_file_path);
+    printf(",\n  \"bytes\": %zu,\n  \"lines\": %zu,\n", bytes, lines);
+    printf("  \"runs\": %zu,\n  \"warmup\": %zu,\n", runs, p_bench->warmup);
+    printf("  \"clock\": \"CLOCK_MONOTONIC\",\n  \"simd\": ");
+    aoc_bench_print_string(aoc_cpu_name(aoc_cpu_level()));
+    printf(",\n  \"phases\": [\n");
+
+    for (size_t phase = 0; phase < phases; phase++)
+    {
+        for (size_t run = 0; run < runs; run++)
+        {
+            p_column[run] = p_samples[(run * phases) + phase];
+            p_column[runs + run] += p_column[run]; // Run total
+        }
+
+        for (size_t counter = 0; counter < AOC_PERF_COUNT; counter++)
+        {
+            p_counts[phases].value[counter] += p_counts[phase].value[counter];
+        }
+
+        aoc_bench_add_alloc(&p_allocs[phases], &p_allocs[phase]);
+
+        stats = aoc_bench_summarize(p_column, runs);
+        printf("    ");
+        aoc_bench_print_phase(p_bench->p_phases[phase].p_name,
+                              &stats,
+                              bytes,
+                              lines,
+                              &perf,
+                              &p_counts[phase],
+                              runs,
+                              &p_allocs[phase]);
+        printf("%s\n", (phase + 1 < phases) ? "," : "");
+    }
+
+    stats = aoc_bench_summarize(p_column + runs, runs);
+    printf("  ],\n  \"total\": ");
+    aoc_bench_print_phase("total",
+                          &stats,
+                          bytes,
+                          lines,
+                          &perf,
+                          &p_counts[phases],
+                          runs,
+                          &p_allocs[phases]);
+    printf("\n}\n");
+
+    retcode = AOC_SUCCESS;
+CLEAN:
+    aoc_perf_close(&perf);
+    free(p_allocs);
+    free(p_counts);
+    free(p_samples);
+EXIT:
+    return retcode;
+}
+
+/** END OF FILE **/
\ No newline at end of file
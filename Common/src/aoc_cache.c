@@ -0,0 +1,478 @@
+/**
+ * @file aoc_cache.c
+ *
+ * @brief Content-addressed on-disk cache of challenge answers
+ *
+ * An answer is keyed by the day, the solver version, the options that change
+ * it and a 64-bit hash of the whole input. Each entry is a small text file
+ * named after a hash of that key; the file repeats the full key, so a name
+ * collision reads as a miss instead of a wrong answer. Entries are written to
+ * a temporary file and renamed into place, so a reader never sees half an
+ * entry, even with several processes sharing the directory.
+ *
+ * The input hash is XXH64: four independent multiply-rotate lanes over
+ * 8-byte words, fast enough to stay well below the cost of parsing.
+ *
+ * @author Mexeck88
+ *
+ * @date 18OCT26
+ */
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "aoc_cache.h"
+
+static const uint64_t g_prime1 = 0x9E3779B185EBCA87ULL;
+static const uint64_t g_prime2 = 0xC2B2AE3D27D4EB4FULL;
+static const uint64_t g_prime3 = 0x165667B19E3779F9ULL;
+static const uint64_t g_prime4 = 0x85EBCA77C2B2AE63ULL;
+static const uint64_t g_prime5 = 0x27D4EB2F165667C5ULL;
+
+/**
+ * @brief Rotates a 64-bit value left
+ */
+static inline uint64_t
+aoc_hash_rotl (uint64_t value, int bits)
+{
+    return (value << bits) | (value >> (64 - bits));
+}
+
+/**
+ * @brief Reads an unaligned little-endian 64-bit word
+ */
+static inline uint64_t
+aoc_hash_read64 (const uint8_t * p_bytes)
+{
+    uint64_t value = 0;
+
+    memcpy(&value, p_bytes, sizeof(value));
+    return value;
+}
+
+/**
+ * @brief Reads an unaligned little-endian 32-bit word
+ */
+static inline uint32_t
+aoc_hash_read32 (const uint8_t * p_bytes)
+{
+    uint32_t value = 0;
+
+    memcpy(&value, p_bytes, sizeof(value));
+    return value;
+}
+
+/**
+ * @brief Mixes one word into a lane
+ */
+static inline uint64_t
+aoc_hash_round (uint64_t lane, uint64_t word)
+{
+    lane += word * g_prime2;
+    lane = aoc_hash_rotl(lane, 31);
+    return lane * g_prime1;
+}
+
+/**
+ * @brief Folds a finished lane into the hash
+ */
+static inline uint64_t
+aoc_hash_merge (uint64_t hash, uint64_t lane)
+{
+    hash ^= aoc_hash_round(0, lane);
+    return (hash * g_prime1) + g_prime4;
+}
+
+/**
+ * @brief Hashes a block of bytes (XXH64)
+ *
+ * @param p_data Bytes to hash, may be NULL when size is 0
+ * @param size Number of bytes
+ * @param seed Starting value, to chain hashes
+ *
+ * @return 64-bit hash
+ */
+uint64_t
+aoc_hash64 (const void * p_data, size_t size, uint64_t seed)
+{
+    const uint8_t * p_bytes = p_data;
+    const uint8_t * p_end   = p_bytes + size;
+    uint64_t        hash    = 0;
+    uint64_t        lanes[4];
+
+    if (32 <= size)
+    {
+        lanes[0] = seed + g_prime1 + g_prime2;
+        lanes[1] = seed + g_prime2;
+        lanes[2] = seed;
+        lanes[3] = seed - g_prime1;
+
+        // Four independent lanes keep the multipliers busy
+        for (; (size_t)(p_end - p_bytes) >= 32; p_bytes += 32)
+        {
+            lanes[0] = aoc_hash_round(lanes[0], aoc_hash_read64(p_bytes));
+            lanes[1] = aoc_hash_round(lanes[1], aoc_hash_read64(p_bytes + 8));
+            lanes[2] = aoc_hash_round(lanes[2], aoc_hash_read64(p_bytes + 16));
+            lanes[3] = aoc_hash_round(lanes[3], aoc_hash_read64(p_bytes + 24));
+        }
+
+        hash = aoc_hash_rotl(lanes[0], 1) + aoc_hash_rotl(lanes[1], 7)
+               + aoc_hash_rotl(lanes[2], 12) + aoc_hash_rotl(lanes[3], 18);
+        for (int lane = 0; lane < 4; lane++)
+        {
+            hash = aoc_hash_merge(hash, lanes[lane]);
+        }
+    }
+    else
+    {
+        hash = seed + g_prime5;
+    }
+
+    hash += (uint64_t)size;
+
+    for (; (size_t)(p_end - p_bytes) >= 8; p_bytes += 8)
+    {
+        hash ^= aoc_hash_round(0, aoc_hash_read64(p_bytes));
+        hash = (aoc_hash_rotl(hash, 27) * g_prime1) + g_prime4;
+    }
+
+    if ((size_t)(p_end - p_bytes) >= 4)
+    {
+        hash ^= (uint64_t)aoc_hash_read32(p_bytes) * g_prime1;
+        hash = (aoc_hash_rotl(hash, 23) * g_prime2) + g_prime3;
+        p_bytes += 4;
+    }
+
+    for (; p_bytes < p_end; p_bytes++)
+    {
+        hash ^= (uint64_t)*p_bytes * g_prime5;
+        hash = aoc_hash_rotl(hash, 11) * g_prime1;
+    }
+
+    // Avalanche
+    hash ^= hash >> 33;
+    hash *= g_prime2;
+    hash ^= hash >> 29;
+    hash *= g_prime3;
+    hash ^= hash >> 32;
+
+    return hash;
+}
+
+/**
+ * @brief Picks the cache directory and clears the counters
+ *
+ * @param p_cache Cache to initialize
+ * @param p_dir Directory, NULL for $AOC_CACHE_DIR, else ~/.cache/aoc2025,
+ * else ./.aoc_cache
+ *
+ * @return AOC_SUCCESS on success, AOC_FAILURE if the path is too long
+ */
+uint8_t
+aoc_cache_init (aoc_cache_t * p_cache, const char * p_dir)
+{
+    uint8_t      retcode = AOC_FAILURE;
+    const char * p_home  = getenv("HOME");
+    int          length  = 0;
+
+    if (NULL == p_cache)
+    {
+        printf("ERROR: NULL pointer passed to cache_init\n");
+        goto EXIT;
+    }
+
+    atomic_init(&p_cache->hits, 0);
+    atomic_init(&p_cache->misses, 0);
+
+    if (NULL == p_dir)
+    {
+        p_dir = getenv(AOC_CACHE_ENV);
+    }
+
+    if ((NULL != p_dir) && ('\0' != p_dir[0]))
+    {
+        length = snprintf(p_cache->dir, AOC_CACHE_PATH, "%s", p_dir);
+    }
+    else if ((NULL != p_home) && ('\0' != p_home[0]))
+    {
+        length = snprintf(
+            p_cache->dir, AOC_CACHE_PATH, "%s/%s", p_home, AOC_CACHE_HOME);
+    }
+    else
+    {
+        length = snprintf(p_cache->dir, AOC_CACHE_PATH, "%s", AOC_CACHE_DEFAULT);
+    }
+
+    if ((0 >= length) || (AOC_CACHE_PATH <= length))
+    {
+        printf("ERROR: Cache directory path is too long\n");
+        goto EXIT;
+    }
+
+    retcode = AOC_SUCCESS;
+EXIT:
+    return retcode;
+}
+
+/**
+ * @brief Builds the path of a key's entry
+ *
+ * @param p_cache Cache holding the directory
+ * @param p_key Filled key
+ * @param p_path Receives the path, AOC_CACHE_PATH bytes
+ *
+ * @return true on success, false if the path is too long
+ */
+static bool
+aoc_cache_path (const aoc_cache_t *     p_cache,
+                const aoc_cache_key_t * p_key,
+                char *                  p_path)
+{
+    uint64_t name   = aoc_hash64(p_key->p_version,
+                               strlen(p_key->p_version),
+                               p_key->input_hash ^ (uint64_t)p_key->input_size);
+    int      length = 0;
+
+    name   = aoc_hash64(p_key->p_params, strlen(p_key->p_params), name);
+    length = snprintf(p_path,
+                      AOC_CACHE_PATH,
+                      "%s/day%02d-%016llx",
+                      p_cache->dir,
+                      p_key->day,
+                      (unsigned long long)name);
+
+    return (0 < length) && (AOC_CACHE_PATH > length);
+}
+
+/**
+ * @brief Writes the key lines every entry starts with
+ *
+ * @param p_key Filled key
+ * @param p_text Receives the lines
+ * @param size Bytes available in p_text
+ *
+ * @return Length written, 0 if it did not fit
+ */
+static size_t
+aoc_cache_header (const aoc_cache_key_t * p_key, char * p_text, size_t size)
+{
+    int length = snprintf(p_text,
+                          size,
+                          "aoc-cache %d\nday %d\nversion %s\nparams %s\n"
+                          "input %016llx %zu\n",
+                          AOC_CACHE_FORMAT,
+                          p_key->day,
+                          p_key->p_version,
+                          p_key->p_params,
+                          (unsigned long long)p_key->input_hash,
+                          p_key->input_size);
+
+    return ((0 < length) && ((size_t)length < size)) ? (size_t)length : 0;
+}
+
+/**
+ * @brief Hashes the input and looks its answers up
+ *
+ * Counts a hit or a miss. Without a cache nothing is hashed or counted.
+ *
+ * @param p_cache Cache to search, NULL to bypass it
+ * @param p_key Day, version and parameters set by the caller; the input hash
+ * and size are filled in for aoc_cache_store
+ * @param p_input Whole open input
+ * @param p_result Receives the answers on a hit
+ *
+ * @return true on a hit, false otherwise
+ */
+bool
+aoc_cache_lookup (aoc_cache_t *       p_cache,
+                  aoc_cache_key_t *   p_key,
+                  const aoc_input_t * p_input,
+                  aoc_day_result_t *  p_result)
+{
+    bool      b_hit                  = false;
+    FILE *    p_file                 = NULL;
+    size_t    length                 = 0;
+    size_t    header                 = 0;
+    long long part1                  = 0;
+    long long part2                  = 0;
+    char      path[AOC_CACHE_PATH]   = { 0 };
+    char      entry[AOC_CACHE_ENTRY] = { 0 };
+    char      key[AOC_CACHE_ENTRY]   = { 0 };
+
+    if ((NULL == p_cache) || (NULL == p_key) || (NULL == p_input)
+        || (NULL == p_result))
+    {
+        return false;
+    }
+
+    p_key->input_hash = aoc_hash64(p_input->p_data, p_input->size, 0);
+    p_key->input_size = p_input->size;
+
+    if (false == aoc_cache_path(p_cache, p_key, path))
+    {
+        goto EXIT;
+    }
+
+    p_file = fopen(path, "r");
+    if (NULL == p_file)
+    {
+        goto EXIT; // Not cached yet
+    }
+
+    length = fread(entry, 1, sizeof(entry) - 1, p_file);
+    fclose(p_file);
+    entry[length] = '\0';
+
+    // Same name, different key: treat as a miss
+    header = aoc_cache_header(p_key, key, sizeof(key));
+    if ((0 == header) || (0 != strncmp(entry, key, header))
+        || (2 != sscanf(&entry[header], "part1 %lld\npart2 %lld", &part1, &part2)))
+    {
+        goto EXIT;
+    }
+
+    p_result->part1    = part1;
+    p_result->part2    = part2;
+    p_result->b_cached = true;
+    b_hit              = true;
+
+EXIT:
+    atomic_fetch_add((true == b_hit) ? &p_cache->hits : &p_cache->misses, 1);
+    return b_hit;
+}
+
+/**
+ * @brief Creates a directory and any missing parents
+ *
+ * @param p_dir Directory path
+ *
+ * @return AOC_SUCCESS on success, AOC_FAILURE on failure
+ */
+static uint8_t
+aoc_cache_mkdirs (const char * p_dir)
+{
+    char   path[AOC_CACHE_PATH] = { 0 };
+    size_t length               = strlen(p_dir); // < AOC_CACHE_PATH
+    char   saved                = '\0';
+
+    memcpy(path, p_dir, length + 1);
+
+    for (size_t idx = 1; idx <= length; idx++)
+    {
+        if (('/' == path[idx]) || ('\0' == path[idx]))
+        {
+            saved     = path[idx];
+            path[idx] = '\0';
+            if ((0 != mkdir(path, 0755)) && (EEXIST != errno))
+            {
+                return AOC_FAILURE;
+            }
+            path[idx] = saved;
+        }
+    }
+
+    return AOC_SUCCESS;
+}
+
+/**
+ * @brief Saves the answers of a key looked up with aoc_cache_lookup
+ *
+ * A cache that cannot be written only warns: the answers are still good.
+ *
+ * @param p_cache Cache to write, NULL to bypass it
+ * @param p_key Key filled by aoc_cache_lookup
+ * @param p_result Answers to save
+ *
+ * @return AOC_SUCCESS on success or bypass, AOC_FAILURE if nothing was saved
+ */
+uint8_t
+aoc_cache_store (aoc_cache_t *            p_cache,
+                 const aoc_cache_key_t *  p_key,
+                 const aoc_day_result_t * p_result)
+{
+    uint8_t retcode                   = AOC_FAILURE;
+    FILE *  p_file                    = NULL;
+    int     length                    = 0;
+    char    path[AOC_CACHE_PATH]      = { 0 };
+    char    temp_path[AOC_CACHE_PATH] = { 0 };
+    char    header[AOC_CACHE_ENTRY]   = { 0 };
+
+    if (NULL == p_cache)
+    {
+        return AOC_SUCCESS;
+    }
+
+    if ((NULL == p_key) || (NULL == p_result))
+    {
+        printf("ERROR: NULL pointer passed to cache_store\n");
+        goto EXIT;
+    }
+
+    length = snprintf(temp_path,
+                      AOC_CACHE_PATH,
+                      "%s/.tmp-%ld-%d",
+                      p_cache->dir,
+                      (long)getpid(),
+                      p_key->day);
+    if ((false == aoc_cache_path(p_cache, p_key, path)) || (0 >= length)
+        || (AOC_CACHE_PATH <= length)
+        || (0 == aoc_cache_header(p_key, header, sizeof(header)))
+        || (AOC_SUCCESS != aoc_cache_mkdirs(p_cache->dir)))
+    {
+        goto WARN;
+    }
+
+    p_file = fopen(temp_path, "w");
+    if (NULL == p_file)
+    {
+        goto WARN;
+    }
+
+    length = fprintf(p_file,
+                     "%spart1 %lld\npart2 %lld\n",
+                     header,
+                     (long long)p_result->part1,
+                     (long long)p_result->part2);
+
+    // fclose flushes, so it can fail too
+    if ((0 != fclose(p_file)) || (0 > length) || (0 != rename(temp_path, path)))
+    {
+        unlink(temp_path);
+        goto WARN;
+    }
+
+    retcode = AOC_SUCCESS;
+    goto EXIT;
+
+WARN:
+    printf("WARNING: Unable to save answers in cache %s: %s\n",
+           p_cache->dir,
+           strerror(errno));
+EXIT:
+    return retcode;
+}
+
+/**
+ * @brief Prints the hits and misses of a cache
+ *
+ * @param p_cache Cache to report, NULL (bypassed) prints nothing
+ */
+void
+aoc_cache_report (aoc_cache_t * p_cache)
+{
+    if (NULL == p_cache)
+    {
+        return;
+    }
+
+    printf("Cache: %lu hit(s), %lu miss(es) in %s\n",
+           atomic_load(&p_cache->hits),
+           atomic_load(&p_cache->misses),
+           p_cache->dir);
+}
+
+/** END OF FILE **/
\ No newline at end of file
@@ -0,0 +1,585 @@
+/**
+ * @file aoc_check.c
+ *
+ * @brief Randomized differential checking driver for the Advent of Code 2025
+ * challenges
+ *
+ * Case i of a run is generated from seed + i, so any failure is reproduced
+ * alone with -S seed + i -n 1. A failing case is shrunk greedily: chunks of
+ * items are dropped, halving the chunk size down to single items, neighbors
+ * are merged, then each item is simplified in every way the challenge
+ * offers, and the passes repeat until none makes progress. Whatever still fails is printed as
+ * puzzle input, and written to the -o file if one was given.
+ *
+ * @author Mexeck88
+ *
+ * @date 18OCT26
+ */
+
+#define _GNU_SOURCE // memfd_create
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "aoc_check.h"
+#include "aoc_input.h"
+
+#define AOC_CHECK_NS_PER_SEC 1000000000.0
+
+/**
+ * @struct aoc_check_args_t
+ * @brief Command line of a checker
+ */
+typedef struct aoc_check_args_t
+{
+    uint64_t     cases;
+    uint64_t     seed;
+    const char * p_out; // Minimal failing input, NULL to only print it
+} aoc_check_args_t;
+
+/**
+ * @brief Reads the monotonic clock
+ *
+ * @return Seconds since an arbitrary fixed point
+ */
+static double
+aoc_check_now (void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)now.tv_sec + ((double)now.tv_nsec / AOC_CHECK_NS_PER_SEC);
+}
+
+/**
+ * @brief Parses the checker's options
+ *
+ * @param argc Argument count
+ * @param argv Arguments: [-n cases] [-S seed] [-o file]
+ * @param p_args Receives the options
+ *
+ * @return AOC_SUCCESS on success, AOC_FAILURE on a bad command line
+ */
+static uint8_t
+aoc_check_args (int argc, char ** argv, aoc_check_args_t * p_args)
+{
+    int option = 0;
+
+    p_args->cases = AOC_CHECK_CASES;
+    p_args->seed  = AOC_GEN_SEED;
+    p_args->p_out = NULL;
+
+    while (-1 != (option = getopt(argc, argv, "n:S:o:")))
+    {
+        switch (option)
+        {
+            case 'n':
+                if ((false == aoc_gen_parse_size(optarg, &p_args->cases))
+                    || (0 == p_args->cases))
+                {
+                    printf("ERROR: Invalid case count: %s\n", optarg);
+                    return AOC_FAILURE;
+                }
+                break;
+
+            case 'S':
+                if (false == aoc_gen_parse_size(optarg, &p_args->seed))
+                {
+                    printf("ERROR: Invalid seed: %s\n", optarg);
+                    return AOC_FAILURE;
+                }
+                break;
+
+            case 'o':
+                p_args->p_out = optarg;
+                break;
+
+            default:
+                printf("Usage: %s [-n cases] [-S seed] [-o file]\n", argv[0]);
+                return AOC_FAILURE;
+        }
+    }
+
+    if (optind < argc)
+    {
+        printf("Usage: %s [-n cases] [-S seed] [-o file]\n", argv[0]);
+        return AOC_FAILURE;
+    }
+
+    return AOC_SUCCESS;
+}
+
+/**
+ * @brief Runs the challenge's check on a case, keeping the description of a
+ * failure
+ *
+ * @param p_check Challenge checker
+ * @param p_case Case to run
+ * @param p_why Receives the description if the case fails, untouched if it
+ * passes
+ * @param p_budget Checks left for shrinking, decremented
+ *
+ * @return true if some engine disagrees with the reference
+ */
+static bool
+aoc_check_fails (const aoc_check_t *      p_check,
+                 const aoc_check_case_t * p_case,
+                 char *                   p_why,
+                 size_t *                 p_budget)
+{
+    char why[AOC_CHECK_WHY] = "";
+
+    if (0 < *p_budget)
+    {
+        (*p_budget)--;
+    }
+
+    if (true == p_check->p_check(p_case, why, sizeof(why)))
+    {
+        return false;
+    }
+
+    memcpy(p_why, why, sizeof(why));
+    return true;
+}
+
+/**
+ * @brief Drops chunks of items from a failing case while it keeps failing
+ *
+ * @param p_check Challenge checker
+ * @param p_case Failing case, shrunk in place
+ * @param p_saved Room for capacity items, to undo a drop
+ * @param p_why Description of the last failure
+ * @param p_budget Checks left
+ *
+ * @return true if any item was dropped
+ */
+static bool
+aoc_check_drop (const aoc_check_t * p_check,
+                aoc_check_case_t *  p_case,
+                uint8_t *           p_saved,
+                char *              p_why,
+                size_t *            p_budget)
+{
+    uint8_t * p_items   = p_case->p_items;
+    size_t    size      = p_check->item_size;
+    size_t    count     = 0;
+    bool      b_dropped = false;
+
+    for (size_t chunk = (p_case->count + 1) / 2; 0 < chunk; chunk /= 2)
+    {
+        for (size_t start = 0;
+             (start + chunk <= p_case->count) && (0 < *p_budget);)
+        {
+            count = p_case->count;
+            memcpy(p_saved, p_items, count * size);
+
+            memmove(p_items + (start * size),
+                    p_items + ((start + chunk) * size),
+                    (count - start - chunk) * size);
+            p_case->count -= chunk;
+
+            if (true == aoc_check_fails(p_check, p_case, p_why, p_budget))
+            {
+                // The next chunk has moved into this place
+                b_dropped = true;
+                continue;
+            }
+
+            memcpy(p_items, p_saved, count * size);
+            p_case->count = count;
+            start += chunk;
+        }
+    }
+
+    return b_dropped;
+}
+
+/**
+ * @brief Merges neighboring items of a failing case while it keeps failing
+ *
+ * @param p_check Challenge checker
+ * @param p_case Failing case, shrunk in place
+ * @param p_saved Room for capacity items, to undo a merge
+ * @param p_why Description of the last failure
+ * @param p_budget Checks left
+ *
+ * @return true if any items were merged
+ */
+static bool
+aoc_check_merge (const aoc_check_t * p_check,
+                 aoc_check_case_t *  p_case,
+                 uint8_t *           p_saved,
+                 char *              p_why,
+                 size_t *            p_budget)
+{
+    uint8_t * p_items  = p_case->p_items;
+    size_t    size     = p_check->item_size;
+    size_t    count    = 0;
+    bool      b_merged = false;
+
+    if (NULL == p_check->p_merge)
+    {
+        return false;
+    }
+
+    for (size_t idx = 0; (idx + 1 < p_case->count) && (0 < *p_budget);)
+    {
+        count = p_case->count;
+        memcpy(p_saved, p_items, count * size);
+
+        if (true
+            == p_check->p_merge(p_items + (idx * size),
+                                p_items + ((idx + 1) * size)))
+        {
+            memmove(p_items + ((idx + 1) * size),
+                    p_items + ((idx + 2) * size),
+                    (count - idx - 2) * size);
+            p_case->count--;
+
+            if (true == aoc_check_fails(p_check, p_case, p_why, p_budget))
+            {
+                // Try folding the next one into the merged item too
+                b_merged = true;
+                continue;
+            }
+
+            memcpy(p_items, p_saved, count * size);
+            p_case->count = count;
+        }
+
+        idx++;
+    }
+
+    return b_merged;
+}
+
+/**
+ * @brief Simplifies every item of a failing case while it keeps failing
+ *
+ * @param p_check Challenge checker
+ * @param p_case Failing case, shrunk in place
+ * @param p_saved Room for one item, to undo a simplification
+ * @param p_why Description of the last failure
+ * @param p_budget Checks left
+ *
+ * @return true if any item was simplified
+ */
+static bool
+aoc_check_simplify (const aoc_check_t * p_check,
+                    aoc_check_case_t *  p_case,
+                    uint8_t *           p_saved,
+                    char *              p_why,
+                    size_t *            p_budget)
+{
+    uint8_t * p_item       = NULL;
+    size_t    step         = 0;
+    bool      b_simplified = false;
+
+    for (size_t idx = 0; idx < p_case->count; idx++)
+    {
+        p_item = (uint8_t *)p_case->p_items + (idx * p_check->item_size);
+
+        for (step = 0; 0 < *p_budget;)
+        {
+            memcpy(p_saved, p_item, p_check->item_size);
+
+            if (false == p_check->p_simplify(p_item, step))
+            {
+                break;
+            }
+
+            // A way that does not apply to this item leaves it as it was
+            if ((0 != memcmp(p_saved, p_item, p_check->item_size))
+                && (true == aoc_check_fails(p_check, p_case, p_why, p_budget)))
+            {
+                // Start over on the simpler item
+                b_simplified = true;
+                step         = 0;
+                continue;
+            }
+
+            memcpy(p_item, p_saved, p_check->item_size);
+            step++;
+        }
+    }
+
+    return b_simplified;
+}
+
+/**
+ * @brief Shrinks a failing case to one no drop, merge or simplification
+ * still fails on, within AOC_CHECK_SHRINKS checks
+ *
+ * @param p_check Challenge checker
+ * @param p_case Failing case, shrunk in place
+ * @param p_why Description of the failure, updated to the shrunk case's
+ *
+ * @return Checks spent, 0 if the undo buffer could not be allocated
+ */
+static size_t
+aoc_check_shrink (const aoc_check_t * p_check,
+                  aoc_check_case_t *  p_case,
+                  char *              p_why)
+{
+    size_t    budget   = AOC_CHECK_SHRINKS;
+    bool      b_shrunk = true;
+    uint8_t * p_saved  = malloc((p_case->capacity + 1) * p_check->item_size);
+
+    if (NULL == p_saved)
+    {
+        perror("ERROR: Unable to allocate memory for shrinking");
+        return 0;
+    }
+
+    while ((true == b_shrunk) && (0 < budget))
+    {
+        b_shrunk = aoc_check_drop(p_check, p_case, p_saved, p_why, &budget);
+
+        if (true == aoc_check_merge(p_check, p_case, p_saved, p_why, &budget))
+        {
+            b_shrunk = true;
+        }
+
+        if (true
+            == aoc_check_simplify(p_check, p_case, p_saved, p_why, &budget))
+        {
+            b_shrunk = true;
+        }
+    }
+
+    free(p_saved);
+    return AOC_CHECK_SHRINKS - budget;
+}
+
+/**
+ * @brief Prints a shrunk failure and writes it to the -o file
+ *
+ * @param p_check Challenge checker
+ * @param p_case Shrunk case
+ * @param p_args Options of the run
+ */
+static void
+aoc_check_report (const aoc_check_t *      p_check,
+                  const aoc_check_case_t * p_case,
+                  const aoc_check_args_t * p_args)
+{
+    FILE * p_out = NULL;
+
+    printf("--- minimal input (%zu items) ---\n", p_case->count);
+    p_check->p_print(p_case, stdout);
+    printf("--- end of input ---\n");
+
+    if (NULL == p_args->p_out)
+    {
+        return;
+    }
+
+    p_out = fopen(p_args->p_out, "w");
+    if (NULL == p_out)
+    {
+        perror("ERROR: Unable to open failing input file");
+        return;
+    }
+
+    p_check->p_print(p_case, p_out);
+    if (0 != fclose(p_out))
+    {
+        perror("ERROR: Unable to write failing input file");
+        return;
+    }
+
+    printf("Failing input written to %s\n", p_args->p_out);
+}
+
+/**
+ * @brief Compares one answer of an engine with the reference's
+ *
+ * @param p_engine Engine that gave the answer
+ * @param p_what Which answer, such as "part 1"
+ * @param got The engine's answer
+ * @param want The reference answer
+ * @param p_why Receives the mismatch, untouched when the answers agree
+ * @param why_size Size of p_why
+ *
+ * @return true if the answers agree
+ */
+bool
+aoc_check_equal (const char * p_engine,
+                 const char * p_what,
+                 int64_t      got,
+                 int64_t      want,
+                 char *       p_why,
+                 size_t       why_size)
+{
+    if (got == want)
+    {
+        return true;
+    }
+
+    snprintf(p_why,
+             why_size,
+             "%s %s gave %lld, reference %lld",
+             p_engine,
+             p_what,
+             (long long)got,
+             (long long)want);
+    return false;
+}
+
+/**
+ * @brief Compares both answers of an engine with the reference's
+ *
+ * @param p_engine Engine that gave the answers
+ * @param p_got The engine's answers
+ * @param p_want The reference answers
+ * @param p_why Receives the first mismatch, untouched when both agree
+ * @param why_size Size of p_why
+ *
+ * @return true if both answers agree
+ */
+bool
+aoc_check_result (const char *             p_engine,
+                  const aoc_day_result_t * p_got,
+                  const aoc_day_result_t * p_want,
+                  char *                   p_why,
+                  size_t                   why_size)
+{
+    if (false
+        == aoc_check_equal(
+            p_engine, "part 1", p_got->part1, p_want->part1, p_why, why_size))
+    {
+        return false;
+    }
+
+    return aoc_check_equal(
+        p_engine, "part 2", p_got->part2, p_want->part2, p_why, why_size);
+}
+
+/**
+ * @brief Writes a case as puzzle input to an anonymous in-memory file, for
+ * engines that only read input files
+ *
+ * @param p_check Challenge checker
+ * @param p_case Case to write
+ * @param p_path Receives a path the file can be opened and mapped by
+ * @param path_size Size of p_path, at least AOC_CHECK_PATH
+ *
+ * @return Descriptor to close once the engines are done, -1 on failure
+ */
+int
+aoc_check_text (const aoc_check_t *      p_check,
+                const aoc_check_case_t * p_case,
+                char *                   p_path,
+                size_t                   path_size)
+{
+    int    fd    = -1;
+    FILE * p_out = NULL;
+
+    fd = memfd_create(p_check->p_name, MFD_CLOEXEC);
+    if (0 > fd)
+    {
+        perror("ERROR: Unable to create input file");
+        return -1;
+    }
+
+    // The stream gets its own descriptor, so closing it keeps fd open
+    p_out = fdopen(dup(fd), "w");
+    if (NULL == p_out)
+    {
+        perror("ERROR: Unable to open input file");
+        close(fd);
+        return -1;
+    }
+
+    p_check->p_print(p_case, p_out);
+    if (0 != fclose(p_out))
+    {
+        perror("ERROR: Unable to write input file");
+        close(fd);
+        return -1;
+    }
+
+    snprintf(p_path, path_size, "/proc/self/fd/%d", fd);
+    return fd;
+}
+
+/**
+ * @brief Runs a challenge's differential check (its checker's main)
+ *
+ * @param p_check Challenge checker
+ * @param argc Argument count
+ * @param argv Arguments: [-n cases] [-S seed] [-o file]
+ *
+ * @return 0 if every case passed, 1 on a mismatch or an error
+ */
+int
+aoc_check_main (const aoc_check_t * p_check, int argc, char ** argv)
+{
+    int              retcode = 1;
+    aoc_check_args_t args;
+    aoc_check_case_t check_case = { 0 };
+    aoc_rng_t        rng;
+    char             why[AOC_CHECK_WHY];
+    size_t           spent   = 0;
+    double           start   = 0.0;
+    double           elapsed = 0.0;
+
+    if (AOC_SUCCESS != aoc_check_args(argc, argv, &args))
+    {
+        goto EXIT;
+    }
+
+    check_case.capacity = p_check->max_items;
+    check_case.p_items  = malloc(p_check->max_items * p_check->item_size);
+    if (NULL == check_case.p_items)
+    {
+        perror("ERROR: Unable to allocate memory for cases");
+        goto EXIT;
+    }
+
+    start = aoc_check_now();
+
+    for (uint64_t idx = 0; idx < args.cases; idx++)
+    {
+        aoc_rng_seed(&rng, args.seed + idx);
+        check_case.count = 0;
+        p_check->p_generate(&rng, &check_case);
+
+        if (true == p_check->p_check(&check_case, why, sizeof(why)))
+        {
+            continue;
+        }
+
+        printf("FAIL: %s case %llu (-S %llu -n 1 reruns it): %s\n",
+               p_check->p_name,
+               (unsigned long long)idx,
+               (unsigned long long)(args.seed + idx),
+               why);
+
+        spent = aoc_check_shrink(p_check, &check_case, why);
+        printf("Shrunk in %zu checks: %s\n", spent, why);
+        aoc_check_report(p_check, &check_case, &args);
+        goto CLEAN;
+    }
+
+    elapsed = aoc_check_now() - start;
+    printf("PASS: %s, %llu cases in %.2f s (%.0f cases/s), seed %llu\n",
+           p_check->p_name,
+           (unsigned long long)args.cases,
+           elapsed,
+           (0.0 < elapsed) ? (double)args.cases / elapsed : 0.0,
+           (unsigned long long)args.seed);
+
+    retcode = 0;
+CLEAN:
+    free(check_case.p_items);
+EXIT:
+    return retcode;
+}
+
+/** END OF FILE **/
\ No newline at end of file
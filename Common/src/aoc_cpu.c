@@ -0,0 +1,140 @@
+/**
+ * @file aoc_cpu.c
+ *
+ * @brief CPU feature detection and kernel dispatch for the Advent of Code
+ * 2025 challenges
+ *
+ * Both the detected and the chosen level are worked out once per process,
+ * so challenges may resolve their kernels from constructors or from any
+ * thread.
+ *
+ * @author Mexeck88
+ *
+ * @date 18OCT26
+ */
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "aoc_cpu.h"
+
+static const char * const g_cpu_names[AOC_CPU_LEVELS] = {
+    "scalar",
+    "sse4.2",
+    "avx2",
+    "avx512",
+};
+
+static aoc_cpu_level_t g_cpu_detected = AOC_CPU_SCALAR;
+static aoc_cpu_level_t g_cpu_level    = AOC_CPU_SCALAR;
+static pthread_once_t  g_cpu_once     = PTHREAD_ONCE_INIT;
+
+/**
+ * @brief Reads the CPU's features and applies AOC_SIMD
+ */
+static void
+aoc_cpu_init (void)
+{
+    const char * p_env = getenv(AOC_CPU_ENV);
+    int          level = 0;
+
+#if AOC_CPU_X86
+    __builtin_cpu_init();
+
+    if (__builtin_cpu_supports("sse4.2") && __builtin_cpu_supports("popcnt"))
+    {
+        g_cpu_detected = AOC_CPU_SSE42;
+
+        if (__builtin_cpu_supports("avx2"))
+        {
+            g_cpu_detected = AOC_CPU_AVX2;
+
+            if (__builtin_cpu_supports("avx512f")
+                && __builtin_cpu_supports("avx512bw")
+                && __builtin_cpu_supports("avx512dq")
+                && __builtin_cpu_supports("avx512vl"))
+            {
+                g_cpu_detected = AOC_CPU_AVX512;
+            }
+        }
+    }
+#endif
+
+    g_cpu_level = g_cpu_detected;
+
+    if ((NULL == p_env) || ('\0' == p_env[0]))
+    {
+        return;
+    }
+
+    for (level = 0; level < AOC_CPU_LEVELS; level++)
+    {
+        if (0 == strcmp(p_env, g_cpu_names[level]))
+        {
+            break;
+        }
+    }
+
+    if (AOC_CPU_LEVELS == level)
+    {
+        fprintf(stderr,
+                "WARNING: Unknown %s=%s, using %s\n",
+                AOC_CPU_ENV,
+                p_env,
+                g_cpu_names[g_cpu_detected]);
+    }
+    else if ((aoc_cpu_level_t)level > g_cpu_detected)
+    {
+        fprintf(stderr,
+                "WARNING: CPU lacks %s=%s, using %s\n",
+                AOC_CPU_ENV,
+                p_env,
+                g_cpu_names[g_cpu_detected]);
+    }
+    else
+    {
+        g_cpu_level = (aoc_cpu_level_t)level;
+    }
+}
+
+/**
+ * @brief Best level the CPU supports, whatever AOC_SIMD says
+ *
+ * @return Detected level
+ */
+aoc_cpu_level_t
+aoc_cpu_detect (void)
+{
+    pthread_once(&g_cpu_once, aoc_cpu_init);
+    return g_cpu_detected;
+}
+
+/**
+ * @brief Level whose kernels to run: the detected one unless AOC_SIMD forces
+ * a lower one
+ *
+ * @return Index into a challenge's table of variants
+ */
+aoc_cpu_level_t
+aoc_cpu_level (void)
+{
+    pthread_once(&g_cpu_once, aoc_cpu_init);
+    return g_cpu_level;
+}
+
+/**
+ * @brief Name of a level, as accepted by AOC_SIMD
+ *
+ * @param level Level to name
+ *
+ * @return Its name, "unknown" when out of range
+ */
+const char *
+aoc_cpu_name (aoc_cpu_level_t level)
+{
+    return ((unsigned)level < AOC_CPU_LEVELS) ? g_cpu_names[level] : "unknown";
+}
+
+/** END OF FILE **/
\ No newline at end of file
@@ -0,0 +1,453 @@
+/**
+ * @file aoc_gen.c
+ *
+ * @brief Seeded random numbers and streaming output for the Advent of Code
+ * 2025 input generators
+ *
+ * The generators never hold more than one output block in memory, so they
+ * can write inputs far larger than RAM to a file or straight into a pipe.
+ * Every random draw comes from xoshiro256** seeded through splitmix64, so a
+ * seed always reproduces the same bytes on every platform.
+ *
+ * @author Mexeck88
+ *
+ * @date 18OCT26
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "aoc_gen.h"
+#include "aoc_input.h"
+
+/**
+ * @brief Rotates a 64 bit value left
+ *
+ * @param value Value to rotate
+ * @param shift Bits to rotate by, 1 to 63
+ *
+ * @return The rotated value
+ */
+static inline uint64_t
+aoc_rng_rotl (uint64_t value, int shift)
+{
+    return (value << shift) | (value >> (64 - shift));
+}
+
+/**
+ * @brief Advances a splitmix64 state, used only to expand the seed
+ *
+ * @param p_state State to advance
+ *
+ * @return The next splitmix64 output
+ */
+static uint64_t
+aoc_rng_splitmix (uint64_t * p_state)
+{
+    uint64_t value = (*p_state += 0x9E3779B97F4A7C15ULL);
+
+    value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+
+    return value ^ (value >> 31);
+}
+
+/**
+ * @brief Seeds a generator
+ *
+ * @param p_rng Generator to seed
+ * @param seed Any value; equal seeds give equal streams
+ */
+void
+aoc_rng_seed (aoc_rng_t * p_rng, uint64_t seed)
+{
+    for (size_t idx = 0; idx < 4; idx++)
+    {
+        p_rng->state[idx] = aoc_rng_splitmix(&seed);
+    }
+}
+
+/**
+ * @brief Draws 64 random bits
+ *
+ * @param p_rng Seeded generator
+ *
+ * @return The next value of the stream
+ */
+uint64_t
+aoc_rng_next (aoc_rng_t * p_rng)
+{
+    uint64_t * p_state = p_rng->state;
+    uint64_t   result  = aoc_rng_rotl(p_state[1] * 5, 7) * 9;
+    uint64_t   temp    = p_state[1] << 17;
+
+    p_state[2] ^= p_state[0];
+    p_state[3] ^= p_state[1];
+    p_state[1] ^= p_state[2];
+    p_state[0] ^= p_state[3];
+    p_state[2] ^= temp;
+    p_state[3] = aoc_rng_rotl(p_state[3], 45);
+
+    return result;
+}
+
+/**
+ * @brief Draws a uniform value below a bound, without modulo bias
+ *
+ * @param p_rng Seeded generator
+ * @param bound Exclusive upper bound; 0 returns 0
+ *
+ * @return A value in [0, bound)
+ */
+uint64_t
+aoc_rng_below (aoc_rng_t * p_rng, uint64_t bound)
+{
+    uint64_t threshold = 0;
+    uint64_t value     = 0;
+
+    if (0 == bound)
+    {
+        return 0;
+    }
+
+    // Reject the short top slice of the range so every residue is equally
+    // likely
+    threshold = (0 - bound) % bound;
+    do
+    {
+        value = aoc_rng_next(p_rng);
+    } while (value < threshold);
+
+    return value % bound;
+}
+
+/**
+ * @brief Draws a uniform double
+ *
+ * @param p_rng Seeded generator
+ *
+ * @return A value in [0, 1)
+ */
+double
+aoc_rng_unit (aoc_rng_t * p_rng)
+{
+    return (double)(aoc_rng_next(p_rng) >> 11) * 0x1.0p-53;
+}
+
+/**
+ * @brief Writes a whole block, retrying short writes
+ *
+ * @param fd Descriptor to write to
+ * @param p_data Bytes to write
+ * @param length Number of bytes
+ *
+ * @return AOC_SUCCESS on success, AOC_FAILURE on failure
+ */
+static uint8_t
+aoc_writer_write_all (int fd, const char * p_data, size_t length)
+{
+    ssize_t done = 0;
+
+    while (0 < length)
+    {
+        done = write(fd, p_data, length);
+        if (0 > done)
+        {
+            if (EINTR == errno)
+            {
+                continue;
+            }
+
+            perror("ERROR: Unable to write output");
+            return AOC_FAILURE;
+        }
+
+        p_data += done;
+        length -= (size_t)done;
+    }
+
+    return AOC_SUCCESS;
+}
+
+/**
+ * @brief Opens a writer on a file, or on stdout for "-" or NULL
+ *
+ * @param p_writer Writer to set up
+ * @param p_path Output path, truncated if it exists
+ *
+ * @return AOC_SUCCESS on success, AOC_FAILURE on failure
+ */
+uint8_t
+aoc_writer_open (aoc_writer_t * p_writer, const char * p_path)
+{
+    memset(p_writer, 0, sizeof(*p_writer));
+    p_writer->fd = STDOUT_FILENO;
+
+    p_writer->p_buffer = malloc(AOC_GEN_BUFFER);
+    if (NULL == p_writer->p_buffer)
+    {
+        perror("ERROR: Unable to allocate output buffer");
+        return AOC_FAILURE;
+    }
+
+    if ((NULL != p_path) && (0 != strcmp(p_path, "-")))
+    {
+        p_writer->fd = open(p_path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        if (0 > p_writer->fd)
+        {
+            perror("ERROR: Unable to open output");
+            free(p_writer->p_buffer);
+            p_writer->p_buffer = NULL;
+            return AOC_FAILURE;
+        }
+    }
+
+    return AOC_SUCCESS;
+}
+
+/**
+ * @brief Appends bytes, flushing whole blocks as the buffer fills
+ *
+ * @param p_writer Open writer
+ * @param p_data Bytes to append
+ * @param length Number of bytes
+ *
+ * @return AOC_SUCCESS on success, AOC_FAILURE on failure
+ */
+uint8_t
+aoc_writer_put (aoc_writer_t * p_writer, const char * p_data, size_t length)
+{
+    size_t room = 0;
+
+    p_writer->written += length;
+
+    while (0 < length)
+    {
+        room = AOC_GEN_BUFFER - p_writer->used;
+        if (length < room)
+        {
+            room = length;
+        }
+
+        memcpy(p_writer->p_buffer + p_writer->used, p_data, room);
+        p_writer->used += room;
+        p_data += room;
+        length -= room;
+
+        if (AOC_GEN_BUFFER == p_writer->used)
+        {
+            if (AOC_SUCCESS
+                != aoc_writer_write_all(
+                    p_writer->fd, p_writer->p_buffer, p_writer->used))
+            {
+                return AOC_FAILURE;
+            }
+            p_writer->used = 0;
+        }
+    }
+
+    return AOC_SUCCESS;
+}
+
+/**
+ * @brief Appends an unsigned number in decimal
+ *
+ * @param p_writer Open writer
+ * @param value Number to write
+ *
+ * @return AOC_SUCCESS on success, AOC_FAILURE on failure
+ */
+uint8_t
+aoc_writer_number (aoc_writer_t * p_writer, uint64_t value)
+{
+    char   digits[AOC_GEN_DIGITS];
+    size_t start = AOC_GEN_DIGITS;
+
+    do
+    {
+        digits[--start] = (char)('0' + (value % 10));
+        value /= 10;
+    } while (0 < value);
+
+    return aoc_writer_put(p_writer, digits + start, AOC_GEN_DIGITS - start);
+}
+
+/**
+ * @brief Flushes what is buffered and releases the writer
+ *
+ * @param p_writer Writer to close; safe to call on a failed open
+ *
+ * @return AOC_SUCCESS on success, AOC_FAILURE if the final write failed
+ */
+uint8_t
+aoc_writer_close (aoc_writer_t * p_writer)
+{
+    uint8_t retcode = AOC_SUCCESS;
+
+    if (NULL == p_writer->p_buffer)
+    {
+        return AOC_SUCCESS;
+    }
+
+    retcode = aoc_writer_write_all(
+        p_writer->fd, p_writer->p_buffer, p_writer->used);
+
+    if ((STDOUT_FILENO != p_writer->fd) && (0 != close(p_writer->fd)))
+    {
+        perror("ERROR: Unable to close output");
+        retcode = AOC_FAILURE;
+    }
+
+    free(p_writer->p_buffer);
+    p_writer->p_buffer = NULL;
+    p_writer->used     = 0;
+
+    return retcode;
+}
+
+/**
+ * @brief Parses a byte count with an optional K, M, G or T suffix
+ *
+ * @param p_text Text such as "4096", "64M" or "10G"
+ * @param p_size Parsed size in bytes
+ *
+ * @return true if the whole text was a valid size
+ */
+bool
+aoc_gen_parse_size (const char * p_text, uint64_t * p_size)
+{
+    char *             p_end = NULL;
+    unsigned long long value = 0;
+    uint64_t           scale = 1;
+
+    errno = 0;
+    value = strtoull(p_text, &p_end, 10);
+    if ((0 != errno) || (p_end == p_text) || ('-' == *p_text))
+    {
+        return false;
+    }
+
+    switch (*p_end)
+    {
+        case 'T':
+        case 't':
+            scale *= AOC_GEN_UNIT_SCALE;
+            // fall through
+        case 'G':
+        case 'g':
+            scale *= AOC_GEN_UNIT_SCALE;
+            // fall through
+        case 'M':
+        case 'm':
+            scale *= AOC_GEN_UNIT_SCALE;
+            // fall through
+        case 'K':
+        case 'k':
+            scale *= AOC_GEN_UNIT_SCALE;
+            p_end++;
+            break;
+        default:
+            break;
+    }
+
+    if (('\0' != *p_end) || ((UINT64_MAX / scale) < value))
+    {
+        return false;
+    }
+
+    *p_size = (uint64_t)value * scale;
+    return true;
+}
+
+/**
+ * @brief Sets the shared options to their defaults
+ *
+ * @param p_args Options to set
+ * @param count Records to write when neither -n nor -s is given
+ */
+void
+aoc_gen_args_init (aoc_gen_args_t * p_args, uint64_t count)
+{
+    p_args->count = count;
+    p_args->size  = 0;
+    p_args->seed  = AOC_GEN_SEED;
+    p_args->p_out = "-";
+}
+
+/**
+ * @brief Stores one getopt option if it is a shared one
+ *
+ * @param p_args Options to update
+ * @param option Option character returned by getopt
+ * @param p_value Its argument (optarg)
+ *
+ * @return An aoc_gen_opt_t outcome
+ */
+uint8_t
+aoc_gen_option (aoc_gen_args_t * p_args, int option, const char * p_value)
+{
+    uint64_t value = 0;
+
+    switch (option)
+    {
+        case 'n':
+        case 's':
+        case 'S':
+            if (false == aoc_gen_parse_size(p_value, &value))
+            {
+                printf("ERROR: Invalid value for -%c: %s\n", option, p_value);
+                return AOC_GEN_OPT_BAD;
+            }
+
+            if ('S' == option)
+            {
+                p_args->seed = value;
+            }
+            else if (0 == value)
+            {
+                printf("ERROR: -%c must be positive\n", option);
+                return AOC_GEN_OPT_BAD;
+            }
+            else
+            {
+                p_args->count = ('n' == option) ? value : 0;
+                p_args->size  = ('s' == option) ? value : 0;
+            }
+            return AOC_GEN_OPT_USED;
+
+        case 'o':
+            p_args->p_out = p_value;
+            return AOC_GEN_OPT_USED;
+
+        default:
+            return AOC_GEN_OPT_OTHER;
+    }
+}
+
+/**
+ * @brief Tells whether another record is due
+ *
+ * @param p_args Shared options
+ * @param p_writer Writer the records go to
+ * @param records Records written so far
+ *
+ * @return true while the -n count or the -s size is not reached
+ */
+bool
+aoc_gen_more (const aoc_gen_args_t * p_args,
+              const aoc_writer_t *   p_writer,
+              uint64_t               records)
+{
+    if (0 < p_args->count)
+    {
+        return records < p_args->count;
+    }
+
+    return p_writer->written < p_args->size;
+}
+
+/** END OF FILE **/
\ No newline at end of file
@@ -0,0 +1,374 @@
+/**
+ * @file aoc_input.c
+ *
+ * @brief Shared zero-copy input reader for the Advent of Code 2025 challenges
+ *
+ * Regular files are mapped read-only and handed out as line or token views
+ * into the mapping, so nothing is copied or allocated per line. Pipes and
+ * anything else that cannot be mapped are read() whole into one buffer and
+ * served the same way.
+ *
+ * @author Mexeck88
+ *
+ * @date 18OCT26
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "aoc_input.h"
+
+/**
+ * @brief Reads a descriptor to the end into one growing buffer
+ *
+ * @param fd Descriptor to read
+ * @param size_hint Expected size, 0 if unknown
+ * @param p_input Input to fill in
+ *
+ * @return AOC_SUCCESS on success, AOC_FAILURE on failure
+ */
+static uint8_t
+aoc_input_read_all (int fd, size_t size_hint, aoc_input_t * p_input)
+{
+    uint8_t retcode  = AOC_FAILURE;
+    char *  p_buffer = NULL;
+    char *  p_temp   = NULL;
+    size_t  capacity = (0 < size_hint) ? size_hint + 1 : AOC_READ_CHUNK;
+    size_t  size     = 0;
+    ssize_t got      = 0;
+
+    p_buffer = malloc(capacity);
+    if (NULL == p_buffer)
+    {
+        perror("ERROR: Unable to allocate memory for input");
+        goto EXIT;
+    }
+
+    for (;;)
+    {
+        if (size == capacity)
+        {
+            capacity *= AOC_READ_SCALE;
+            p_temp = realloc(p_buffer, capacity);
+            if (NULL == p_temp)
+            {
+                perror("ERROR: Unable to reallocate memory for input");
+                goto CLEAN;
+            }
+            p_buffer = p_temp;
+        }
+
+        got = read(fd, p_buffer + size, capacity - size);
+        if (0 == got)
+        {
+            break;
+        }
+
+        if (0 > got)
+        {
+            if (EINTR == errno)
+            {
+                continue;
+            }
+
+            perror("ERROR: Unable to read input");
+            goto CLEAN;
+        }
+
+        size += (size_t)got; // got > 0
+    }
+
+    p_input->p_data   = p_buffer;
+    p_input->size     = size;
+    p_input->b_mapped = false;
+
+    retcode = AOC_SUCCESS;
+    goto EXIT;
+
+CLEAN:
+    free(p_buffer);
+EXIT:
+    return retcode;
+}
+
+/**
+ * @brief Opens an input file, mapping it when possible
+ *
+ * @param p_file_path Path to the input file ("-" reads stdin)
+ * @param p_input Input to fill in
+ *
+ * @return AOC_SUCCESS on success, AOC_FAILURE on failure
+ */
+uint8_t
+aoc_input_open (const char * p_file_path, aoc_input_t * p_input)
+{
+    uint8_t     retcode = AOC_FAILURE;
+    int         fd      = -1;
+    void *      p_map   = MAP_FAILED;
+    struct stat file_info;
+
+    if ((NULL == p_file_path) || (NULL == p_input))
+    {
+        perror("ERROR: NULL pointer passed to input_open\n");
+        goto EXIT;
+    }
+
+    memset(p_input, 0, sizeof(*p_input));
+
+    fd = (0 == strcmp(p_file_path, "-")) ? STDIN_FILENO
+                                         : open(p_file_path, O_RDONLY);
+    if (0 > fd)
+    {
+        printf("ERROR: Unable to open file %s\n", p_file_path);
+        goto EXIT;
+    }
+
+    if (0 != fstat(fd, &file_info))
+    {
+        perror("ERROR: Unable to stat input");
+        goto CLEAN;
+    }
+
+    // An empty file has nothing to map
+    if (S_ISREG(file_info.st_mode) && (0 == file_info.st_size))
+    {
+        retcode = AOC_SUCCESS;
+        goto CLEAN;
+    }
+
+    if (S_ISREG(file_info.st_mode))
+    {
+        p_map = mmap(NULL,
+                     (size_t)file_info.st_size,
+                     PROT_READ,
+                     MAP_PRIVATE,
+                     fd,
+                     0);
+    }
+
+    if (MAP_FAILED != p_map)
+    {
+        p_input->p_data   = p_map;
+        p_input->size     = (size_t)file_info.st_size; // Regular file
+        p_input->b_mapped = true;
+
+        // Read-ahead hint; a failure here only costs speed
+        if (AOC_SEQUENTIAL_MIN <= p_input->size)
+        {
+            (void)madvise(p_map, p_input->size, MADV_SEQUENTIAL);
+        }
+
+        retcode = AOC_SUCCESS;
+    }
+    else
+    {
+        retcode = aoc_input_read_all(
+            fd,
+            S_ISREG(file_info.st_mode) ? (size_t)file_info.st_size : 0,
+            p_input);
+    }
+
+CLEAN:
+    // The mapping outlives the descriptor
+    if (STDIN_FILENO != fd)
+    {
+        close(fd);
+    }
+EXIT:
+    return retcode;
+}
+
+/**
+ * @brief Releases an input and invalidates every view into it
+ *
+ * @param p_input Input to release (safe to call on a zeroed one)
+ */
+void
+aoc_input_close (aoc_input_t * p_input)
+{
+    if ((NULL == p_input) || (NULL == p_input->p_data))
+    {
+        return;
+    }
+
+    if (true == p_input->b_mapped)
+    {
+        munmap((void *)p_input->p_data, p_input->size); // mmap'd, not const
+    }
+    else
+    {
+        free((void *)p_input->p_data); // malloc'd by read_all
+    }
+
+    memset(p_input, 0, sizeof(*p_input));
+}
+
+/**
+ * @brief Hands out the next line without its newline (or carriage return)
+ *
+ * A final newline does not start an extra empty line.
+ *
+ * @param p_input Input
+ * @param p_line Receives the line
+ *
+ * @return true if a line was read, false at the end of the input
+ */
+bool
+aoc_input_next_line (aoc_input_t * p_input, aoc_view_t * p_line)
+{
+    const char * p_start  = NULL;
+    const char * p_end    = NULL;
+    size_t       length   = 0;
+    size_t       consumed = 0;
+
+    if (p_input->pos >= p_input->size)
+    {
+        return false;
+    }
+
+    p_start = p_input->p_data + p_input->pos;
+    p_end   = memchr(p_start, '\n', p_input->size - p_input->pos);
+
+    length   = (NULL != p_end) ? (size_t)(p_end - p_start)
+                               : p_input->size - p_input->pos;
+    consumed = length + ((NULL != p_end) ? 1 : 0);
+
+    while ((0 < length) && ('\r' == p_start[length - 1]))
+    {
+        length--;
+    }
+
+    p_input->pos += consumed;
+    p_line->p_data = p_start;
+    p_line->length = length;
+
+    return true;
+}
+
+/**
+ * @brief Tests whether a character is one of the delimiters
+ *
+ * @param p_delims Delimiter characters
+ * @param value Character to test
+ *
+ * @return true for a delimiter (never for NUL)
+ */
+static bool
+aoc_input_is_delim (const char * p_delims, char value)
+{
+    return ('\0' != value) && (NULL != strchr(p_delims, value));
+}
+
+/**
+ * @brief Hands out the next token between delimiters, skipping empty ones
+ *
+ * @param p_input Input
+ * @param p_delims Delimiter characters
+ * @param p_token Receives the token
+ *
+ * @return true if a token was read, false at the end of the input
+ */
+bool
+aoc_input_next_token (aoc_input_t * p_input,
+                      const char *  p_delims,
+                      aoc_view_t *  p_token)
+{
+    const char * p_data = p_input->p_data;
+    size_t       start  = p_input->pos;
+    size_t       end    = 0;
+
+    while ((start < p_input->size)
+           && (true == aoc_input_is_delim(p_delims, p_data[start])))
+    {
+        start++;
+    }
+
+    if (start >= p_input->size)
+    {
+        p_input->pos = p_input->size;
+        return false;
+    }
+
+    end = start;
+    while ((end < p_input->size)
+           && (false == aoc_input_is_delim(p_delims, p_data[end])))
+    {
+        end++;
+    }
+
+    p_input->pos    = end;
+    p_token->p_data = p_data + start;
+    p_token->length = end - start;
+
+    return true;
+}
+
+/**
+ * @brief Parses a whole view as a signed decimal number
+ *
+ * @param view Digits with an optional leading sign
+ * @param p_value Receives the number
+ *
+ * @return true if the view is a number that fits in a long, false otherwise
+ */
+bool
+aoc_view_parse_long (aoc_view_t view, long * p_value)
+{
+    size_t        idx     = 0;
+    unsigned long value   = 0;
+    unsigned long limit   = LONG_MAX;
+    unsigned long digit   = 0;
+    bool          b_minus = false;
+
+    if ((0 < view.length) && (('-' == view.p_data[0]) || ('+' == view.p_data[0])))
+    {
+        b_minus = ('-' == view.p_data[0]);
+        idx++;
+    }
+
+    // The magnitude of LONG_MIN is one more than LONG_MAX
+    if (true == b_minus)
+    {
+        limit = (unsigned long)LONG_MAX + 1;
+    }
+
+    if (idx == view.length)
+    {
+        return false;
+    }
+
+    for (; idx < view.length; idx++)
+    {
+        if (('0' > view.p_data[idx]) || ('9' < view.p_data[idx]))
+        {
+            return false;
+        }
+
+        digit = (unsigned long)(view.p_data[idx] - '0');
+        if (value > (limit - digit) / 10)
+        {
+            return false; // Too many digits for a long
+        }
+
+        value = (value * 10) + digit;
+    }
+
+    if (false == b_minus)
+    {
+        *p_value = (long)value;
+    }
+    else
+    {
+        *p_value = (limit == value) ? LONG_MIN : -(long)value;
+    }
+    return true;
+}
+
+/** END OF FILE **/
\ No newline at end of file
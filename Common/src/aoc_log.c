@@ -0,0 +1,301 @@
+/**
+ * @file aoc_log.c
+ *
+ * @brief Background log writer for the Advent of Code 2025 challenges
+ *
+ * Records go into a bounded lock-free ring (Vyukov's sequence-numbered
+ * queue): any thread claims a slot with one compare-and-swap on the tail
+ * and publishes it by bumping the slot's sequence number. A single writer
+ * thread, started on the first record, formats the slots in order into a
+ * buffered copy of stderr and flushes whenever the ring runs dry. The
+ * writer is drained and joined at exit.
+ *
+ * @author Mexeck88
+ *
+ * @date 18OCT26
+ */
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "aoc_log.h"
+
+/**
+ * @struct aoc_log_slot_t
+ * @brief One record in the ring
+ *
+ * sequence == position: free for the producer claiming that position.
+ * sequence == position + 1: published, waiting for the writer.
+ */
+typedef struct aoc_log_slot_t
+{
+    atomic_size_t sequence;
+    uint64_t      time_ns;
+    const char *  p_fmt;
+    long          args[AOC_LOG_ARGS];
+    int           level;
+} aoc_log_slot_t;
+
+static aoc_log_slot_t g_log_ring[AOC_LOG_RING];
+static atomic_size_t  g_log_tail;      // Next position to claim
+static size_t         g_log_head;      // Next position to write; writer only
+static atomic_bool    g_b_log_stop;
+static atomic_bool    g_b_log_async;   // Writer thread is running
+static atomic_ulong   g_log_dropped;
+static uint64_t       g_log_epoch_ns;  // Times are printed relative to this
+static FILE *         gp_log_out;
+static pthread_t      g_log_writer;
+static pthread_once_t g_log_once = PTHREAD_ONCE_INIT;
+
+static const char * gp_log_names[] = {
+    "NONE", "ERROR", "WARN", "INFO", "DEBUG", "TRACE",
+};
+
+/**
+ * @brief Reads the monotonic clock
+ *
+ * @return Nanoseconds since an arbitrary fixed point
+ */
+static uint64_t
+aoc_log_now_ns (void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return ((uint64_t)now.tv_sec * AOC_LOG_NS_PER_SEC) + (uint64_t)now.tv_nsec;
+}
+
+/**
+ * @brief Formats one record
+ *
+ * Unused argument slots are zero; printf ignores arguments past the last
+ * conversion.
+ *
+ * @param p_out Stream to write to
+ * @param level Record level
+ * @param time_ns Record time
+ * @param p_fmt Record format
+ * @param p_args AOC_LOG_ARGS arguments
+ */
+static void
+aoc_log_write (FILE *       p_out,
+               int          level,
+               uint64_t     time_ns,
+               const char * p_fmt,
+               const long * p_args)
+{
+    fprintf(p_out,
+            "%12.6f %-5s ",
+            (double)(time_ns - g_log_epoch_ns) / AOC_LOG_NS_PER_SEC,
+            gp_log_names[level]);
+    fprintf(p_out, p_fmt, p_args[0], p_args[1], p_args[2], p_args[3]);
+    fputc('\n', p_out);
+}
+
+/**
+ * @brief Writer thread: formats published slots in order until stopped
+ *
+ * @param p_unused Unused
+ *
+ * @return NULL
+ */
+static void *
+aoc_log_writer (void * p_unused)
+{
+    struct timespec  idle   = { 0, AOC_LOG_IDLE };
+    aoc_log_slot_t * p_slot = NULL;
+    bool             b_stop = false;
+
+    (void)p_unused;
+
+    for (;;)
+    {
+        p_slot = &g_log_ring[g_log_head & (AOC_LOG_RING - 1)];
+        if (atomic_load_explicit(&p_slot->sequence, memory_order_acquire)
+            == g_log_head + 1)
+        {
+            aoc_log_write(gp_log_out,
+                          p_slot->level,
+                          p_slot->time_ns,
+                          p_slot->p_fmt,
+                          p_slot->args);
+
+            // Hand the slot back for the position one lap ahead
+            atomic_store_explicit(&p_slot->sequence,
+                                  g_log_head + AOC_LOG_RING,
+                                  memory_order_release);
+            g_log_head++;
+            continue;
+        }
+
+        // Ring is empty: finish if asked to, after one last look
+        if (true == b_stop)
+        {
+            break;
+        }
+
+        fflush(gp_log_out);
+        b_stop = atomic_load_explicit(&g_b_log_stop, memory_order_acquire);
+        if (false == b_stop)
+        {
+            nanosleep(&idle, NULL);
+        }
+    }
+
+    fflush(gp_log_out);
+    return NULL;
+}
+
+/**
+ * @brief Prepares the ring and starts the writer, once per process
+ *
+ * If the writer cannot start, records are written synchronously instead.
+ */
+static void
+aoc_log_start (void)
+{
+    int out_fd = -1;
+
+    g_log_epoch_ns = aoc_log_now_ns();
+
+    for (size_t idx = 0; idx < AOC_LOG_RING; idx++)
+    {
+        atomic_init(&g_log_ring[idx].sequence, idx);
+    }
+
+    // A private, fully buffered stream on stderr's descriptor
+    out_fd = dup(STDERR_FILENO);
+    if (0 <= out_fd)
+    {
+        gp_log_out = fdopen(out_fd, "w");
+    }
+
+    if (NULL == gp_log_out)
+    {
+        if (0 <= out_fd)
+        {
+            close(out_fd);
+        }
+        gp_log_out = stderr;
+        return;
+    }
+
+    if (0 != pthread_create(&g_log_writer, NULL, aoc_log_writer, NULL))
+    {
+        return;
+    }
+
+    atomic_store(&g_b_log_async, true);
+    atexit(aoc_log_flush);
+}
+
+/**
+ * @brief Queues one record; use the AOC_LOG_* macros rather than this
+ *
+ * @param level AOC_LOG_LEVEL_ERROR to AOC_LOG_LEVEL_TRACE
+ * @param p_fmt Format string literal, taking only long arguments
+ * @param p_args AOC_LOG_ARGS arguments
+ */
+void
+aoc_log_record (int level, const char * p_fmt, const long * p_args)
+{
+    aoc_log_slot_t * p_slot   = NULL;
+    size_t           position = 0;
+    size_t           sequence = 0;
+
+    pthread_once(&g_log_once, aoc_log_start);
+
+    if (false == atomic_load_explicit(&g_b_log_async, memory_order_acquire))
+    {
+        aoc_log_write(gp_log_out, level, aoc_log_now_ns(), p_fmt, p_args);
+        return;
+    }
+
+    position = atomic_load_explicit(&g_log_tail, memory_order_relaxed);
+    for (;;)
+    {
+        p_slot   = &g_log_ring[position & (AOC_LOG_RING - 1)];
+        sequence = atomic_load_explicit(&p_slot->sequence,
+                                        memory_order_acquire);
+
+        if (sequence == position)
+        {
+            if (atomic_compare_exchange_weak_explicit(&g_log_tail,
+                                                      &position,
+                                                      position + 1,
+                                                      memory_order_relaxed,
+                                                      memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if (sequence < position)
+        {
+            // A lap behind: the writer has not freed it, the ring is full
+            atomic_fetch_add_explicit(&g_log_dropped, 1, memory_order_relaxed);
+            return;
+        }
+        else
+        {
+            position
+                = atomic_load_explicit(&g_log_tail, memory_order_relaxed);
+        }
+    }
+
+    p_slot->time_ns = aoc_log_now_ns();
+    p_slot->p_fmt   = p_fmt;
+    p_slot->level   = level;
+    for (size_t idx = 0; idx < AOC_LOG_ARGS; idx++)
+    {
+        p_slot->args[idx] = p_args[idx];
+    }
+
+    atomic_store_explicit(&p_slot->sequence, position + 1, memory_order_release);
+}
+
+/**
+ * @brief Writes out every queued record and stops the writer
+ *
+ * Runs at exit on its own. Records made afterwards are written
+ * synchronously.
+ */
+void
+aoc_log_flush (void)
+{
+    uint64_t dropped = 0;
+
+    if (false == atomic_exchange(&g_b_log_async, false))
+    {
+        return;
+    }
+
+    atomic_store_explicit(&g_b_log_stop, true, memory_order_release);
+    pthread_join(g_log_writer, NULL);
+
+    dropped = aoc_log_dropped();
+    if (0 < dropped)
+    {
+        fprintf(gp_log_out,
+                "NOTE: %llu log records dropped, the ring was full\n",
+                (unsigned long long)dropped);
+    }
+    fflush(gp_log_out);
+}
+
+/**
+ * @brief Counts the records dropped because the ring was full
+ *
+ * @return Records dropped so far
+ */
+uint64_t
+aoc_log_dropped (void)
+{
+    return atomic_load_explicit(&g_log_dropped, memory_order_relaxed);
+}
+
+/** END OF FILE **/
\ No newline at end of file
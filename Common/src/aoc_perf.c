@@ -0,0 +1,285 @@
+/**
+ * @file aoc_perf.c
+ *
+ * @brief Hardware and software performance counters for the Advent of Code
+ * 2025 challenges
+ *
+ * Cycles, instructions, cache misses, branch misses and page faults are
+ * counted in user space for the calling thread and the threads it starts,
+ * which works at the default perf_event_paranoid level. Whatever the kernel,
+ * the hypervisor or the permissions refuse is simply left out: a missing
+ * counter is reported as null and the derived figures that need it are
+ * skipped.
+ *
+ * @author Mexeck88
+ *
+ * @date 18OCT26
+ */
+
+#include <errno.h>
+#include <linux/perf_event.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include "aoc_perf.h"
+
+/**
+ * @struct aoc_perf_read_t
+ * @brief Layout of read() with the time enabled and time running fields
+ */
+typedef struct aoc_perf_read_t
+{
+    uint64_t value;
+    uint64_t time_enabled;
+    uint64_t time_running;
+} aoc_perf_read_t;
+
+/**
+ * @struct aoc_perf_event_t
+ * @brief What to ask perf_event_open for, and what to call it
+ */
+typedef struct aoc_perf_event_t
+{
+    const char * p_name;
+    uint32_t     type;
+    uint64_t     config;
+} aoc_perf_event_t;
+
+static const aoc_perf_event_t g_perf_events[AOC_PERF_COUNT] = {
+    { "cycles", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES },
+    { "instructions", PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS },
+    { "cache_misses", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES },
+    { "branch_misses", PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES },
+    { "page_faults", PERF_TYPE_SOFTWARE, PERF_COUNT_SW_PAGE_FAULTS },
+};
+
+/**
+ * @brief Opens one disabled counter on the calling thread
+ *
+ * @param p_event Counter to open
+ *
+ * @return The counter descriptor, -1 if it is unavailable
+ */
+static int
+aoc_perf_open_event (const aoc_perf_event_t * p_event)
+{
+    struct perf_event_attr attr;
+
+    memset(&attr, 0, sizeof(attr));
+    attr.size           = sizeof(attr);
+    attr.type           = p_event->type;
+    attr.config         = p_event->config;
+    attr.disabled       = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv     = 1;
+    attr.inherit        = 1; // Threads the phase starts count too
+    attr.read_format
+        = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+    return (int)syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+}
+
+/**
+ * @brief Opens every counter the system allows
+ *
+ * Lists the missing counters on stderr, on one line, so the JSON on stdout
+ * stays clean.
+ *
+ * @param p_perf Counters to open
+ *
+ * @return true if at least one counter is available
+ */
+bool
+aoc_perf_open (aoc_perf_t * p_perf)
+{
+    int error = 0;
+
+    p_perf->open_count = 0;
+
+    for (size_t idx = 0; idx < AOC_PERF_COUNT; idx++)
+    {
+        p_perf->fd[idx] = aoc_perf_open_event(&g_perf_events[idx]);
+        if (0 <= p_perf->fd[idx])
+        {
+            p_perf->open_count++;
+        }
+        else if (0 == error)
+        {
+            error = errno;
+        }
+    }
+
+    if (AOC_PERF_COUNT > p_perf->open_count)
+    {
+        fprintf(stderr, "NOTE: Counters unavailable (%s):", strerror(error));
+        for (size_t idx = 0; idx < AOC_PERF_COUNT; idx++)
+        {
+            if (0 > p_perf->fd[idx])
+            {
+                fprintf(stderr, " %s", g_perf_events[idx].p_name);
+            }
+        }
+        fprintf(stderr, "\n");
+    }
+
+    return 0 < p_perf->open_count;
+}
+
+/**
+ * @brief Zeroes and starts every open counter
+ *
+ * @param p_perf Open counters
+ */
+void
+aoc_perf_start (const aoc_perf_t * p_perf)
+{
+    for (size_t idx = 0; idx < AOC_PERF_COUNT; idx++)
+    {
+        if (0 <= p_perf->fd[idx])
+        {
+            ioctl(p_perf->fd[idx], PERF_EVENT_IOC_RESET, 0);
+            ioctl(p_perf->fd[idx], PERF_EVENT_IOC_ENABLE, 0);
+        }
+    }
+}
+
+/**
+ * @brief Stops every open counter and adds what it counted to a total
+ *
+ * A counter the kernel could only schedule part of the time is scaled up to
+ * the whole interval.
+ *
+ * @param p_perf Started counters
+ * @param p_total Totals to add to
+ */
+void
+aoc_perf_stop (const aoc_perf_t * p_perf, aoc_perf_sample_t * p_total)
+{
+    aoc_perf_read_t reading = { 0 };
+    double          scaled  = 0.0;
+
+    for (size_t idx = 0; idx < AOC_PERF_COUNT; idx++)
+    {
+        if (0 <= p_perf->fd[idx])
+        {
+            ioctl(p_perf->fd[idx], PERF_EVENT_IOC_DISABLE, 0);
+        }
+    }
+
+    for (size_t idx = 0; idx < AOC_PERF_COUNT; idx++)
+    {
+        if ((0 > p_perf->fd[idx])
+            || (sizeof(reading)
+                != (size_t)read(p_perf->fd[idx], &reading, sizeof(reading)))
+            || (0 == reading.time_running))
+        {
+            continue;
+        }
+
+        scaled = (double)reading.value;
+        if (reading.time_running < reading.time_enabled)
+        {
+            scaled *= (double)reading.time_enabled
+                    / (double)reading.time_running;
+        }
+
+        p_total->value[idx] += (uint64_t)scaled;
+    }
+}
+
+/**
+ * @brief Closes every open counter
+ *
+ * @param p_perf Counters to close
+ */
+void
+aoc_perf_close (aoc_perf_t * p_perf)
+{
+    for (size_t idx = 0; idx < AOC_PERF_COUNT; idx++)
+    {
+        if (0 <= p_perf->fd[idx])
+        {
+            close(p_perf->fd[idx]);
+            p_perf->fd[idx] = -1;
+        }
+    }
+
+    p_perf->open_count = 0;
+}
+
+/**
+ * @brief Prints the per-run mean of every counter as a JSON object
+ *
+ * Missing counters, and the derived IPC and per-byte miss rates that depend
+ * on them, are printed as null.
+ *
+ * @param p_perf Counters the totals came from
+ * @param p_total Totals over every run
+ * @param runs Runs the totals cover (> 0)
+ * @param bytes Input size, for the per-byte figures
+ */
+void
+aoc_perf_print (const aoc_perf_t *        p_perf,
+                const aoc_perf_sample_t * p_total,
+                size_t                    runs,
+                size_t                    bytes)
+{
+    double mean[AOC_PERF_COUNT] = { 0 };
+    bool   b_have[AOC_PERF_COUNT];
+
+    for (size_t idx = 0; idx < AOC_PERF_COUNT; idx++)
+    {
+        b_have[idx] = (0 <= p_perf->fd[idx]);
+        mean[idx]   = (double)p_total->value[idx] / (double)runs;
+    }
+
+    printf("{");
+    for (size_t idx = 0; idx < AOC_PERF_COUNT; idx++)
+    {
+        if (true == b_have[idx])
+        {
+            printf("\"%s\": %.1f, ", g_perf_events[idx].p_name, mean[idx]);
+        }
+        else
+        {
+            printf("\"%s\": null, ", g_perf_events[idx].p_name);
+        }
+    }
+
+    if ((true == b_have[AOC_PERF_CYCLES])
+        && (true == b_have[AOC_PERF_INSTRUCTIONS])
+        && (0.0 < mean[AOC_PERF_CYCLES]))
+    {
+        printf("\"ipc\": %.3f, ",
+               mean[AOC_PERF_INSTRUCTIONS] / mean[AOC_PERF_CYCLES]);
+    }
+    else
+    {
+        printf("\"ipc\": null, ");
+    }
+
+    if ((true == b_have[AOC_PERF_CACHE_MISSES]) && (0 < bytes))
+    {
+        printf("\"cache_misses_per_byte\": %.6f, ",
+               mean[AOC_PERF_CACHE_MISSES] / (double)bytes);
+    }
+    else
+    {
+        printf("\"cache_misses_per_byte\": null, ");
+    }
+
+    if ((true == b_have[AOC_PERF_BRANCH_MISSES]) && (0 < bytes))
+    {
+        printf("\"branch_misses_per_byte\": %.6f}",
+               mean[AOC_PERF_BRANCH_MISSES] / (double)bytes);
+    }
+    else
+    {
+        printf("\"branch_misses_per_byte\": null}");
+    }
+}
+
+/** END OF FILE **/
\ No newline at end of file
@@ -0,0 +1,691 @@
+/**
+ * @file aoc_pipe.c
+ *
+ * @brief Three-stage reader / parser / solver pipeline
+ *
+ * A reader thread fills fixed-size buffers with read(), a parser thread cuts
+ * them into tokens and lets the challenge pack each token into records, and
+ * the calling thread solves batches of records as they arrive. So I/O,
+ * parsing and solving overlap, and stdin never has to be held whole.
+ *
+ * Buffers circulate between neighbouring stages over pairs of SPSC rings:
+ * one carries filled buffers forward, the other hands empty ones back. A
+ * stage that runs ahead waits for an empty buffer, which bounds memory to the
+ * two pools. A NULL item ends the stream, and any failure raises a shared
+ * stop flag that wakes every waiting stage.
+ *
+ * @author Mexeck88
+ *
+ * @date 18OCT26
+ */
+
+#define _GNU_SOURCE // posix_fadvise
+
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "aoc_pipe.h"
+
+/**
+ * @struct aoc_pipe_chunk_t
+ * @brief One read() buffer
+ */
+typedef struct aoc_pipe_chunk_t
+{
+    char * p_data; // AOC_PIPE_CHUNK bytes
+    size_t length; // Bytes read into it
+} aoc_pipe_chunk_t;
+
+/**
+ * @struct aoc_pipe_state_t
+ * @brief Everything the three stages share
+ */
+typedef struct aoc_pipe_state_t
+{
+    const aoc_pipe_t * p_pipe;
+    int                fd;
+    aoc_spsc_t         full_chunks;  // Reader to parser
+    aoc_spsc_t         free_chunks;  // Parser back to reader
+    aoc_spsc_t         full_batches; // Parser to solver
+    aoc_spsc_t         free_batches; // Solver back to parser
+    atomic_bool        b_stop;       // A stage failed, everyone winds down
+    aoc_pipe_chunk_t   chunks[AOC_PIPE_CHUNKS];
+    aoc_pipe_batch_t   batches[AOC_PIPE_BATCHES];
+    char *             p_chunk_block; // Backing memory of every chunk
+    char *             p_carry;       // Token cut in two by a chunk boundary
+    size_t             carry_length;
+    size_t             carry_capacity;
+    bool               b_delim[UCHAR_MAX + 1];
+} aoc_pipe_state_t;
+
+/**
+ * @brief Empties a ring
+ *
+ * @param p_queue Ring to initialize
+ */
+void
+aoc_spsc_init (aoc_spsc_t * p_queue)
+{
+    atomic_init(&p_queue->head, 0);
+    atomic_init(&p_queue->tail, 0);
+}
+
+/**
+ * @brief Appends an item; producer side only
+ *
+ * @param p_queue Ring to push to
+ * @param p_item Item to append
+ *
+ * @return true if pushed, false if the ring is full
+ */
+bool
+aoc_spsc_push (aoc_spsc_t * p_queue, void * p_item)
+{
+    size_t tail = atomic_load_explicit(&p_queue->tail, memory_order_relaxed);
+    size_t head = atomic_load_explicit(&p_queue->head, memory_order_acquire);
+
+    if (AOC_PIPE_QUEUE == (tail - head))
+    {
+        return false;
+    }
+
+    p_queue->p_slots[tail & (AOC_PIPE_QUEUE - 1)] = p_item;
+    atomic_store_explicit(&p_queue->tail, tail + 1, memory_order_release);
+    return true;
+}
+
+/**
+ * @brief Removes the oldest item; consumer side only
+ *
+ * @param p_queue Ring to pop from
+ * @param pp_item Receives the item
+ *
+ * @return true if popped, false if the ring is empty
+ */
+bool
+aoc_spsc_pop (aoc_spsc_t * p_queue, void ** pp_item)
+{
+    size_t head = atomic_load_explicit(&p_queue->head, memory_order_relaxed);
+    size_t tail = atomic_load_explicit(&p_queue->tail, memory_order_acquire);
+
+    if (head == tail)
+    {
+        return false;
+    }
+
+    *pp_item = p_queue->p_slots[head & (AOC_PIPE_QUEUE - 1)];
+    atomic_store_explicit(&p_queue->head, head + 1, memory_order_release);
+    return true;
+}
+
+/**
+ * @brief Backs off while a stage waits on a ring: yields first, then naps
+ *
+ * @param p_spins Waits so far, updated
+ */
+static void
+aoc_pipe_wait (size_t * p_spins)
+{
+    struct timespec nap = { 0, AOC_PIPE_NAP };
+
+    if (AOC_PIPE_SPIN > *p_spins)
+    {
+        (*p_spins)++;
+        sched_yield();
+    }
+    else
+    {
+        nanosleep(&nap, NULL);
+    }
+}
+
+/**
+ * @brief Pushes an item, waiting while the ring is full
+ *
+ * @param p_state Pipeline state
+ * @param p_queue Ring to push to
+ * @param p_item Item to append
+ *
+ * @return true if pushed, false if the pipeline was stopped
+ */
+static bool
+aoc_pipe_push (aoc_pipe_state_t * p_state, aoc_spsc_t * p_queue, void * p_item)
+{
+    size_t spins = 0;
+
+    while (false == aoc_spsc_push(p_queue, p_item))
+    {
+        if (true == atomic_load_explicit(&p_state->b_stop, memory_order_relaxed))
+        {
+            return false;
+        }
+        aoc_pipe_wait(&spins);
+    }
+
+    return true;
+}
+
+/**
+ * @brief Pops an item, waiting while the ring is empty
+ *
+ * @param p_state Pipeline state
+ * @param p_queue Ring to pop from
+ * @param pp_item Receives the item, NULL at the end of the stream
+ *
+ * @return true if popped, false if the pipeline was stopped
+ */
+static bool
+aoc_pipe_pop (aoc_pipe_state_t * p_state, aoc_spsc_t * p_queue, void ** pp_item)
+{
+    size_t spins = 0;
+
+    while (false == aoc_spsc_pop(p_queue, pp_item))
+    {
+        if (true == atomic_load_explicit(&p_state->b_stop, memory_order_relaxed))
+        {
+            return false;
+        }
+        aoc_pipe_wait(&spins);
+    }
+
+    return true;
+}
+
+/**
+ * @brief Raises the stop flag so every stage winds down
+ *
+ * @param p_state Pipeline state
+ */
+static void
+aoc_pipe_stop (aoc_pipe_state_t * p_state)
+{
+    atomic_store_explicit(&p_state->b_stop, true, memory_order_relaxed);
+}
+
+/**
+ * @brief Reader stage: reads the input into empty chunks until EOF
+ *
+ * @param p_arg Pipeline state
+ *
+ * @return NULL
+ */
+static void *
+aoc_pipe_reader (void * p_arg)
+{
+    aoc_pipe_state_t * p_state = p_arg;
+    aoc_pipe_chunk_t * p_chunk = NULL;
+    ssize_t            length  = 0;
+
+    for (;;)
+    {
+        if (false
+            == aoc_pipe_pop(p_state, &p_state->free_chunks, (void **)&p_chunk))
+        {
+            break;
+        }
+
+        do
+        {
+            length = read(p_state->fd, p_chunk->p_data, AOC_PIPE_CHUNK);
+        } while ((0 > length) && (EINTR == errno));
+
+        if (0 > length)
+        {
+            perror("ERROR: Unable to read input");
+            aoc_pipe_stop(p_state);
+            break;
+        }
+
+        // End of the input: the unused chunk stays behind
+        if (0 == length)
+        {
+            aoc_pipe_push(p_state, &p_state->full_chunks, NULL);
+            break;
+        }
+
+        p_chunk->length = (size_t)length;
+        if (false == aoc_pipe_push(p_state, &p_state->full_chunks, p_chunk))
+        {
+            break;
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Reserves room for one record in the batch being filled
+ *
+ * A full batch goes to the solver and an empty one takes its place, which
+ * waits if the solver is behind. A record larger than a whole batch grows
+ * the batch.
+ *
+ * @param p_out Parser output handed to the parse callback
+ * @param size Bytes of the record
+ *
+ * @return Where to write the record, NULL if the pipeline is stopping
+ */
+void *
+aoc_pipe_emit (aoc_pipe_out_t * p_out, size_t size)
+{
+    aoc_pipe_state_t * p_state  = p_out->p_state;
+    aoc_pipe_batch_t * p_batch  = p_out->p_batch;
+    uint8_t *          p_record = NULL;
+    uint8_t *          p_temp   = NULL;
+
+    if (size > (p_batch->capacity - p_batch->used))
+    {
+        if (0 < p_batch->count)
+        {
+            if ((false
+                 == aoc_pipe_push(p_state, &p_state->full_batches, p_batch))
+                || (false
+                    == aoc_pipe_pop(p_state,
+                                    &p_state->free_batches,
+                                    (void **)&p_out->p_batch)))
+            {
+                return NULL;
+            }
+
+            p_batch        = p_out->p_batch;
+            p_batch->used  = 0;
+            p_batch->count = 0;
+        }
+
+        if (size > p_batch->capacity)
+        {
+            p_temp = realloc(p_batch->p_data, size);
+            if (NULL == p_temp)
+            {
+                perror("ERROR: Unable to grow record batch");
+                aoc_pipe_stop(p_state);
+                return NULL;
+            }
+            p_batch->p_data   = p_temp;
+            p_batch->capacity = size;
+        }
+    }
+
+    p_record = p_batch->p_data + p_batch->used;
+    p_batch->used += size;
+    p_batch->count++;
+
+    return p_record;
+}
+
+/**
+ * @brief Appends the part of a token found in one chunk to the carry buffer
+ *
+ * @param p_state Pipeline state
+ * @param p_data Bytes to append
+ * @param length Number of bytes
+ *
+ * @return true on success, false if the buffer cannot grow
+ */
+static bool
+aoc_pipe_carry (aoc_pipe_state_t * p_state, const char * p_data, size_t length)
+{
+    size_t capacity = p_state->carry_capacity;
+    char * p_temp   = NULL;
+
+    if (length > (capacity - p_state->carry_length))
+    {
+        capacity = (0 == capacity) ? AOC_PIPE_BATCH : capacity;
+        while (length > (capacity - p_state->carry_length))
+        {
+            capacity *= 2;
+        }
+
+        p_temp = realloc(p_state->p_carry, capacity);
+        if (NULL == p_temp)
+        {
+            perror("ERROR: Unable to grow token carry buffer");
+            return false;
+        }
+        p_state->p_carry        = p_temp;
+        p_state->carry_capacity = capacity;
+    }
+
+    memcpy(p_state->p_carry + p_state->carry_length, p_data, length);
+    p_state->carry_length += length;
+    return true;
+}
+
+/**
+ * @brief Hands one token to the parse callback, completing a carried one
+ *
+ * @param p_state Pipeline state
+ * @param p_out Parser output
+ * @param p_data Start of the token's bytes in the current chunk
+ * @param length Bytes of the token in the current chunk
+ *
+ * @return true on success, false on failure
+ */
+static bool
+aoc_pipe_token (aoc_pipe_state_t * p_state,
+                aoc_pipe_out_t *   p_out,
+                const char *       p_data,
+                size_t             length)
+{
+    aoc_view_t token = { p_data, length };
+
+    if (0 < p_state->carry_length)
+    {
+        if ((0 < length) && (false == aoc_pipe_carry(p_state, p_data, length)))
+        {
+            return false;
+        }
+
+        token.p_data          = p_state->p_carry;
+        token.length          = p_state->carry_length;
+        p_state->carry_length = 0;
+    }
+
+    if (0 == token.length)
+    {
+        return true;
+    }
+
+    return (AOC_SUCCESS
+            == p_state->p_pipe->p_parse(p_state->p_pipe->p_ctx, token, p_out));
+}
+
+/**
+ * @brief Parser stage: cuts chunks into tokens and batches their records
+ *
+ * @param p_arg Pipeline state
+ *
+ * @return NULL
+ */
+static void *
+aoc_pipe_parser (void * p_arg)
+{
+    aoc_pipe_state_t * p_state = p_arg;
+    aoc_pipe_chunk_t * p_chunk = NULL;
+    aoc_pipe_out_t     out     = { p_state, NULL };
+    size_t             start   = 0;
+
+    if (false
+        == aoc_pipe_pop(p_state, &p_state->free_batches, (void **)&out.p_batch))
+    {
+        goto EXIT;
+    }
+
+    out.p_batch->used  = 0;
+    out.p_batch->count = 0;
+
+    for (;;)
+    {
+        if (false
+            == aoc_pipe_pop(p_state, &p_state->full_chunks, (void **)&p_chunk))
+        {
+            goto EXIT;
+        }
+
+        // End of the input, which may end without a delimiter
+        if (NULL == p_chunk)
+        {
+            break;
+        }
+
+        start = 0;
+        for (size_t idx = 0; idx < p_chunk->length; idx++)
+        {
+            if (true == p_state->b_delim[(unsigned char)p_chunk->p_data[idx]])
+            {
+                if (false
+                    == aoc_pipe_token(p_state,
+                                      &out,
+                                      p_chunk->p_data + start,
+                                      idx - start))
+                {
+                    goto FAIL;
+                }
+                start = idx + 1;
+            }
+        }
+
+        // The chunk ends inside a token: keep its start for the next one
+        if ((start < p_chunk->length)
+            && (false
+                == aoc_pipe_carry(p_state,
+                                  p_chunk->p_data + start,
+                                  p_chunk->length - start)))
+        {
+            goto FAIL;
+        }
+
+        if (false == aoc_pipe_push(p_state, &p_state->free_chunks, p_chunk))
+        {
+            goto EXIT;
+        }
+    }
+
+    if (false == aoc_pipe_token(p_state, &out, NULL, 0))
+    {
+        goto FAIL;
+    }
+
+    if ((0 < out.p_batch->count)
+        && (false == aoc_pipe_push(p_state, &p_state->full_batches, out.p_batch)))
+    {
+        goto EXIT;
+    }
+
+    aoc_pipe_push(p_state, &p_state->full_batches, NULL);
+    goto EXIT;
+
+FAIL:
+    aoc_pipe_stop(p_state);
+EXIT:
+    return NULL;
+}
+
+/**
+ * @brief Allocates the buffer pools and fills the empty-buffer rings
+ *
+ * @param p_state Pipeline state, zeroed
+ *
+ * @return AOC_SUCCESS on success, AOC_FAILURE on failure
+ */
+static uint8_t
+aoc_pipe_alloc (aoc_pipe_state_t * p_state)
+{
+    uint8_t retcode = AOC_FAILURE;
+
+    aoc_spsc_init(&p_state->full_chunks);
+    aoc_spsc_init(&p_state->free_chunks);
+    aoc_spsc_init(&p_state->full_batches);
+    aoc_spsc_init(&p_state->free_batches);
+    atomic_init(&p_state->b_stop, false);
+
+    p_state->p_chunk_block = malloc((size_t)AOC_PIPE_CHUNKS * AOC_PIPE_CHUNK);
+    if (NULL == p_state->p_chunk_block)
+    {
+        perror("ERROR: Unable to allocate read buffers");
+        goto EXIT;
+    }
+
+    for (size_t idx = 0; idx < AOC_PIPE_CHUNKS; idx++)
+    {
+        p_state->chunks[idx].p_data
+            = p_state->p_chunk_block + (idx * AOC_PIPE_CHUNK);
+        aoc_spsc_push(&p_state->free_chunks, &p_state->chunks[idx]);
+    }
+
+    for (size_t idx = 0; idx < AOC_PIPE_BATCHES; idx++)
+    {
+        p_state->batches[idx].p_data = malloc(AOC_PIPE_BATCH);
+        if (NULL == p_state->batches[idx].p_data)
+        {
+            perror("ERROR: Unable to allocate record batches");
+            goto EXIT;
+        }
+        p_state->batches[idx].capacity = AOC_PIPE_BATCH;
+        aoc_spsc_push(&p_state->free_batches, &p_state->batches[idx]);
+    }
+
+    for (const char * p_delim = p_state->p_pipe->p_delims; '\0' != *p_delim;
+         p_delim++)
+    {
+        p_state->b_delim[(unsigned char)*p_delim] = true;
+    }
+
+    retcode = AOC_SUCCESS;
+EXIT:
+    return retcode;
+}
+
+/**
+ * @brief Releases the buffer pools
+ *
+ * @param p_state Pipeline state
+ */
+static void
+aoc_pipe_free (aoc_pipe_state_t * p_state)
+{
+    for (size_t idx = 0; idx < AOC_PIPE_BATCHES; idx++)
+    {
+        free(p_state->batches[idx].p_data);
+    }
+
+    free(p_state->p_chunk_block);
+    free(p_state->p_carry);
+}
+
+/**
+ * @brief Streams an input through the reader, parser and solver stages
+ *
+ * The reader and parser get threads of their own; the solver callback runs
+ * on the caller's thread, once per batch in input order.
+ *
+ * @param p_pipe Input, delimiters and callbacks
+ *
+ * @return AOC_SUCCESS if every stage finished, AOC_FAILURE otherwise
+ */
+uint8_t
+aoc_pipe_run (const aoc_pipe_t * p_pipe)
+{
+    uint8_t            retcode     = AOC_FAILURE;
+    aoc_pipe_state_t * p_state     = NULL;
+    aoc_pipe_batch_t * p_batch     = NULL;
+    bool               b_reader    = false;
+    bool               b_parser    = false;
+    pthread_t          reader;
+    pthread_t          parser;
+
+    if ((NULL == p_pipe) || (NULL == p_pipe->p_file_path)
+        || (NULL == p_pipe->p_delims) || (NULL == p_pipe->p_parse)
+        || (NULL == p_pipe->p_solve))
+    {
+        printf("ERROR: NULL pointer passed to pipe_run\n");
+        goto EXIT;
+    }
+
+    // Large enough (rings and delimiter table) to keep off the stack
+    p_state = calloc(1, sizeof(*p_state));
+    if (NULL == p_state)
+    {
+        perror("ERROR: Unable to allocate pipeline");
+        goto EXIT;
+    }
+
+    p_state->p_pipe = p_pipe;
+    p_state->fd     = -1;
+
+    if (AOC_SUCCESS != aoc_pipe_alloc(p_state))
+    {
+        goto CLEAN;
+    }
+
+    if (0 == strcmp(p_pipe->p_file_path, "-"))
+    {
+        p_state->fd = STDIN_FILENO;
+    }
+    else
+    {
+        p_state->fd = open(p_pipe->p_file_path, O_RDONLY);
+        if (0 > p_state->fd)
+        {
+            printf("ERROR: Unable to open file %s\n", p_pipe->p_file_path);
+            goto CLEAN;
+        }
+        posix_fadvise(p_state->fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+    }
+
+    b_reader = (0 == pthread_create(&reader, NULL, aoc_pipe_reader, p_state));
+    b_parser = (true == b_reader)
+               && (0 == pthread_create(&parser, NULL, aoc_pipe_parser, p_state));
+    if (false == b_parser)
+    {
+        perror("ERROR: Unable to start pipeline threads");
+        aoc_pipe_stop(p_state);
+        goto JOIN;
+    }
+
+    // Solver stage
+    for (;;)
+    {
+        if (false
+            == aoc_pipe_pop(p_state, &p_state->full_batches, (void **)&p_batch))
+        {
+            goto JOIN;
+        }
+
+        if (NULL == p_batch)
+        {
+            break;
+        }
+
+        if (AOC_SUCCESS != p_pipe->p_solve(p_pipe->p_ctx, p_batch))
+        {
+            aoc_pipe_stop(p_state);
+            goto JOIN;
+        }
+
+        if (false == aoc_pipe_push(p_state, &p_state->free_batches, p_batch))
+        {
+            goto JOIN;
+        }
+    }
+
+    retcode = AOC_SUCCESS;
+
+JOIN:
+    if (true == b_parser)
+    {
+        pthread_join(parser, NULL);
+    }
+
+    if (true == b_reader)
+    {
+        pthread_join(reader, NULL);
+    }
+
+    // The reader and parser end their streams before they finish
+    if (true == atomic_load(&p_state->b_stop))
+    {
+        retcode = AOC_FAILURE;
+    }
+
+CLEAN:
+    if ((0 <= p_state->fd) && (STDIN_FILENO != p_state->fd))
+    {
+        close(p_state->fd);
+    }
+
+    aoc_pipe_free(p_state);
+    free(p_state);
+EXIT:
+    return retcode;
+}
+
+/** END OF FILE **/
\ No newline at end of file
@@ -0,0 +1,702 @@
+/**
+ * @file aoc_pool.c
+ *
+ * @brief Work-stealing thread pool for the Advent of Code 2025 challenges
+ *
+ * Any thread can hand the pool a parallel-for over an index range. The job
+ * goes into a small submission queue, a worker picks it up as one task, and
+ * the submitter sleeps until every index has run.
+ *
+ * Each worker owns a Chase-Lev deque. Ranges are split lazily: a worker cuts
+ * its range in half and pushes the upper half only while its own deque is
+ * empty, then runs the lower half grain by grain, checking again between
+ * chunks. A busy pool therefore runs few, large chunks, and an idle thief
+ * that empties a deque makes its owner split again. Workers that find
+ * nothing to run or steal yield for a while, then sleep until new work
+ * arrives.
+ *
+ * @author Mexeck88
+ *
+ * @date 18OCT26
+ */
+
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "aoc_input.h"
+#include "aoc_pool.h"
+
+/**
+ * @struct aoc_pool_partial_t
+ * @brief One worker's running reduction, alone on its cache line
+ */
+typedef struct aoc_pool_partial_t
+{
+    _Alignas(AOC_POOL_CACHE_LINE) int64_t value;
+} aoc_pool_partial_t;
+
+/**
+ * @struct aoc_pool_reduction_t
+ * @brief A reduction expressed as a parallel-for
+ */
+typedef struct aoc_pool_reduction_t
+{
+    aoc_pool_map_fn_t     p_map;
+    aoc_pool_combine_fn_t p_combine;
+    void *                p_ctx;
+    aoc_pool_partial_t *  p_partials; // One per worker
+} aoc_pool_reduction_t;
+
+static _Thread_local aoc_pool_worker_t * gp_pool_self; // NULL off the pool
+static aoc_pool_t                         g_pool_shared;
+static aoc_pool_t *                       gp_pool_shared;
+static pthread_once_t                     g_pool_once = PTHREAD_ONCE_INIT;
+
+/**
+ * @brief Pushes a task on the owner's end of a deque
+ *
+ * @param p_deque Deque owned by the calling worker
+ * @param p_task Task to push
+ *
+ * @return true if pushed, false if the deque is full
+ */
+static bool
+aoc_pool_push (aoc_pool_deque_t * p_deque, const aoc_pool_task_t * p_task)
+{
+    long bottom = atomic_load_explicit(&p_deque->bottom, memory_order_relaxed);
+    long top    = atomic_load_explicit(&p_deque->top, memory_order_acquire);
+
+    if (AOC_POOL_DEQUE <= (bottom - top))
+    {
+        return false;
+    }
+
+    p_deque->tasks[bottom & (AOC_POOL_DEQUE - 1)] = *p_task;
+
+    // Publish the slot before the new bottom
+    atomic_thread_fence(memory_order_release);
+    atomic_store_explicit(&p_deque->bottom, bottom + 1, memory_order_relaxed);
+    return true;
+}
+
+/**
+ * @brief Takes the newest task from the owner's end of a deque
+ *
+ * @param p_deque Deque owned by the calling worker
+ * @param p_task Receives the task
+ *
+ * @return true if a task was taken, false if the deque was empty
+ */
+static bool
+aoc_pool_take (aoc_pool_deque_t * p_deque, aoc_pool_task_t * p_task)
+{
+    bool b_found = true;
+    long top     = 0;
+    long bottom
+        = atomic_load_explicit(&p_deque->bottom, memory_order_relaxed) - 1;
+
+    atomic_store_explicit(&p_deque->bottom, bottom, memory_order_relaxed);
+    atomic_thread_fence(memory_order_seq_cst);
+    top = atomic_load_explicit(&p_deque->top, memory_order_relaxed);
+
+    if (top > bottom)
+    {
+        atomic_store_explicit(&p_deque->bottom, bottom + 1, memory_order_relaxed);
+        return false;
+    }
+
+    *p_task = p_deque->tasks[bottom & (AOC_POOL_DEQUE - 1)];
+
+    // Last task: race the thieves for it
+    if (top == bottom)
+    {
+        b_found = atomic_compare_exchange_strong_explicit(&p_deque->top,
+                                                          &top,
+                                                          top + 1,
+                                                          memory_order_seq_cst,
+                                                          memory_order_relaxed);
+        atomic_store_explicit(&p_deque->bottom, bottom + 1, memory_order_relaxed);
+    }
+
+    return b_found;
+}
+
+/**
+ * @brief Steals the oldest task from the far end of another worker's deque
+ *
+ * @param p_deque Victim deque
+ * @param p_task Receives the task
+ *
+ * @return true if a task was stolen, false if empty or lost a race
+ */
+static bool
+aoc_pool_steal (aoc_pool_deque_t * p_deque, aoc_pool_task_t * p_task)
+{
+    long top    = atomic_load_explicit(&p_deque->top, memory_order_acquire);
+    long bottom = 0;
+
+    atomic_thread_fence(memory_order_seq_cst);
+    bottom = atomic_load_explicit(&p_deque->bottom, memory_order_acquire);
+
+    if (top >= bottom)
+    {
+        return false;
+    }
+
+    *p_task = p_deque->tasks[top & (AOC_POOL_DEQUE - 1)];
+
+    return atomic_compare_exchange_strong_explicit(&p_deque->top,
+                                                   &top,
+                                                   top + 1,
+                                                   memory_order_seq_cst,
+                                                   memory_order_relaxed);
+}
+
+/**
+ * @brief Counts indices of a job as run, waking its submitter after the last
+ *
+ * @param p_pool Pool running the job
+ * @param p_job Job the indices belong to
+ * @param count Indices just run
+ */
+static void
+aoc_pool_finish (aoc_pool_t * p_pool, aoc_pool_job_t * p_job, size_t count)
+{
+    if (count
+        == atomic_fetch_sub_explicit(&p_job->remaining, count, memory_order_acq_rel))
+    {
+        // The submitter cannot return before the lock is released
+        pthread_mutex_lock(&p_pool->lock);
+        p_job->b_done = true;
+        pthread_cond_broadcast(&p_pool->done);
+        pthread_mutex_unlock(&p_pool->lock);
+    }
+}
+
+/**
+ * @brief Runs a task, splitting it lazily while the worker's deque is empty
+ *
+ * @param p_worker Calling worker
+ * @param p_task Task to run
+ */
+static void
+aoc_pool_run (aoc_pool_worker_t * p_worker, const aoc_pool_task_t * p_task)
+{
+    aoc_pool_t *     p_pool = p_worker->p_pool;
+    aoc_pool_job_t * p_job  = p_task->p_job;
+    aoc_pool_task_t  half   = { p_job, 0, 0 };
+    size_t           begin  = p_task->begin;
+    size_t           end    = p_task->end;
+    size_t           step   = 0;
+    long             queued = 0;
+
+    while (begin < end)
+    {
+        queued = atomic_load_explicit(&p_worker->deque.bottom, memory_order_relaxed)
+                 - atomic_load_explicit(&p_worker->deque.top, memory_order_relaxed);
+
+        // Nothing left for thieves: offer them the upper half
+        if (((end - begin) > p_job->grain) && (0 >= queued))
+        {
+            half.begin = begin + ((end - begin) / 2);
+            half.end   = end;
+            if (true == aoc_pool_push(&p_worker->deque, &half))
+            {
+                end = half.begin;
+
+                if (0 < atomic_load_explicit(&p_pool->sleepers, memory_order_relaxed))
+                {
+                    pthread_mutex_lock(&p_pool->lock);
+                    pthread_cond_signal(&p_pool->wake);
+                    pthread_mutex_unlock(&p_pool->lock);
+                }
+                continue;
+            }
+        }
+
+        step = ((end - begin) < p_job->grain) ? (end - begin) : p_job->grain;
+        p_job->p_fn(p_job->p_ctx, begin, begin + step, p_worker->index);
+        atomic_fetch_add_explicit(&p_worker->chunks, 1, memory_order_relaxed);
+
+        begin += step;
+        aoc_pool_finish(p_pool, p_job, step);
+    }
+}
+
+/**
+ * @brief Tries every other worker's deque once, from a random victim
+ *
+ * @param p_worker Calling worker
+ * @param p_task Receives the stolen task
+ *
+ * @return true if a task was stolen
+ */
+static bool
+aoc_pool_steal_any (aoc_pool_worker_t * p_worker, aoc_pool_task_t * p_task)
+{
+    aoc_pool_t * p_pool = p_worker->p_pool;
+    int          victim = 0;
+
+    // xorshift64
+    p_worker->seed ^= p_worker->seed << 13;
+    p_worker->seed ^= p_worker->seed >> 7;
+    p_worker->seed ^= p_worker->seed << 17;
+    victim = (int)(p_worker->seed % (uint64_t)p_pool->worker_count);
+
+    for (int idx = 0; idx < p_pool->worker_count; idx++)
+    {
+        victim = (victim + 1) % p_pool->worker_count;
+        if ((victim != p_worker->index)
+            && (true
+                == aoc_pool_steal(&p_pool->p_workers[victim].deque, p_task)))
+        {
+            atomic_fetch_add_explicit(&p_worker->steals, 1, memory_order_relaxed);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * @brief Picks up the oldest submitted job as a task over its whole range
+ *
+ * @param p_pool Pool to take from
+ * @param p_task Receives the task
+ *
+ * @return true if a job was waiting
+ */
+static bool
+aoc_pool_dequeue (aoc_pool_t * p_pool, aoc_pool_task_t * p_task)
+{
+    aoc_pool_job_t * p_job = NULL;
+
+    if (0 == atomic_load_explicit(&p_pool->queued, memory_order_relaxed))
+    {
+        return false;
+    }
+
+    pthread_mutex_lock(&p_pool->lock);
+    p_job = p_pool->p_head;
+    if (NULL != p_job)
+    {
+        p_pool->p_head = p_job->p_next;
+        if (NULL == p_pool->p_head)
+        {
+            p_pool->p_tail = NULL;
+        }
+        atomic_fetch_sub_explicit(&p_pool->queued, 1, memory_order_relaxed);
+    }
+    pthread_mutex_unlock(&p_pool->lock);
+
+    if (NULL == p_job)
+    {
+        return false;
+    }
+
+    p_task->p_job = p_job;
+    p_task->begin = p_job->begin;
+    p_task->end   = p_job->end;
+    return true;
+}
+
+/**
+ * @brief Worker thread: own deque, then steals, then submitted jobs, then
+ * sleep
+ *
+ * @param p_arg The worker
+ *
+ * @return NULL
+ */
+static void *
+aoc_pool_worker (void * p_arg)
+{
+    aoc_pool_worker_t * p_worker = p_arg;
+    aoc_pool_t *        p_pool   = p_worker->p_pool;
+    aoc_pool_task_t     task;
+    size_t              spins    = 0;
+
+    gp_pool_self = p_worker;
+
+    while (false == atomic_load_explicit(&p_pool->b_stop, memory_order_relaxed))
+    {
+        if ((true == aoc_pool_take(&p_worker->deque, &task))
+            || (true == aoc_pool_steal_any(p_worker, &task))
+            || (true == aoc_pool_dequeue(p_pool, &task)))
+        {
+            aoc_pool_run(p_worker, &task);
+            spins = 0;
+            continue;
+        }
+
+        if (AOC_POOL_SPIN > spins)
+        {
+            spins++;
+            sched_yield();
+            continue;
+        }
+
+        // Submissions are checked under the lock, so none is missed; a
+        // missed split only costs parallelism, its owner still runs it
+        pthread_mutex_lock(&p_pool->lock);
+        if ((false == atomic_load(&p_pool->b_stop))
+            && (0 == atomic_load(&p_pool->queued)))
+        {
+            atomic_fetch_add(&p_pool->sleepers, 1);
+            pthread_cond_wait(&p_pool->wake, &p_pool->lock);
+            atomic_fetch_sub(&p_pool->sleepers, 1);
+        }
+        pthread_mutex_unlock(&p_pool->lock);
+        spins = 0;
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Starts a pool
+ *
+ * @param p_pool Pool to initialize
+ * @param worker_count Worker threads, clamped to 1 - AOC_POOL_MAX
+ *
+ * @return AOC_SUCCESS on success, AOC_FAILURE on failure
+ */
+uint8_t
+aoc_pool_create (aoc_pool_t * p_pool, int worker_count)
+{
+    uint8_t retcode = AOC_FAILURE;
+    int     started = 0;
+
+    if (NULL == p_pool)
+    {
+        printf("ERROR: NULL pointer passed to pool_create\n");
+        goto EXIT;
+    }
+
+    memset(p_pool, 0, sizeof(*p_pool));
+    worker_count = (1 > worker_count) ? 1 : worker_count;
+    worker_count = (AOC_POOL_MAX < worker_count) ? AOC_POOL_MAX : worker_count;
+
+    p_pool->p_workers
+        = aligned_alloc(AOC_POOL_CACHE_LINE,
+                        (size_t)worker_count * sizeof(aoc_pool_worker_t));
+    if (NULL == p_pool->p_workers)
+    {
+        perror("ERROR: Unable to allocate pool workers");
+        goto EXIT;
+    }
+
+    memset(p_pool->p_workers, 0, (size_t)worker_count * sizeof(aoc_pool_worker_t));
+    p_pool->worker_count = worker_count;
+    pthread_mutex_init(&p_pool->lock, NULL);
+    pthread_cond_init(&p_pool->wake, NULL);
+    pthread_cond_init(&p_pool->done, NULL);
+
+    for (started = 0; started < worker_count; started++)
+    {
+        p_pool->p_workers[started].p_pool = p_pool;
+        p_pool->p_workers[started].index  = started;
+        p_pool->p_workers[started].seed   = (uint64_t)started + 1;
+
+        if (0
+            != pthread_create(&p_pool->p_workers[started].thread,
+                              NULL,
+                              aoc_pool_worker,
+                              &p_pool->p_workers[started]))
+        {
+            perror("ERROR: Unable to start pool worker");
+            p_pool->worker_count = started;
+            aoc_pool_destroy(p_pool);
+            goto EXIT;
+        }
+    }
+
+    retcode = AOC_SUCCESS;
+EXIT:
+    return retcode;
+}
+
+/**
+ * @brief Stops and joins every worker, then releases the pool
+ *
+ * No parallel-for may be running on the pool.
+ *
+ * @param p_pool Pool to release
+ */
+void
+aoc_pool_destroy (aoc_pool_t * p_pool)
+{
+    if ((NULL == p_pool) || (NULL == p_pool->p_workers))
+    {
+        return;
+    }
+
+    pthread_mutex_lock(&p_pool->lock);
+    atomic_store(&p_pool->b_stop, true);
+    pthread_cond_broadcast(&p_pool->wake);
+    pthread_mutex_unlock(&p_pool->lock);
+
+    for (int idx = 0; idx < p_pool->worker_count; idx++)
+    {
+        pthread_join(p_pool->p_workers[idx].thread, NULL);
+    }
+
+    pthread_cond_destroy(&p_pool->done);
+    pthread_cond_destroy(&p_pool->wake);
+    pthread_mutex_destroy(&p_pool->lock);
+    free(p_pool->p_workers);
+    p_pool->p_workers = NULL;
+}
+
+/**
+ * @brief Stops the shared pool at exit
+ */
+static void
+aoc_pool_shared_stop (void)
+{
+    aoc_pool_destroy(gp_pool_shared);
+}
+
+/**
+ * @brief Starts the shared pool: AOC_THREADS workers, else one per CPU
+ */
+static void
+aoc_pool_shared_start (void)
+{
+    const char * p_env   = getenv(AOC_POOL_ENV);
+    long         workers = (NULL != p_env) ? atol(p_env) : 0;
+
+    if (0 >= workers)
+    {
+        workers = sysconf(_SC_NPROCESSORS_ONLN);
+    }
+
+    if (AOC_SUCCESS == aoc_pool_create(&g_pool_shared, (int)workers))
+    {
+        gp_pool_shared = &g_pool_shared;
+        atexit(aoc_pool_shared_stop);
+    }
+}
+
+/**
+ * @brief Returns the process-wide pool, started on first use
+ *
+ * Every challenge linked into one process shares it.
+ *
+ * @return The shared pool, NULL if it could not start (callers then run
+ * serially)
+ */
+aoc_pool_t *
+aoc_pool_shared (void)
+{
+    pthread_once(&g_pool_once, aoc_pool_shared_start);
+    return gp_pool_shared;
+}
+
+/**
+ * @brief Number of workers, and so of distinct worker indices
+ *
+ * @param p_pool Pool, NULL meaning serial
+ *
+ * @return Worker count, at least 1
+ */
+int
+aoc_pool_size (const aoc_pool_t * p_pool)
+{
+    return (NULL == p_pool) ? 1 : p_pool->worker_count;
+}
+
+/**
+ * @brief Runs p_fn over [begin, end) in chunks on the pool and waits
+ *
+ * With one worker, without a pool, or when called from one of the pool's
+ * own workers, the whole range runs inline on the caller: a handoff would
+ * gain nothing, and a worker blocked on its own pool could starve it.
+ *
+ * @param p_pool Pool to run on (NULL runs serially)
+ * @param begin First index
+ * @param end One past the last index
+ * @param grain Largest chunk, 0 for about AOC_POOL_CHUNKS per worker
+ * @param p_fn Body run on each chunk
+ * @param p_ctx Passed to p_fn
+ */
+void
+aoc_pool_for (aoc_pool_t *      p_pool,
+              size_t            begin,
+              size_t            end,
+              size_t            grain,
+              aoc_pool_for_fn_t p_fn,
+              void *            p_ctx)
+{
+    aoc_pool_job_t job;
+    size_t         count = 0;
+
+    if ((begin >= end) || (NULL == p_fn))
+    {
+        return;
+    }
+
+    if ((NULL == p_pool) || (1 == p_pool->worker_count))
+    {
+        p_fn(p_ctx, begin, end, 0);
+        return;
+    }
+
+    if ((NULL != gp_pool_self) && (p_pool == gp_pool_self->p_pool))
+    {
+        p_fn(p_ctx, begin, end, gp_pool_self->index);
+        return;
+    }
+
+    count = end - begin;
+    if (0 == grain)
+    {
+        grain = count / ((size_t)p_pool->worker_count * AOC_POOL_CHUNKS);
+        grain = (0 == grain) ? 1 : grain;
+    }
+
+    job.p_fn   = p_fn;
+    job.p_ctx  = p_ctx;
+    job.begin  = begin;
+    job.end    = end;
+    job.grain  = grain;
+    job.b_done = false;
+    job.p_next = NULL;
+    atomic_init(&job.remaining, count);
+
+    pthread_mutex_lock(&p_pool->lock);
+
+    if (NULL == p_pool->p_tail)
+    {
+        p_pool->p_head = &job;
+    }
+    else
+    {
+        p_pool->p_tail->p_next = &job;
+    }
+    p_pool->p_tail = &job;
+    atomic_fetch_add(&p_pool->queued, 1);
+    pthread_cond_broadcast(&p_pool->wake);
+
+    while (false == job.b_done)
+    {
+        pthread_cond_wait(&p_pool->done, &p_pool->lock);
+    }
+
+    pthread_mutex_unlock(&p_pool->lock);
+}
+
+/**
+ * @brief Parallel-for body of aoc_pool_reduce: folds one chunk into the
+ * worker's partial
+ */
+static void
+aoc_pool_reduce_chunk (void * p_ctx, size_t begin, size_t end, int worker)
+{
+    aoc_pool_reduction_t * p_reduction = p_ctx;
+    aoc_pool_partial_t *   p_partial   = &p_reduction->p_partials[worker];
+
+    p_partial->value = p_reduction->p_combine(
+        p_partial->value, p_reduction->p_map(p_reduction->p_ctx, begin, end));
+}
+
+/**
+ * @brief Reduces [begin, end) on the pool
+ *
+ * Each worker folds its chunks into a private partial; the partials are
+ * combined at the end. Chunks are combined in no particular order, so
+ * p_combine must be associative and commutative.
+ *
+ * @param p_pool Pool to run on (NULL runs serially)
+ * @param begin First index
+ * @param end One past the last index
+ * @param grain Largest chunk, 0 for automatic
+ * @param p_map Reduces one chunk
+ * @param p_combine Merges two partial results
+ * @param identity Neutral value of p_combine
+ * @param p_ctx Passed to p_map
+ *
+ * @return The combined value of every chunk
+ */
+int64_t
+aoc_pool_reduce (aoc_pool_t *          p_pool,
+                 size_t                begin,
+                 size_t                end,
+                 size_t                grain,
+                 aoc_pool_map_fn_t     p_map,
+                 aoc_pool_combine_fn_t p_combine,
+                 int64_t               identity,
+                 void *                p_ctx)
+{
+    int64_t              result  = identity;
+    int                  workers = aoc_pool_size(p_pool);
+    aoc_pool_reduction_t reduction
+        = { p_map, p_combine, p_ctx, NULL };
+
+    if (begin >= end)
+    {
+        return identity;
+    }
+
+    reduction.p_partials = aligned_alloc(
+        AOC_POOL_CACHE_LINE, (size_t)workers * sizeof(aoc_pool_partial_t));
+    if (NULL == reduction.p_partials)
+    {
+        // Still correct, just serial
+        return p_combine(identity, p_map(p_ctx, begin, end));
+    }
+
+    for (int idx = 0; idx < workers; idx++)
+    {
+        reduction.p_partials[idx].value = identity;
+    }
+
+    aoc_pool_for(p_pool, begin, end, grain, aoc_pool_reduce_chunk, &reduction);
+
+    for (int idx = 0; idx < workers; idx++)
+    {
+        result = p_combine(result, reduction.p_partials[idx].value);
+    }
+
+    free(reduction.p_partials);
+    return result;
+}
+
+/**
+ * @brief Addition, the usual aoc_pool_reduce combiner
+ *
+ * @param left Partial result
+ * @param right Partial result
+ *
+ * @return left + right
+ */
+int64_t
+aoc_pool_add (int64_t left, int64_t right)
+{
+    return left + right;
+}
+
+/**
+ * @brief Sums the body calls and steals of every worker so far
+ *
+ * @param p_pool Pool to read
+ * @param p_chunks Receives the number of chunks run
+ * @param p_steals Receives the number of tasks stolen
+ */
+void
+aoc_pool_counters (aoc_pool_t * p_pool, uint64_t * p_chunks, uint64_t * p_steals)
+{
+    *p_chunks = 0;
+    *p_steals = 0;
+
+    for (int idx = 0; (NULL != p_pool) && (idx < p_pool->worker_count); idx++)
+    {
+        *p_chunks += atomic_load(&p_pool->p_workers[idx].chunks);
+        *p_steals += atomic_load(&p_pool->p_workers[idx].steals);
+    }
+}
+
+/** END OF FILE **/
\ No newline at end of file
@@ -0,0 +1,190 @@
+/**
+ * @file aoc_snap.c
+ *
+ * @brief Binary snapshots of parsed inputs
+ *
+ * The header is checked field by field and the payload against its XXH64
+ * checksum before any of it is handed out, so a truncated or edited file
+ * fails to load instead of giving wrong answers. Hashing reads each byte
+ * once, which is still far below the cost of parsing the text. Snapshots are
+ * written to a temporary file and renamed into place, as cache entries are.
+ *
+ * @author Mexeck88
+ *
+ * @date 18OCT26
+ */
+
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "aoc_cache.h"
+#include "aoc_snap.h"
+
+_Static_assert(64 == sizeof(aoc_snap_header_t), "snapshot header is 64 bytes");
+
+/**
+ * @brief Tells whether an input starts like a snapshot
+ *
+ * @param p_input Open input
+ *
+ * @return true if the input starts with the snapshot magic; text never does
+ */
+bool
+aoc_snap_detect (const aoc_input_t * p_input)
+{
+    return (NULL != p_input) && (AOC_SNAP_MAGIC_SIZE <= p_input->size)
+           && (0
+               == memcmp(p_input->p_data, AOC_SNAP_MAGIC, AOC_SNAP_MAGIC_SIZE));
+}
+
+/**
+ * @brief Checks a snapshot and points at its payload
+ *
+ * @param p_input Open input holding the whole snapshot; the payload stays
+ * valid until aoc_input_close
+ * @param day Day the snapshot must be for
+ * @param p_snap Receives the record count, width and payload
+ *
+ * @return AOC_SUCCESS on success, AOC_FAILURE if the file is not a snapshot
+ * of that day in this version or its payload does not match its checksum
+ */
+uint8_t
+aoc_snap_open (const aoc_input_t * p_input, uint32_t day, aoc_snap_t * p_snap)
+{
+    uint8_t           retcode = AOC_FAILURE;
+    aoc_snap_header_t header;
+
+    if ((NULL == p_input) || (NULL == p_snap))
+    {
+        printf("ERROR: NULL pointer passed to snap_open\n");
+        goto EXIT;
+    }
+
+    if ((false == aoc_snap_detect(p_input)) || (sizeof(header) > p_input->size))
+    {
+        printf("ERROR: Not a snapshot\n");
+        goto EXIT;
+    }
+
+    memcpy(&header, p_input->p_data, sizeof(header));
+
+    if (AOC_SNAP_VERSION != header.version)
+    {
+        printf("ERROR: Snapshot version %u, expected %d\n",
+               header.version,
+               AOC_SNAP_VERSION);
+        goto EXIT;
+    }
+
+    if (day != header.day)
+    {
+        printf("ERROR: Snapshot is for day %u, not day %u\n", header.day, day);
+        goto EXIT;
+    }
+
+    if (header.payload_size != p_input->size - sizeof(header))
+    {
+        printf("ERROR: Snapshot payload is %zu bytes, header says %llu\n",
+               p_input->size - sizeof(header),
+               (unsigned long long)header.payload_size);
+        goto EXIT;
+    }
+
+    p_snap->count     = header.count;
+    p_snap->width     = header.width;
+    p_snap->p_payload = (const uint8_t *)p_input->p_data + sizeof(header);
+    p_snap->size      = (size_t)header.payload_size;
+
+    if (header.checksum != aoc_hash64(p_snap->p_payload, p_snap->size, 0))
+    {
+        printf("ERROR: Snapshot checksum mismatch\n");
+        goto EXIT;
+    }
+
+    retcode = AOC_SUCCESS;
+EXIT:
+    return retcode;
+}
+
+/**
+ * @brief Writes a snapshot: a header for the payload, then the payload
+ *
+ * @param p_path Snapshot file, replaced if it exists
+ * @param day Day the payload belongs to
+ * @param count Records in the payload
+ * @param width Grid columns, 0 for days without a grid
+ * @param p_payload Parsed input in the day's snapshot layout
+ * @param size Bytes of payload
+ *
+ * @return AOC_SUCCESS on success, AOC_FAILURE on failure
+ */
+uint8_t
+aoc_snap_write (const char * p_path,
+                uint32_t     day,
+                uint64_t     count,
+                uint64_t     width,
+                const void * p_payload,
+                size_t       size)
+{
+    uint8_t           retcode                  = AOC_FAILURE;
+    FILE *            p_file                   = NULL;
+    int               length                   = 0;
+    size_t            written                  = 0;
+    char              temp_path[AOC_SNAP_PATH] = { 0 };
+    aoc_snap_header_t header;
+
+    if ((NULL == p_path) || ((NULL == p_payload) && (0 < size)))
+    {
+        printf("ERROR: NULL pointer passed to snap_write\n");
+        goto EXIT;
+    }
+
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, AOC_SNAP_MAGIC, AOC_SNAP_MAGIC_SIZE);
+    header.version      = AOC_SNAP_VERSION;
+    header.day          = day;
+    header.count        = count;
+    header.width        = width;
+    header.payload_size = size;
+    header.checksum     = aoc_hash64(p_payload, size, 0);
+
+    length = snprintf(
+        temp_path, sizeof(temp_path), "%s.tmp-%ld", p_path, (long)getpid());
+    if ((0 >= length) || (AOC_SNAP_PATH <= length))
+    {
+        printf("ERROR: Snapshot path too long: %s\n", p_path);
+        goto EXIT;
+    }
+
+    p_file = fopen(temp_path, "wb");
+    if (NULL == p_file)
+    {
+        goto FAIL;
+    }
+
+    written = fwrite(&header, sizeof(header), 1, p_file);
+    if (0 < size)
+    {
+        written += fwrite(p_payload, size, 1, p_file);
+    }
+
+    // fclose flushes, so it can fail too
+    if ((0 != fclose(p_file)) || (((0 < size) ? 2 : 1) != written)
+        || (0 != rename(temp_path, p_path)))
+    {
+        unlink(temp_path);
+        goto FAIL;
+    }
+
+    retcode = AOC_SUCCESS;
+    goto EXIT;
+
+FAIL:
+    printf("ERROR: Unable to write snapshot %s: %s\n", p_path, strerror(errno));
+EXIT:
+    return retcode;
+}
+
+/** END OF FILE **/
\ No newline at end of file
@@ -0,0 +1,276 @@
+/**
+ * @file aoc_trace.c
+ *
+ * @brief Per-thread span buffers and Chrome trace-event export for the
+ * Advent of Code 2025 challenges
+ *
+ * Each thread gets its own fixed buffer on its first span and registers it
+ * once under a lock; after that a span costs two monotonic clock reads and
+ * a store into memory no other thread touches. Buffers stay alive after
+ * their thread exits, so pool workers joined at exit are still exported.
+ * The file is written by an atexit handler registered with the first
+ * buffer, which runs after the shared pool (started later) has stopped.
+ *
+ * @author Mexeck88
+ *
+ * @date 18OCT26
+ */
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "aoc_input.h"
+#include "aoc_trace.h"
+
+#define AOC_TRACE_NS_PER_SEC 1000000000ULL
+#define AOC_TRACE_NS_PER_US  1000.0
+
+/**
+ * @struct aoc_trace_event_t
+ * @brief One closed span
+ */
+typedef struct aoc_trace_event_t
+{
+    const char * p_name;
+    uint64_t     start_ns; // Since the first span of the process
+    uint64_t     dur_ns;
+    int64_t      arg;
+    bool         b_arg;
+} aoc_trace_event_t;
+
+/**
+ * @struct aoc_trace_buffer_t
+ * @brief Spans of one thread, written only by that thread
+ */
+typedef struct aoc_trace_buffer_t
+{
+    struct aoc_trace_buffer_t * p_next;  // Registry of every buffer
+    int                         tid;     // 1 for the first thread to trace
+    size_t                      count;
+    uint64_t                    dropped; // Spans past AOC_TRACE_EVENTS
+    aoc_trace_event_t           events[AOC_TRACE_EVENTS];
+} aoc_trace_buffer_t;
+
+static _Thread_local aoc_trace_buffer_t * tp_trace_buffer;
+static aoc_trace_buffer_t *               gp_trace_buffers;
+static int                                g_trace_threads;
+static uint64_t                           g_trace_epoch_ns;
+static pthread_mutex_t g_trace_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_once_t  g_trace_once = PTHREAD_ONCE_INIT;
+
+/**
+ * @brief Reads the monotonic clock
+ *
+ * @return Nanoseconds since an arbitrary fixed point
+ */
+static uint64_t
+aoc_trace_now_ns (void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return ((uint64_t)now.tv_sec * AOC_TRACE_NS_PER_SEC) + (uint64_t)now.tv_nsec;
+}
+
+/**
+ * @brief Writes the timeline at exit
+ */
+static void
+aoc_trace_flush (void)
+{
+    const char * p_path = getenv(AOC_TRACE_ENV);
+
+    (void)aoc_trace_write((NULL != p_path) ? p_path : AOC_TRACE_DEFAULT);
+}
+
+/**
+ * @brief Starts the clock and arranges the export, on the first span
+ */
+static void
+aoc_trace_init (void)
+{
+    g_trace_epoch_ns = aoc_trace_now_ns();
+    atexit(aoc_trace_flush);
+}
+
+/**
+ * @brief Returns the calling thread's buffer, registering a new one first
+ *
+ * @return The buffer, NULL if it could not be allocated (spans are then
+ * not recorded)
+ */
+static aoc_trace_buffer_t *
+aoc_trace_buffer (void)
+{
+    aoc_trace_buffer_t * p_buffer = tp_trace_buffer;
+
+    if (NULL != p_buffer)
+    {
+        return p_buffer;
+    }
+
+    pthread_once(&g_trace_once, aoc_trace_init);
+
+    p_buffer = calloc(1, sizeof(aoc_trace_buffer_t));
+    if (NULL == p_buffer)
+    {
+        return NULL;
+    }
+
+    pthread_mutex_lock(&g_trace_lock);
+    p_buffer->tid    = ++g_trace_threads;
+    p_buffer->p_next = gp_trace_buffers;
+    gp_trace_buffers = p_buffer;
+    pthread_mutex_unlock(&g_trace_lock);
+
+    tp_trace_buffer = p_buffer;
+    return p_buffer;
+}
+
+/**
+ * @brief Opens a span (used through AOC_TRACE_SCOPE)
+ *
+ * @param p_name Span name, a string literal
+ * @param b_arg Whether arg is shown
+ * @param arg Number shown with the span
+ *
+ * @return The open span
+ */
+aoc_trace_span_t
+aoc_trace_begin (const char * p_name, bool b_arg, int64_t arg)
+{
+    aoc_trace_span_t span = { p_name, arg, b_arg, 0 };
+
+    // Registering the buffer is kept out of the span's time
+    (void)aoc_trace_buffer();
+    span.start_ns = aoc_trace_now_ns();
+
+    return span;
+}
+
+/**
+ * @brief Closes a span into the thread's buffer (the cleanup of
+ * AOC_TRACE_SCOPE)
+ *
+ * @param p_span Span to close
+ */
+void
+aoc_trace_end (aoc_trace_span_t * p_span)
+{
+    uint64_t             end_ns   = aoc_trace_now_ns();
+    aoc_trace_buffer_t * p_buffer = tp_trace_buffer;
+    aoc_trace_event_t *  p_event  = NULL;
+
+    if (NULL == p_buffer)
+    {
+        return;
+    }
+
+    if (AOC_TRACE_EVENTS <= p_buffer->count)
+    {
+        p_buffer->dropped++;
+        return;
+    }
+
+    p_event           = &p_buffer->events[p_buffer->count++];
+    p_event->p_name   = p_span->p_name;
+    p_event->start_ns = p_span->start_ns - g_trace_epoch_ns;
+    p_event->dur_ns   = end_ns - p_span->start_ns;
+    p_event->arg      = p_span->arg;
+    p_event->b_arg    = p_span->b_arg;
+}
+
+/**
+ * @brief Writes every thread's spans as Chrome trace-event JSON
+ *
+ * Only call it once the traced threads are idle; the exit handler does.
+ * Spans become complete ("X") events in microseconds, one track per thread.
+ *
+ * @param p_path File to write
+ *
+ * @return AOC_SUCCESS on success, AOC_FAILURE on failure
+ */
+uint8_t
+aoc_trace_write (const char * p_path)
+{
+    uint8_t              retcode = AOC_FAILURE;
+    FILE *               p_out   = NULL;
+    uint64_t             dropped = 0;
+    int                  pid     = (int)getpid();
+    const char *         p_sep   = "";
+    aoc_trace_buffer_t * p_buffer;
+
+    p_out = fopen(p_path, "w");
+    if (NULL == p_out)
+    {
+        perror("ERROR: Unable to open trace file");
+        goto EXIT;
+    }
+
+    pthread_mutex_lock(&g_trace_lock);
+    fprintf(p_out, "{\"traceEvents\": [\n");
+
+    for (p_buffer = gp_trace_buffers; NULL != p_buffer; p_buffer = p_buffer->p_next)
+    {
+        fprintf(p_out,
+                "%s{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": %d, "
+                "\"tid\": %d, \"args\": {\"name\": \"thread %d\"}}",
+                p_sep,
+                pid,
+                p_buffer->tid,
+                p_buffer->tid);
+        p_sep = ",\n";
+
+        for (size_t idx = 0; idx < p_buffer->count; idx++)
+        {
+            const aoc_trace_event_t * p_event = &p_buffer->events[idx];
+
+            fprintf(p_out,
+                    ",\n{\"name\": \"%s\", \"cat\": \"aoc\", \"ph\": \"X\", "
+                    "\"ts\": %.3f, \"dur\": %.3f, \"pid\": %d, \"tid\": %d",
+                    p_event->p_name,
+                    (double)p_event->start_ns / AOC_TRACE_NS_PER_US,
+                    (double)p_event->dur_ns / AOC_TRACE_NS_PER_US,
+                    pid,
+                    p_buffer->tid);
+
+            if (true == p_event->b_arg)
+            {
+                fprintf(p_out, ", \"args\": {\"n\": %lld}", (long long)p_event->arg);
+            }
+
+            fprintf(p_out, "}");
+        }
+
+        dropped += p_buffer->dropped;
+    }
+
+    fprintf(p_out,
+            "\n],\n\"displayTimeUnit\": \"ns\",\n"
+            "\"otherData\": {\"dropped\": %llu}}\n",
+            (unsigned long long)dropped);
+    pthread_mutex_unlock(&g_trace_lock);
+
+    if (0 != dropped)
+    {
+        fprintf(stderr,
+                "NOTE: %llu trace spans dropped, over %d per thread\n",
+                (unsigned long long)dropped,
+                AOC_TRACE_EVENTS);
+    }
+
+    retcode = AOC_SUCCESS;
+EXIT:
+    if ((NULL != p_out) && (0 != fclose(p_out)))
+    {
+        perror("ERROR: Unable to write trace file");
+        retcode = AOC_FAILURE;
+    }
+
+    return retcode;
+}
+
+/** END OF FILE **/
\ No newline at end of file
@@ -0,0 +1,569 @@
+/**
+ * @file aoc_golden.c
+ *
+ * @brief Golden-answer test driver shared by every ChalN make test
+ *
+ * Usage: aoc_golden [-r runs] [-g generator] solver golden_file
+ *
+ * Each line of the golden file is one case:
+ *
+ *     name part1 part2 rss_kib load_ms parse_ms part1_ms part2_ms input
+ *
+ * where input is either a checked-in file or "gen" followed by generator
+ * arguments, in which case the generator writes the input to a temporary
+ * file first. The solver is run once with -n, bypassing the result cache,
+ * and must exit with 0, print the expected answers and stay under rss_kib of
+ * peak resident memory. It is then run with -b runs and the median of each
+ * phase must stay under its budget. A budget or limit of 0 is not checked.
+ * Budgets are multiplied by $AOC_TEST_SLACK, for slow or instrumented
+ * machines. Blank lines and lines starting with # are skipped.
+ *
+ * @author Mexeck88
+ *
+ * @date 18OCT26
+ */
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+/**
+ * @enum golden_info_t
+ * @brief Driver limits and defaults
+ */
+typedef enum golden_info_t
+{
+    GOLDEN_LINE      = 4096,    // Longest golden file line
+    GOLDEN_NAME      = 64,      // Longest case name
+    GOLDEN_ARGS      = 64,      // Most arguments passed to a child
+    GOLDEN_OUTPUT    = 1 << 16, // Child output kept, the rest is drained
+    GOLDEN_RUNS      = 5,       // Timed runs per case when -r is not given
+    GOLDEN_PHASES    = 4,       // load, parse, part1, part2
+    GOLDEN_NS_PER_MS = 1000000,
+} golden_info_t;
+
+#define GOLDEN_SLACK_ENV "AOC_TEST_SLACK" // Multiplies every time budget
+#define GOLDEN_GEN       "gen"            // Input spec prefix of generated cases
+#define GOLDEN_TMP       "/tmp/aoc_golden_XXXXXX"
+
+/**
+ * @struct golden_case_t
+ * @brief One line of the golden file
+ */
+typedef struct golden_case_t
+{
+    char      name[GOLDEN_NAME];
+    long long part1;
+    long long part2;
+    long      rss_kib;                  // Peak resident memory limit
+    double    budget_ms[GOLDEN_PHASES]; // Median time limit of each phase
+    char *    p_input;                  // Rest of the line
+} golden_case_t;
+
+/**
+ * @struct golden_args_t
+ * @brief Command line of the driver
+ */
+typedef struct golden_args_t
+{
+    const char * p_solver;
+    const char * p_gen;
+    const char * p_golden;
+    char         runs[GOLDEN_NAME];
+    double       slack;
+} golden_args_t;
+
+static const char * gp_phase_names[GOLDEN_PHASES] = { "load",
+                                                       "parse",
+                                                       "part1",
+                                                       "part2" };
+
+/**
+ * @brief Runs a program, keeping its standard output
+ *
+ * @param pp_argv NULL terminated argument vector, pp_argv[0] is the program
+ * @param p_out Buffer for the output, always NUL terminated
+ * @param out_size Size of p_out
+ * @param p_rss_kib Set to the child's peak resident memory in KiB
+ *
+ * @return true if the program ran and exited with 0, false otherwise
+ */
+static bool
+golden_exec (char ** pp_argv, char * p_out, size_t out_size, long * p_rss_kib)
+{
+    int           fds[2];
+    int           status = 0;
+    size_t        used   = 0;
+    ssize_t       got    = 0;
+    char          drain[GOLDEN_LINE];
+    struct rusage usage;
+    pid_t         pid = 0;
+
+    if (0 != pipe(fds))
+    {
+        perror("ERROR: Unable to create pipe");
+        return false;
+    }
+
+    pid = fork();
+    if (0 > pid)
+    {
+        perror("ERROR: Unable to fork");
+        close(fds[0]);
+        close(fds[1]);
+        return false;
+    }
+
+    if (0 == pid)
+    {
+        dup2(fds[1], STDOUT_FILENO);
+        close(fds[0]);
+        close(fds[1]);
+        execv(pp_argv[0], pp_argv);
+        perror("ERROR: Unable to run child");
+        _exit(127);
+    }
+
+    close(fds[1]);
+    for (;;)
+    {
+        if (used + 1 < out_size)
+        {
+            got = read(fds[0], p_out + used, out_size - used - 1);
+        }
+        else
+        {
+            got = read(fds[0], drain, sizeof(drain));
+        }
+
+        if ((0 > got) && (EINTR == errno))
+        {
+            continue;
+        }
+
+        if (0 >= got)
+        {
+            break;
+        }
+
+        used += (used + 1 < out_size) ? (size_t)got : 0;
+    }
+
+    p_out[used] = '\0';
+    close(fds[0]);
+
+    if (0 > wait4(pid, &status, 0, &usage))
+    {
+        perror("ERROR: Unable to wait for child");
+        return false;
+    }
+
+    *p_rss_kib = usage.ru_maxrss;
+    if ((false == WIFEXITED(status)) || (0 != WEXITSTATUS(status)))
+    {
+        printf("    %s exited with %d\n",
+               pp_argv[0],
+               WIFEXITED(status) ? WEXITSTATUS(status) : -1);
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Writes a generated input to a new temporary file
+ *
+ * @param p_args Driver options, for the generator
+ * @param p_spec Generator arguments, split on spaces in place
+ * @param p_path Buffer of at least sizeof(GOLDEN_TMP) for the file name
+ *
+ * @return true on success, false otherwise
+ */
+static bool
+golden_generate (const golden_args_t * p_args, char * p_spec, char * p_path)
+{
+    char * pp_argv[GOLDEN_ARGS];
+    char   out[GOLDEN_LINE];
+    char * p_save = NULL;
+    int    argc   = 0;
+    long   rss    = 0;
+    int    fd     = 0;
+
+    if (NULL == p_args->p_gen)
+    {
+        printf("    generated case needs -g generator\n");
+        return false;
+    }
+
+    strcpy(p_path, GOLDEN_TMP);
+    fd = mkstemp(p_path);
+    if (0 > fd)
+    {
+        perror("ERROR: Unable to create temporary input");
+        return false;
+    }
+
+    close(fd);
+
+    pp_argv[argc++] = (char *)p_args->p_gen;
+    for (char * p_tok = strtok_r(p_spec, " \t", &p_save);
+         (NULL != p_tok) && (argc < GOLDEN_ARGS - 3);
+         p_tok = strtok_r(NULL, " \t", &p_save))
+    {
+        pp_argv[argc++] = p_tok;
+    }
+
+    pp_argv[argc++] = "-o";
+    pp_argv[argc++] = p_path;
+    pp_argv[argc]   = NULL;
+
+    return golden_exec(pp_argv, out, sizeof(out), &rss);
+}
+
+/**
+ * @brief Finds the two answers in a solver's output
+ *
+ * The answers are the integers after the last colon of the first two lines
+ * that have one, which covers every day's wording.
+ *
+ * @param p_out Solver output
+ * @param p_part1 Set to the first answer
+ * @param p_part2 Set to the second answer
+ *
+ * @return true if both were found, false otherwise
+ */
+static bool
+golden_answers (const char * p_out, long long * p_part1, long long * p_part2)
+{
+    long long *  pp_parts[2] = { p_part1, p_part2 };
+    int          found       = 0;
+    const char * p_line      = p_out;
+
+    while (('\0' != *p_line) && (2 > found))
+    {
+        const char * p_end   = strchr(p_line, '\n');
+        const char * p_colon = NULL;
+        char *       p_num   = NULL;
+
+        p_end = (NULL == p_end) ? (p_line + strlen(p_line)) : p_end;
+        for (const char * p_char = p_line; p_char < p_end; p_char++)
+        {
+            p_colon = (':' == *p_char) ? p_char : p_colon;
+        }
+
+        if (NULL != p_colon)
+        {
+            *pp_parts[found] = strtoll(p_colon + 1, &p_num, 10);
+            found += (p_num != p_colon + 1) ? 1 : 0;
+        }
+
+        p_line = ('\n' == *p_end) ? (p_end + 1) : p_end;
+    }
+
+    return (2 == found);
+}
+
+/**
+ * @brief Finds a phase's median in the solver's benchmark JSON
+ *
+ * @param p_json Benchmark output
+ * @param p_phase Phase name
+ * @param p_ms Set to the median in milliseconds
+ *
+ * @return true if the phase was found, false otherwise
+ */
+static bool
+golden_median (const char * p_json, const char * p_phase, double * p_ms)
+{
+    char         key[GOLDEN_NAME];
+    const char * p_at = NULL;
+
+    snprintf(key, sizeof(key), "\"name\": \"%s\"", p_phase);
+    p_at = strstr(p_json, key);
+    p_at = (NULL == p_at) ? NULL : strstr(p_at, "\"median_ns\": ");
+    if (NULL == p_at)
+    {
+        return false;
+    }
+
+    *p_ms = strtod(p_at + strlen("\"median_ns\": "), NULL) / GOLDEN_NS_PER_MS;
+    return true;
+}
+
+/**
+ * @brief Runs one case
+ *
+ * @param p_args Driver options
+ * @param p_case Case to run
+ *
+ * @return true if every check passed, false otherwise
+ */
+static bool
+golden_case (const golden_args_t * p_args, golden_case_t * p_case)
+{
+    static char out[GOLDEN_OUTPUT];
+    char        tmp[sizeof(GOLDEN_TMP)] = "";
+    char *      p_input                 = p_case->p_input;
+    char *      pp_argv[GOLDEN_ARGS];
+    bool        b_pass = false;
+    long long   part1  = 0;
+    long long   part2  = 0;
+    long        rss    = 0;
+    double      ms     = 0;
+
+    if ((0 == strncmp(p_input, GOLDEN_GEN, strlen(GOLDEN_GEN)))
+        && ((' ' == p_input[strlen(GOLDEN_GEN)]) || ('\t' == p_input[strlen(GOLDEN_GEN)])))
+    {
+        if (false == golden_generate(p_args, p_input + strlen(GOLDEN_GEN), tmp))
+        {
+            goto CLEAN;
+        }
+
+        p_input = tmp;
+    }
+
+    pp_argv[0] = (char *)p_args->p_solver;
+    pp_argv[1] = "-n";
+    pp_argv[2] = p_input;
+    pp_argv[3] = NULL;
+    if (false == golden_exec(pp_argv, out, sizeof(out), &rss))
+    {
+        goto CLEAN;
+    }
+
+    if (false == golden_answers(out, &part1, &part2))
+    {
+        printf("    no answers in output:\n%s", out);
+        goto CLEAN;
+    }
+
+    b_pass = true;
+    if ((p_case->part1 != part1) || (p_case->part2 != part2))
+    {
+        printf("    answers %lld %lld, expected %lld %lld\n",
+               part1,
+               part2,
+               p_case->part1,
+               p_case->part2);
+        b_pass = false;
+    }
+
+    printf("    peak RSS %ld KiB", rss);
+    if ((0 < p_case->rss_kib) && (rss > p_case->rss_kib))
+    {
+        printf(", over the %ld KiB limit", p_case->rss_kib);
+        b_pass = false;
+    }
+
+    printf("\n");
+
+    pp_argv[1] = "-b";
+    pp_argv[2] = (char *)p_args->runs;
+    pp_argv[3] = p_input;
+    pp_argv[4] = NULL;
+    if (false == golden_exec(pp_argv, out, sizeof(out), &rss))
+    {
+        b_pass = false;
+        goto CLEAN;
+    }
+
+    for (int idx = 0; idx < GOLDEN_PHASES; idx++)
+    {
+        double budget = p_case->budget_ms[idx] * p_args->slack;
+
+        if (false == golden_median(out, gp_phase_names[idx], &ms))
+        {
+            printf("    no %s phase in benchmark output\n", gp_phase_names[idx]);
+            b_pass = false;
+            continue;
+        }
+
+        printf("    %-5s %10.3f ms", gp_phase_names[idx], ms);
+        if ((0 < budget) && (ms > budget))
+        {
+            printf(", over the %.3f ms budget", budget);
+            b_pass = false;
+        }
+
+        printf("\n");
+    }
+
+CLEAN:
+    if ('\0' != tmp[0])
+    {
+        unlink(tmp);
+    }
+
+    return b_pass;
+}
+
+/**
+ * @brief Parses one golden file line
+ *
+ * @param p_line Line without its newline, kept by p_case->p_input
+ * @param p_case Case to fill in
+ *
+ * @return true on success, false on a malformed line
+ */
+static bool
+golden_parse_case (char * p_line, golden_case_t * p_case)
+{
+    int used = 0;
+    int got  = sscanf(p_line,
+                     "%63s %lld %lld %ld %lf %lf %lf %lf %n",
+                     p_case->name,
+                     &p_case->part1,
+                     &p_case->part2,
+                     &p_case->rss_kib,
+                     &p_case->budget_ms[0],
+                     &p_case->budget_ms[1],
+                     &p_case->budget_ms[2],
+                     &p_case->budget_ms[3],
+                     &used);
+
+    if ((8 != got) || ('\0' == p_line[used]))
+    {
+        return false;
+    }
+
+    p_case->p_input = p_line + used;
+    return true;
+}
+
+/**
+ * @brief Parses the command line
+ *
+ * @param argc Argument count
+ * @param argv Argument vector
+ * @param p_args Options to fill in
+ *
+ * @return true on success, false on a bad command line
+ */
+static bool
+golden_parse_args (int argc, char ** argv, golden_args_t * p_args)
+{
+    const char * p_slack = getenv(GOLDEN_SLACK_ENV);
+    char *       p_end   = NULL;
+    long         runs    = GOLDEN_RUNS;
+    int          option  = 0;
+
+    p_args->p_gen = NULL;
+    p_args->slack = 1.0;
+    while (-1 != (option = getopt(argc, argv, "r:g:")))
+    {
+        switch (option)
+        {
+            case 'r':
+                runs = strtol(optarg, &p_end, 10);
+                if (('\0' != *p_end) || (0 >= runs))
+                {
+                    return false;
+                }
+                break;
+
+            case 'g':
+                p_args->p_gen = optarg;
+                break;
+
+            default:
+                return false;
+        }
+    }
+
+    if (2 != (argc - optind))
+    {
+        return false;
+    }
+
+    if (NULL != p_slack)
+    {
+        p_args->slack = strtod(p_slack, &p_end);
+        if (('\0' != *p_end) || (0 >= p_args->slack))
+        {
+            printf("ERROR: %s must be a positive number\n", GOLDEN_SLACK_ENV);
+            return false;
+        }
+    }
+
+    snprintf(p_args->runs, sizeof(p_args->runs), "%ld", runs);
+    p_args->p_solver = argv[optind];
+    p_args->p_golden = argv[optind + 1];
+    return true;
+}
+
+/**
+ * @brief Main function of the golden-answer test driver
+ *
+ * @param argc Argument count
+ * @param argv Argument vector
+ *
+ * @return 0 if every case passed, 1 otherwise
+ */
+int
+main (int argc, char ** argv)
+{
+    golden_args_t args;
+    golden_case_t test;
+    char          line[GOLDEN_LINE];
+    FILE *        p_file   = NULL;
+    int           cases    = 0;
+    int           failures = 0;
+    size_t        len      = 0;
+
+    if (false == golden_parse_args(argc, argv, &args))
+    {
+        printf("Usage: %s [-r runs] [-g generator] solver golden_file\n", argv[0]);
+        return 1;
+    }
+
+    p_file = fopen(args.p_golden, "r");
+    if (NULL == p_file)
+    {
+        perror("ERROR: Unable to open golden file");
+        return 1;
+    }
+
+    // Children share stdout, so nothing may be left in our buffer at a fork
+    setvbuf(stdout, NULL, _IOLBF, 0);
+
+    while (NULL != fgets(line, sizeof(line), p_file))
+    {
+        len = strcspn(line, "\r\n");
+        line[len] = '\0';
+        if (('\0' == line[strspn(line, " \t")]) || ('#' == line[0]))
+        {
+            continue;
+        }
+
+        cases++;
+        if (false == golden_parse_case(line, &test))
+        {
+            printf("FAIL: malformed line: %s\n", line);
+            failures++;
+            continue;
+        }
+
+        printf("[%s] %s\n", test.name, test.p_input);
+        if (false == golden_case(&args, &test))
+        {
+            printf("FAIL: %s\n", test.name);
+            failures++;
+        }
+    }
+
+    fclose(p_file);
+    printf("%s: %d of %d case(s) passed for %s\n",
+           (0 == failures) ? "PASS" : "FAIL",
+           cases - failures,
+           cases,
+           args.p_solver);
+
+    return ((0 == failures) && (0 < cases)) ? 0 : 1;
+}
+
+/** END OF FILE **/
\ No newline at end of file
@@ -0,0 +1,122 @@
+/**
+ * @file aoc_pool_bench.c
+ *
+ * @brief Microbenchmark of the work-stealing pool's task overhead
+ *
+ * Usage: aoc_pool_bench [workers]
+ *
+ * Runs an empty body at grain 1, so every index is its own chunk and the
+ * time is all scheduling, then times empty jobs to measure the round trip of
+ * one submission. Prints one JSON object.
+ *
+ * @author Mexeck88
+ *
+ * @date 18OCT26
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "aoc_input.h"
+#include "aoc_pool.h"
+
+/**
+ * @enum pool_bench_info_t
+ * @brief Benchmark sizes
+ */
+typedef enum pool_bench_info_t
+{
+    POOL_BENCH_CHUNKS = 1 << 22, // Indices of the grain-1 run
+    POOL_BENCH_JOBS   = 20000,   // Empty jobs of the round-trip run
+    POOL_BENCH_NS     = 1000000000,
+} pool_bench_info_t;
+
+/**
+ * @brief Reads the monotonic clock
+ *
+ * @return Nanoseconds since an arbitrary fixed point
+ */
+static uint64_t
+pool_bench_now_ns (void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return ((uint64_t)now.tv_sec * POOL_BENCH_NS) + (uint64_t)now.tv_nsec;
+}
+
+/**
+ * @brief Empty parallel-for body
+ */
+static void
+pool_bench_nop (void * p_ctx, size_t begin, size_t end, int worker)
+{
+    (void)p_ctx;
+    (void)begin;
+    (void)end;
+    (void)worker;
+}
+
+/**
+ * @brief Main function of the pool microbenchmark
+ *
+ * @param argc Argument count
+ * @param argv Argument vector, optional worker count
+ *
+ * @return 0 on success, 1 on failure
+ */
+int
+main (int argc, char ** argv)
+{
+    aoc_pool_t pool;
+    long       workers  = sysconf(_SC_NPROCESSORS_ONLN);
+    uint64_t   start    = 0;
+    uint64_t   chunk_ns = 0;
+    uint64_t   job_ns   = 0;
+    uint64_t   chunks   = 0;
+    uint64_t   steals   = 0;
+
+    if (1 < argc)
+    {
+        aoc_view_t view = { argv[1], strlen(argv[1]) };
+
+        if ((false == aoc_view_parse_long(view, &workers)) || (0 >= workers))
+        {
+            printf("Usage: %s [workers]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    if (AOC_SUCCESS != aoc_pool_create(&pool, (int)workers))
+    {
+        return 1;
+    }
+
+    start = pool_bench_now_ns();
+    aoc_pool_for(&pool, 0, POOL_BENCH_CHUNKS, 1, pool_bench_nop, NULL);
+    chunk_ns = pool_bench_now_ns() - start;
+    aoc_pool_counters(&pool, &chunks, &steals);
+
+    start = pool_bench_now_ns();
+    for (size_t idx = 0; idx < POOL_BENCH_JOBS; idx++)
+    {
+        aoc_pool_for(&pool, 0, 1, 1, pool_bench_nop, NULL);
+    }
+    job_ns = pool_bench_now_ns() - start;
+
+    printf("{\"workers\": %d, \"chunks\": %d, \"ns_per_chunk\": %.2f, "
+           "\"steals\": %llu, \"jobs\": %d, \"ns_per_job\": %.1f}\n",
+           aoc_pool_size(&pool),
+           POOL_BENCH_CHUNKS,
+           (double)chunk_ns / POOL_BENCH_CHUNKS,
+           (unsigned long long)steals,
+           POOL_BENCH_JOBS,
+           (double)job_ns / POOL_BENCH_JOBS);
+
+    aoc_pool_destroy(&pool);
+    return 0;
+}
+
+/** END OF FILE **/
\ No newline at end of file
@@ -0,0 +1,396 @@
+/**
+ * @file aoc_pool_test.c
+ *
+ * @brief Stress tests for the work-stealing pool
+ *
+ * Usage: aoc_pool_test [rounds]
+ *
+ * Every parallel-for must run each index exactly once, every reduction must
+ * match its serial value, and the pool must survive concurrent submitters,
+ * nested calls and being started and stopped repeatedly. Returns 0 when
+ * every check passes.
+ *
+ * @author Mexeck88
+ *
+ * @date 18OCT26
+ */
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "aoc_input.h"
+#include "aoc_pool.h"
+
+/**
+ * @enum pool_test_info_t
+ * @brief Test sizes
+ */
+typedef enum pool_test_info_t
+{
+    POOL_TEST_ROUNDS     = 20,      // Default repeats of the whole suite
+    POOL_TEST_MAX_LEN    = 1 << 20, // Largest index range
+    POOL_TEST_SUBMITTERS = 4,       // Threads sharing one pool
+    POOL_TEST_NESTED     = 64,      // Outer indices of the nested test
+} pool_test_info_t;
+
+/**
+ * @struct pool_test_visit_t
+ * @brief Per-index visit counters and the worker bound
+ */
+typedef struct pool_test_visit_t
+{
+    atomic_uchar * p_hits;
+    int            workers;
+    atomic_bool    b_bad_worker;
+} pool_test_visit_t;
+
+/**
+ * @struct pool_test_submitter_t
+ * @brief One thread submitting to a shared pool
+ */
+typedef struct pool_test_submitter_t
+{
+    aoc_pool_t * p_pool;
+    size_t       len;
+    int          failures;
+} pool_test_submitter_t;
+
+static const size_t g_lengths[] = { 1, 2, 3, 17, 1000, 65537, POOL_TEST_MAX_LEN };
+static const size_t g_grains[]  = { 0, 1, 7, 4096 };
+static const int    g_workers[] = { 1, 2, 4, 8 };
+
+/**
+ * @brief Parallel-for body marking each index once
+ */
+static void
+pool_test_mark (void * p_ctx, size_t begin, size_t end, int worker)
+{
+    pool_test_visit_t * p_visit = p_ctx;
+
+    if ((0 > worker) || (p_visit->workers <= worker))
+    {
+        atomic_store(&p_visit->b_bad_worker, true);
+    }
+
+    for (size_t idx = begin; idx < end; idx++)
+    {
+        atomic_fetch_add_explicit(&p_visit->p_hits[idx], 1, memory_order_relaxed);
+    }
+}
+
+/**
+ * @brief Reduction body: sum of index * 3 + 1 over a chunk
+ */
+static int64_t
+pool_test_sum (void * p_ctx, size_t begin, size_t end)
+{
+    int64_t sum = 0;
+
+    (void)p_ctx;
+    for (size_t idx = begin; idx < end; idx++)
+    {
+        sum += ((int64_t)idx * 3) + 1;
+    }
+
+    return sum;
+}
+
+/**
+ * @brief Reduction body: largest (index * 7919) mod 1000003 over a chunk
+ */
+static int64_t
+pool_test_max (void * p_ctx, size_t begin, size_t end)
+{
+    int64_t best = 0;
+    int64_t value = 0;
+
+    (void)p_ctx;
+    for (size_t idx = begin; idx < end; idx++)
+    {
+        value = ((int64_t)idx * 7919) % 1000003;
+        best  = (value > best) ? value : best;
+    }
+
+    return best;
+}
+
+/**
+ * @brief Combiner for pool_test_max
+ */
+static int64_t
+pool_test_larger (int64_t left, int64_t right)
+{
+    return (left > right) ? left : right;
+}
+
+/**
+ * @brief Runs one parallel-for and checks every index was visited once
+ *
+ * @return Number of failed checks
+ */
+static int
+pool_test_cover (aoc_pool_t * p_pool, size_t len, size_t grain)
+{
+    pool_test_visit_t visit;
+    int               failures = 0;
+
+    visit.p_hits  = calloc(len, sizeof(*visit.p_hits));
+    visit.workers = aoc_pool_size(p_pool);
+    atomic_init(&visit.b_bad_worker, false);
+    if (NULL == visit.p_hits)
+    {
+        printf("FAIL: out of memory for %zu indices\n", len);
+        return 1;
+    }
+
+    aoc_pool_for(p_pool, 0, len, grain, pool_test_mark, &visit);
+
+    for (size_t idx = 0; idx < len; idx++)
+    {
+        if (1 != atomic_load(&visit.p_hits[idx]))
+        {
+            printf("FAIL: %d workers, len %zu, grain %zu: index %zu ran %u "
+                   "times\n",
+                   visit.workers,
+                   len,
+                   grain,
+                   idx,
+                   (unsigned)atomic_load(&visit.p_hits[idx]));
+            failures++;
+            break;
+        }
+    }
+
+    if (true == atomic_load(&visit.b_bad_worker))
+    {
+        printf("FAIL: worker index out of range\n");
+        failures++;
+    }
+
+    free(visit.p_hits);
+    return failures;
+}
+
+/**
+ * @brief Checks both reductions against their serial values
+ *
+ * @return Number of failed checks
+ */
+static int
+pool_test_reduce (aoc_pool_t * p_pool, size_t len, size_t grain)
+{
+    int     failures = 0;
+    int64_t sum      = aoc_pool_reduce(
+        p_pool, 0, len, grain, pool_test_sum, aoc_pool_add, 0, NULL);
+    int64_t best = aoc_pool_reduce(
+        p_pool, 0, len, grain, pool_test_max, pool_test_larger, 0, NULL);
+
+    if (sum != pool_test_sum(NULL, 0, len))
+    {
+        printf("FAIL: sum over %zu, grain %zu: %lld\n", len, grain, (long long)sum);
+        failures++;
+    }
+
+    if (best != pool_test_max(NULL, 0, len))
+    {
+        printf("FAIL: max over %zu, grain %zu: %lld\n", len, grain, (long long)best);
+        failures++;
+    }
+
+    return failures;
+}
+
+/**
+ * @brief Submitter thread: many small and large jobs on a shared pool
+ */
+static void *
+pool_test_submit (void * p_arg)
+{
+    pool_test_submitter_t * p_sub = p_arg;
+
+    for (size_t round = 0; round < 16; round++)
+    {
+        p_sub->failures += pool_test_cover(p_sub->p_pool, p_sub->len + round, 0);
+        p_sub->failures += pool_test_reduce(p_sub->p_pool, p_sub->len, 3);
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Outer body of the nested test: each index reduces a range of its own
+ */
+static void
+pool_test_outer (void * p_ctx, size_t begin, size_t end, int worker)
+{
+    aoc_pool_t *   p_pool = ((void **)p_ctx)[0];
+    atomic_llong * p_sum  = ((void **)p_ctx)[1];
+
+    (void)worker;
+    for (size_t idx = begin; idx < end; idx++)
+    {
+        atomic_fetch_add(p_sum,
+                         aoc_pool_reduce(p_pool,
+                                         0,
+                                         1000 + idx,
+                                         0,
+                                         pool_test_sum,
+                                         aoc_pool_add,
+                                         0,
+                                         NULL));
+    }
+}
+
+/**
+ * @brief Parallel-for and reductions from a pool worker must run inline
+ *
+ * @return Number of failed checks
+ */
+static int
+pool_test_nested (aoc_pool_t * p_pool)
+{
+    atomic_llong sum;
+    int64_t      expect = 0;
+    void *       ctx[2] = { p_pool, &sum };
+
+    atomic_init(&sum, 0);
+    aoc_pool_for(p_pool, 0, POOL_TEST_NESTED, 1, pool_test_outer, ctx);
+
+    for (size_t idx = 0; idx < POOL_TEST_NESTED; idx++)
+    {
+        expect += pool_test_sum(NULL, 0, 1000 + idx);
+    }
+
+    if (expect != atomic_load(&sum))
+    {
+        printf("FAIL: nested sum %lld, expected %lld\n",
+               (long long)atomic_load(&sum),
+               (long long)expect);
+        return 1;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Several threads submitting to one pool at once
+ *
+ * @return Number of failed checks
+ */
+static int
+pool_test_concurrent (aoc_pool_t * p_pool)
+{
+    pthread_t             threads[POOL_TEST_SUBMITTERS];
+    pool_test_submitter_t subs[POOL_TEST_SUBMITTERS];
+    int                   failures = 0;
+
+    for (size_t idx = 0; idx < POOL_TEST_SUBMITTERS; idx++)
+    {
+        subs[idx].p_pool   = p_pool;
+        subs[idx].len      = 1000 * (idx + 1);
+        subs[idx].failures = 0;
+        if (0 != pthread_create(&threads[idx], NULL, pool_test_submit, &subs[idx]))
+        {
+            perror("FAIL: Unable to start submitter");
+            return failures + 1;
+        }
+    }
+
+    for (size_t idx = 0; idx < POOL_TEST_SUBMITTERS; idx++)
+    {
+        pthread_join(threads[idx], NULL);
+        failures += subs[idx].failures;
+    }
+
+    return failures;
+}
+
+/**
+ * @brief Runs the whole suite on pools of several sizes
+ *
+ * @return Number of failed checks
+ */
+static int
+pool_test_round (void)
+{
+    aoc_pool_t pool;
+    int        failures = 0;
+
+    for (size_t wdx = 0; wdx < (sizeof(g_workers) / sizeof(g_workers[0])); wdx++)
+    {
+        if (AOC_SUCCESS != aoc_pool_create(&pool, g_workers[wdx]))
+        {
+            printf("FAIL: Unable to start %d workers\n", g_workers[wdx]);
+            return failures + 1;
+        }
+
+        for (size_t ldx = 0; ldx < (sizeof(g_lengths) / sizeof(g_lengths[0])); ldx++)
+        {
+            for (size_t gdx = 0; gdx < (sizeof(g_grains) / sizeof(g_grains[0]));
+                 gdx++)
+            {
+                failures += pool_test_cover(&pool, g_lengths[ldx], g_grains[gdx]);
+                failures += pool_test_reduce(&pool, g_lengths[ldx], g_grains[gdx]);
+            }
+        }
+
+        failures += pool_test_nested(&pool);
+        failures += pool_test_concurrent(&pool);
+        aoc_pool_destroy(&pool);
+    }
+
+    // Serial fallback and the shared pool
+    failures += pool_test_cover(NULL, 1000, 0);
+    failures += pool_test_reduce(NULL, 1000, 0);
+    failures += pool_test_cover(aoc_pool_shared(), 65537, 0);
+    failures += pool_test_reduce(aoc_pool_shared(), 65537, 0);
+
+    return failures;
+}
+
+/**
+ * @brief Main function of the pool stress test
+ *
+ * @param argc Argument count
+ * @param argv Argument vector, optional round count
+ *
+ * @return 0 if every check passed, 1 otherwise
+ */
+int
+main (int argc, char ** argv)
+{
+    long     rounds   = POOL_TEST_ROUNDS;
+    int      failures = 0;
+    uint64_t chunks   = 0;
+    uint64_t steals   = 0;
+
+    if (1 < argc)
+    {
+        aoc_view_t view = { argv[1], strlen(argv[1]) };
+
+        if ((false == aoc_view_parse_long(view, &rounds)) || (0 >= rounds))
+        {
+            printf("Usage: %s [rounds]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    for (long round = 0; (round < rounds) && (0 == failures); round++)
+    {
+        failures += pool_test_round();
+    }
+
+    aoc_pool_counters(aoc_pool_shared(), &chunks, &steals);
+    printf("%s: %ld round(s), shared pool of %d ran %llu chunks, %llu stolen\n",
+           (0 == failures) ? "PASS" : "FAIL",
+           rounds,
+           aoc_pool_size(aoc_pool_shared()),
+           (unsigned long long)chunks,
+           (unsigned long long)steals);
+
+    return (0 == failures) ? 0 : 1;
+}
+
+/** END OF FILE **/
\ No newline at end of file
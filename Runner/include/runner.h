@@ -0,0 +1,90 @@
+/**
+ * @file runner.h
+ *
+ * @brief Unified Advent of Code 2025 runner: every challenge in one binary,
+ * scheduled on a shared thread pool.
+ *
+ * @author Mexeck88
+ *
+ * @date 18OCT26
+ */
+
+#ifndef RUNNER_H
+#define RUNNER_H
+
+#include <limits.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "aoc_cache.h"
+#include "aoc_day.h"
+
+/**
+ * @enum runner_info_t
+ * @brief Runner constants
+ */
+typedef enum runner_info_t
+{
+    DAY_COUNT  = 4,
+    NS_PER_SEC = 1000000000,
+    NS_PER_MS  = 1000000,
+} runner_info_t;
+
+/**
+ * @struct runner_day_t
+ * @brief A challenge the runner can schedule
+ */
+typedef struct runner_day_t
+{
+    int          day;
+    const char * p_default_path; // Checked-in input, relative to Runner/
+    aoc_day_fn_t p_run;
+} runner_day_t;
+
+/**
+ * @struct runner_job_t
+ * @brief One selected day and what running it produced
+ */
+typedef struct runner_job_t
+{
+    const runner_day_t * p_day;
+    const char *         p_file_path;
+    char                 default_path[PATH_MAX]; // Checked-in input
+    aoc_day_result_t     result;
+    uint8_t              status;                 // aoc_day_fn_t return value
+    uint64_t             elapsed_ns;             // Wall time of the day
+} runner_job_t;
+
+/**
+ * @struct runner_args_t
+ * @brief Command line and the jobs the pool runs
+ */
+typedef struct runner_args_t
+{
+    bool          b_selected[DAY_COUNT];
+    const char *  p_input;        // --input, NULL for the checked-in inputs
+    bool          b_no_cache;     // --no-cache, solve every day
+    char          root[PATH_MAX]; // Runner/, where the default paths start
+    aoc_cache_t   cache;
+    aoc_cache_t * p_cache;        // &cache, NULL when bypassed
+    runner_job_t  jobs[DAY_COUNT];
+    size_t        job_count;
+} runner_args_t;
+
+uint8_t chal1_run (const char *       p_file_path,
+                   aoc_cache_t *      p_cache,
+                   aoc_day_result_t * p_result);
+uint8_t chal2_run (const char *       p_file_path,
+                   aoc_cache_t *      p_cache,
+                   aoc_day_result_t * p_result);
+uint8_t chal3_run (const char *       p_file_path,
+                   aoc_cache_t *      p_cache,
+                   aoc_day_result_t * p_result);
+uint8_t chal4_run (const char *       p_file_path,
+                   aoc_cache_t *      p_cache,
+                   aoc_day_result_t * p_result);
+
+#endif /* RUNNER_H */
+
+/** END OF FILE **/
\ No newline at end of file
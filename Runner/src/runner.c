@@ -0,0 +1,351 @@
+/**
+ * @file runner.c
+ *
+ * @brief Unified Advent of Code 2025 runner
+ *
+ * Usage: aoc (--day N [--day N ...] | --all) [--input file] [--threads N]
+ * [--no-cache]
+ *
+ * Every challenge is linked in through its aoc_day_fn_t entry point. The
+ * selected days run one per index of a parallel-for on the shared pool
+ * (aoc_pool_shared), the same workers the days use for their own loops, so
+ * with several threads the days run at the same time. A day started on a
+ * worker runs its own loops inline; a single selected day runs on the
+ * calling thread and keeps the whole pool. Answers and per-day wall times
+ * are printed in day order once every day is done.
+ * Days whose answers are already cached for their input are not solved
+ * again unless --no-cache is given. The checked-in inputs are found next to
+ * the executable, so the runner works from any directory.
+ *
+ * @author Mexeck88
+ *
+ * @date 18OCT26
+ */
+
+#define _GNU_SOURCE // getopt_long
+
+#include <getopt.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "aoc_input.h"
+#include "aoc_pool.h"
+#include "runner.h"
+
+static const runner_day_t g_days[DAY_COUNT] = {
+    { 1, "../Chal1/src/chal1_input.txt", chal1_run },
+    { 2, "../Chal2/src/input.txt", chal2_run },
+    { 3, "../Chal3/src/input.txt", chal3_run },
+    { 4, "../Chal4/src/input.txt", chal4_run },
+};
+
+static const struct option g_options[] = {
+    { "day", required_argument, NULL, 'd' },
+    { "all", no_argument, NULL, 'a' },
+    { "input", required_argument, NULL, 'i' },
+    { "threads", required_argument, NULL, 't' },
+    { "no-cache", no_argument, NULL, 'n' },
+    { NULL, 0, NULL, 0 },
+};
+
+/**
+ * @brief Reads the monotonic clock
+ *
+ * @return Nanoseconds since an arbitrary fixed point
+ */
+static uint64_t
+runner_now_ns (void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return ((uint64_t)now.tv_sec * NS_PER_SEC) + (uint64_t)now.tv_nsec;
+}
+
+/**
+ * @brief Parses a positive integer option value
+ *
+ * @param p_text Option value
+ * @param p_value Receives the value
+ *
+ * @return true if p_text is a whole positive number
+ */
+static bool
+runner_parse_count (const char * p_text, long * p_value)
+{
+    aoc_view_t view = { p_text, strlen(p_text) };
+
+    return (true == aoc_view_parse_long(view, p_value)) && (0 < *p_value);
+}
+
+/**
+ * @brief Finds the Runner/ directory from the executable's own path
+ * (Runner/bin/aoc), which the default input paths are relative to
+ *
+ * @param p_root Receives the directory, "." if it cannot be found
+ * @param size Size of p_root
+ */
+static void
+runner_find_root (char * p_root, size_t size)
+{
+    ssize_t length = readlink("/proc/self/exe", p_root, size - 1);
+    char *  p_cut  = NULL;
+
+    if (0 >= length)
+    {
+        snprintf(p_root, size, ".");
+        return;
+    }
+    p_root[length] = '\0';
+
+    // Drop "/aoc", then "/bin"
+    for (int level = 0; level < 2; level++)
+    {
+        p_cut = strrchr(p_root, '/');
+        if (NULL == p_cut)
+        {
+            snprintf(p_root, size, ".");
+            return;
+        }
+        *p_cut = '\0';
+    }
+}
+
+/**
+ * @brief Parses the command line and queues a job per selected day
+ *
+ * @param argc Argument count
+ * @param argv Argument vector
+ * @param p_args Runner state to fill in
+ *
+ * @return AOC_SUCCESS on success, AOC_FAILURE on a bad command line
+ */
+static uint8_t
+runner_parse_args (int argc, char ** argv, runner_args_t * p_args)
+{
+    int            option = 0;
+    long           value  = 0;
+    runner_job_t * p_job  = NULL;
+
+    while (-1 != (option = getopt_long(argc, argv, "", g_options, NULL)))
+    {
+        switch (option)
+        {
+            case 'd':
+                if ((false == runner_parse_count(optarg, &value))
+                    || (DAY_COUNT < value))
+                {
+                    printf("ERROR: Day must be 1 to %d: %s\n",
+                           DAY_COUNT,
+                           optarg);
+                    return AOC_FAILURE;
+                }
+                p_args->b_selected[value - 1] = true;
+                break;
+
+            case 'a':
+                for (size_t day = 0; day < DAY_COUNT; day++)
+                {
+                    p_args->b_selected[day] = true;
+                }
+                break;
+
+            case 'i':
+                p_args->p_input = optarg;
+                break;
+
+            case 't':
+                if (false == runner_parse_count(optarg, &value))
+                {
+                    printf("ERROR: Thread count must be positive: %s\n",
+                           optarg);
+                    return AOC_FAILURE;
+                }
+                // Sizes the shared pool, which starts on first use
+                setenv(AOC_POOL_ENV, optarg, 1);
+                break;
+
+            case 'n':
+                p_args->b_no_cache = true;
+                break;
+
+            default:
+                printf("Usage: %s (--day N [--day N ...] | --all) "
+                       "[--input file] [--threads N] [--no-cache]\n",
+                       argv[0]);
+                return AOC_FAILURE;
+        }
+    }
+
+    runner_find_root(p_args->root, sizeof(p_args->root));
+
+    for (size_t day = 0; day < DAY_COUNT; day++)
+    {
+        if (true == p_args->b_selected[day])
+        {
+            p_job        = &p_args->jobs[p_args->job_count];
+            p_job->p_day = &g_days[day];
+            if (sizeof(p_job->default_path)
+                <= (size_t)snprintf(p_job->default_path,
+                                    sizeof(p_job->default_path),
+                                    "%s/%s",
+                                    p_args->root,
+                                    g_days[day].p_default_path))
+            {
+                printf("ERROR: Runner path too long: %s\n", p_args->root);
+                return AOC_FAILURE;
+            }
+            p_job->p_file_path = p_job->default_path;
+            p_args->job_count++;
+        }
+    }
+
+    if ((0 == p_args->job_count) || (optind < argc))
+    {
+        printf("Usage: %s (--day N [--day N ...] | --all) "
+               "[--input file] [--threads N] [--no-cache]\n",
+               argv[0]);
+        return AOC_FAILURE;
+    }
+
+    // Every day has its own input format
+    if (NULL != p_args->p_input)
+    {
+        if (1 != p_args->job_count)
+        {
+            printf("ERROR: --input needs exactly one --day\n");
+            return AOC_FAILURE;
+        }
+        p_args->jobs[0].p_file_path = p_args->p_input;
+    }
+
+    return AOC_SUCCESS;
+}
+
+/**
+ * @brief Parallel-for body: runs the queued days [begin, end)
+ *
+ * @param p_ctx Pointer to the runner state
+ * @param begin First job
+ * @param end One past the last job
+ * @param worker Pool worker index (unused)
+ */
+static void
+runner_run_days (void * p_ctx, size_t begin, size_t end, int worker)
+{
+    runner_args_t * p_args = p_ctx;
+    runner_job_t *  p_job  = NULL;
+    uint64_t        start  = 0;
+
+    (void)worker;
+
+    for (size_t next = begin; next < end; next++)
+    {
+        p_job         = &p_args->jobs[next];
+        start         = runner_now_ns();
+        p_job->status = p_job->p_day->p_run(
+            p_job->p_file_path, p_args->p_cache, &p_job->result);
+        p_job->elapsed_ns = runner_now_ns() - start;
+    }
+}
+
+/**
+ * @brief Runs every queued day on the shared pool, one day per chunk
+ *
+ * @param p_args Runner state with the jobs queued
+ *
+ * @return Number of threads in the pool
+ */
+static int
+runner_run_pool (runner_args_t * p_args)
+{
+    aoc_pool_t * p_pool = aoc_pool_shared();
+
+    if (1 == p_args->job_count)
+    {
+        runner_run_days(p_args, 0, 1, 0);
+    }
+    else
+    {
+        aoc_pool_for(p_pool, 0, p_args->job_count, 1, runner_run_days, p_args);
+    }
+
+    return aoc_pool_size(p_pool);
+}
+
+/**
+ * @brief Main function for the unified runner
+ *
+ * @param argc Argument count
+ * @param argv Argument vector
+ *
+ * @return 0 if every day succeeded, 1 otherwise
+ */
+int
+main (int argc, char ** argv)
+{
+    int            retcode = 1;
+    runner_args_t  args;
+    runner_job_t * p_job   = NULL;
+    uint64_t       start   = 0;
+    uint64_t       wall_ns = 0;
+    uint64_t       sum_ns  = 0;
+    int            workers = 0;
+    bool           b_ok    = true;
+
+    memset(&args, 0, sizeof(args));
+
+    if (AOC_SUCCESS != runner_parse_args(argc, argv, &args))
+    {
+        goto EXIT;
+    }
+
+    // Without a usable cache directory, solve uncached
+    if ((false == args.b_no_cache)
+        && (AOC_SUCCESS == aoc_cache_init(&args.cache, NULL)))
+    {
+        args.p_cache = &args.cache;
+    }
+
+    start   = runner_now_ns();
+    workers = runner_run_pool(&args);
+    wall_ns = runner_now_ns() - start;
+
+    for (size_t idx = 0; idx < args.job_count; idx++)
+    {
+        p_job = &args.jobs[idx];
+        sum_ns += p_job->elapsed_ns;
+
+        if (AOC_SUCCESS != p_job->status)
+        {
+            printf("Day %d: FAILED (%.3f ms)\n",
+                   p_job->p_day->day,
+                   (double)p_job->elapsed_ns / NS_PER_MS);
+            b_ok = false;
+            continue;
+        }
+
+        printf("Day %d: part 1 %lld, part 2 %lld (%.3f ms%s)\n",
+               p_job->p_day->day,
+               (long long)p_job->result.part1,
+               (long long)p_job->result.part2,
+               (double)p_job->elapsed_ns / NS_PER_MS,
+               (true == p_job->result.b_cached) ? ", cached" : "");
+    }
+
+    printf("%zu day(s) on %d thread(s): %.3f ms wall, %.3f ms of solving\n",
+           args.job_count,
+           workers,
+           (double)wall_ns / NS_PER_MS,
+           (double)sum_ns / NS_PER_MS);
+    aoc_cache_report(args.p_cache);
+
+    retcode = (true == b_ok) ? 0 : 1;
+EXIT:
+    return retcode;
+}
+
+/** END OF FILE **/
\ No newline at end of file